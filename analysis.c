@@ -0,0 +1,394 @@
+#include <math.h>
+#include "analysis.h"
+#include "module_registry.h"
+
+typedef TYPED_HASH_TABLE(size_t) AnalyzedNodeNames;
+
+// A channel of the configuration with its ends resolved to node indices
+typedef struct {
+	size_t start, end;
+	size_t idx_start, idx_end;
+} AnalyzedChannel;
+
+typedef struct {
+	size_t length;
+	const GraphNodeConfigSection * configs;
+	size_t *successor_starts;  // Successors of node i are successors[successor_starts[i]] up to successor_starts[i + 1]
+	size_t *successors;
+	double *gains;
+	double *current;
+	double *next;
+} AnalyzedGraph;
+
+typedef struct {
+	size_t counter;
+	size_t *index;
+	size_t *lowlink;
+	bool *on_stack;
+	size_t *stack;
+	size_t stack_length;
+	size_t *component;  // Component id of each node, SIZE_MAX if not visited yet
+	size_t component_count;
+} SccState;
+
+// Resolves the node names like load_graph does, a later node with the same name hides the earlier one
+static bool
+analyzed_graph_resolve(const FullConfig * config, AnalyzedChannel * channels)
+{
+	AnalyzedNodeNames names;
+	hash_table_init(&names, NULL);
+	hash_table_reserve(&names, config->nodes.length);
+	for (size_t i = 0; i < config->nodes.length; ++i) {
+		if (config->nodes.items[i].name) {
+			hash_table_insert(&names, hash_table_key_from_cstr(config->nodes.items[i].name), &i);
+		}
+	}
+	bool resolved = true;
+	for (size_t c = 0; c < config->channels.length && resolved; ++c) {
+		const GraphChannelConfig *ch_config = &config->channels.items[c];
+		const char *node_names[2] = {ch_config->from.name, ch_config->to.name};
+		size_t ends[2];
+		for (int j = 0; j < 2; ++j) {
+			HashTableIndex k = node_names[j] ? hash_table_find(&names, hash_table_key_from_cstr(node_names[j])) : -1;
+			if (k < 0) {
+				fprintf(stderr, "No node named \"%s\"\n", node_names[j]);
+				resolved = false;
+				break;
+			}
+			ends[j] = names.value_array[k];
+		}
+		channels[c] = (AnalyzedChannel) {
+			.start = ends[0],
+			.end = ends[1],
+			.idx_start = ch_config->from.index,
+			.idx_end = ch_config->to.index,
+		};
+	}
+	hash_table_deinit(&names);
+	return resolved;
+}
+
+// Successors in output connector order. A later channel on the same output or input connector detaches the earlier one, like graph_channel_init does
+static bool
+analyzed_graph_link(AnalyzedGraph * graph, const AnalyzedChannel * channels, size_t channel_count)
+{
+	size_t n = graph->length;
+	graph->successor_starts = T_ALLOC(n + 1, size_t);
+	graph->successors = T_ALLOC(channel_count ? channel_count : 1, size_t);
+	bool *detached = T_ALLOC(channel_count ? channel_count : 1, bool);
+	if (!graph->successor_starts || !graph->successors || !detached) {
+		free(detached);
+		return false;
+	}
+	for (size_t c = 0; c < channel_count; ++c) {
+		const AnalyzedChannel *ch = &channels[c];
+		for (size_t d = c + 1; d < channel_count && !detached[c]; ++d) {
+			if ((channels[d].start == ch->start && channels[d].idx_start == ch->idx_start) || (channels[d].end == ch->end && channels[d].idx_end == ch->idx_end)) {
+				detached[c] = true;
+			}
+		}
+		if (!detached[c]) {
+			++graph->successor_starts[ch->start + 1];
+		}
+	}
+	for (size_t i = 0; i < n; ++i) {
+		graph->successor_starts[i + 1] += graph->successor_starts[i];
+	}
+
+	// Insertion sort of the channels of each node by the output connector, then the channels are replaced by their end nodes
+	size_t *filled = T_ALLOC(n ? n : 1, size_t);
+	if (!filled) {
+		free(detached);
+		return false;
+	}
+	for (size_t c = 0; c < channel_count; ++c) {
+		if (detached[c]) {
+			continue;
+		}
+		size_t start = channels[c].start;
+		size_t begin = graph->successor_starts[start];
+		size_t k = begin + filled[start]++;
+		for (; k > begin && channels[graph->successors[k - 1]].idx_start > channels[c].idx_start; --k) {
+			graph->successors[k] = graph->successors[k - 1];
+		}
+		graph->successors[k] = c;
+	}
+	for (size_t k = 0; k < graph->successor_starts[n]; ++k) {
+		graph->successors[k] = channels[graph->successors[k]].end;
+	}
+	free(filled);
+	free(detached);
+	return true;
+}
+
+static void
+print_node_name(FILE * out, const AnalyzedGraph * graph, size_t idx)
+{
+	const char *name = graph->configs->items[idx].name;
+	if (name) {
+		fprintf(out, "\"%s\"", name);
+	} else {
+		fprintf(out, "#%ld", idx);
+	}
+}
+
+// Starts with graph->current holding the events delivered at the first hop, returns the total number of deliveries
+static double
+propagate(AnalyzedGraph * graph, const bool * allowed, uint32_t hops, uint32_t * depth)
+{
+	double total = 0;
+	*depth = 0;
+	for (uint32_t hop = 1; hop <= hops; ++hop) {
+		double delivered = 0;
+		for (size_t i = 0; i < graph->length; ++i) {
+			delivered += graph->current[i];
+		}
+		if (delivered == 0) {
+			break;
+		}
+		total += delivered;
+		*depth = hop;
+
+		memset(graph->next, 0, graph->length * sizeof(double));
+		for (size_t i = 0; i < graph->length; ++i) {
+			if (graph->current[i] == 0 || graph->gains[i] == 0) {
+				continue;
+			}
+			for (size_t k = graph->successor_starts[i]; k < graph->successor_starts[i + 1]; ++k) {
+				size_t j = graph->successors[k];
+				if (allowed && !allowed[j]) {
+					continue;
+				}
+				graph->next[j] += graph->current[i] * graph->gains[i];
+			}
+		}
+		double *tmp = graph->current;
+		graph->current = graph->next;
+		graph->next = tmp;
+	}
+	return total;
+}
+
+static void
+tarjan_visit(const AnalyzedGraph * graph, SccState * state, size_t v)
+{
+	state->index[v] = state->lowlink[v] = state->counter++;
+	state->stack[state->stack_length++] = v;
+	state->on_stack[v] = true;
+
+	for (size_t k = graph->successor_starts[v]; k < graph->successor_starts[v + 1]; ++k) {
+		size_t w = graph->successors[k];
+		if (state->index[w] == SIZE_MAX) {
+			tarjan_visit(graph, state, w);
+			if (state->lowlink[w] < state->lowlink[v]) {
+				state->lowlink[v] = state->lowlink[w];
+			}
+		} else if (state->on_stack[w] && state->index[w] < state->lowlink[v]) {
+			state->lowlink[v] = state->index[w];
+		}
+	}
+
+	if (state->lowlink[v] == state->index[v]) {
+		size_t w;
+		do {
+			w = state->stack[--state->stack_length];
+			state->on_stack[w] = false;
+			state->component[w] = state->component_count;
+		} while (w != v);
+		++state->component_count;
+	}
+}
+
+static bool
+is_cyclic_component(const AnalyzedGraph * graph, const SccState * state, size_t component)
+{
+	size_t size = 0;
+	for (size_t i = 0; i < graph->length; ++i) {
+		if (state->component[i] != component) {
+			continue;
+		}
+		++size;
+		for (size_t k = graph->successor_starts[i]; k < graph->successor_starts[i + 1]; ++k) {
+			if (graph->successors[k] == i) {
+				return true;
+			}
+		}
+	}
+	return size > 1;
+}
+
+static bool
+analyze_cycles(FILE * out, AnalyzedGraph * graph, const GraphAnalysisParameters * parameters)
+{
+	bool within_budget = true;
+	size_t n = graph->length;
+	SccState state = {
+		.counter = 0,
+		.index = T_ALLOC(n, size_t),
+		.lowlink = T_ALLOC(n, size_t),
+		.on_stack = T_ALLOC(n, bool),
+		.stack = T_ALLOC(n, size_t),
+		.stack_length = 0,
+		.component = T_ALLOC(n, size_t),
+		.component_count = 0,
+	};
+	bool *allowed = T_ALLOC(n, bool);
+	if (!state.index || !state.lowlink || !state.on_stack || !state.stack || !state.component || !allowed) {
+		perror("Failed to allocate cycle analysis state");
+		within_budget = false;
+		goto cleanup;
+	}
+
+	for (size_t i = 0; i < n; ++i) {
+		state.index[i] = SIZE_MAX;
+		state.component[i] = SIZE_MAX;
+	}
+	for (size_t i = 0; i < n; ++i) {
+		if (state.index[i] == SIZE_MAX) {
+			tarjan_visit(graph, &state, i);
+		}
+	}
+
+	for (size_t c = 0; c < state.component_count; ++c) {
+		if (!is_cyclic_component(graph, &state, c)) {
+			continue;
+		}
+		for (size_t i = 0; i < n; ++i) {
+			allowed[i] = state.component[i] == c;
+		}
+		double worst = 0;
+		uint32_t worst_depth = 0;
+		fprintf(out, "cycle through");
+		for (size_t i = 0; i < n; ++i) {
+			if (!allowed[i]) {
+				continue;
+			}
+			fprintf(out, " ");
+			print_node_name(out, graph, i);
+
+			memset(graph->current, 0, n * sizeof(double));
+			graph->current[i] = 1;
+			uint32_t depth;
+			double blowup = propagate(graph, allowed, parameters->ttl > 0 ? parameters->ttl - 1 : 0, &depth);
+			if (blowup > worst) {
+				worst = blowup;
+				worst_depth = depth;
+			}
+		}
+		fprintf(out, ": TTL-bounded blowup %g, depth %u\n", worst, worst_depth);
+		if (parameters->amplification_budget > 0 && !(worst <= parameters->amplification_budget)) {
+			fprintf(out, "cycle exceeds amplification budget %g\n", parameters->amplification_budget);
+			within_budget = false;
+		}
+	}
+
+cleanup:
+	free(state.index);
+	free(state.lowlink);
+	free(state.on_stack);
+	free(state.stack);
+	free(state.component);
+	free(allowed);
+	return within_budget;
+}
+
+bool
+graph_analyze(FILE * out, FullConfig * config, const GraphAnalysisParameters * parameters)
+{
+	size_t n = config->nodes.length;
+	AnalyzedGraph graph = {
+		.length = n,
+		.configs = &config->nodes,
+		.successor_starts = NULL,
+		.successors = NULL,
+		.gains = T_ALLOC(n, double),
+		.current = T_ALLOC(n, double),
+		.next = T_ALLOC(n, double),
+	};
+	GraphNodeSpecification **specs = T_ALLOC(n ? n : 1, GraphNodeSpecification*);
+	AnalyzedChannel *channels = T_ALLOC(config->channels.length ? config->channels.length : 1, AnalyzedChannel);
+	bool within_budget = true;
+	if ((n && (!graph.gains || !graph.current || !graph.next)) || !specs || !channels) {
+		perror("Failed to allocate graph analysis state");
+		within_budget = false;
+		goto cleanup;
+	}
+	for (size_t i = 0; i < n; ++i) {
+		const char *type_name = config->nodes.items[i].type;
+		if (!type_name) {
+			fprintf(stderr, "No node type for node %ld \"%s\"\n", i, config->nodes.items[i].name);
+			within_budget = false;
+			goto cleanup;
+		}
+		if (!(specs[i] = lookup_graph_node_specification(type_name))) {
+			fprintf(stderr, "Unknown node type \"%s\" for node %ld \"%s\"\n", type_name, i, config->nodes.items[i].name);
+			within_budget = false;
+			goto cleanup;
+		}
+	}
+	if (!analyzed_graph_resolve(config, channels)) {
+		within_budget = false;
+		goto cleanup;
+	}
+	if (!analyzed_graph_link(&graph, channels, config->channels.length)) {
+		perror("Failed to allocate graph analysis state");
+		within_budget = false;
+		goto cleanup;
+	}
+
+	for (size_t i = 0; i < n; ++i) {
+		if (specs[i]->is_source) {
+			graph.gains[i] = 0;
+			continue;
+		}
+		size_t amplification = graph_node_max_amplification(specs[i], &config->nodes.items[i], &config->environment);
+		graph.gains[i] = amplification == SIZE_MAX ? INFINITY : (double) amplification;
+	}
+
+	double total_rate = 0;
+	for (size_t s = 0; s < n; ++s) {
+		if (!specs[s]->is_source) {
+			continue;
+		}
+		memset(graph.current, 0, n * sizeof(double));
+		for (size_t k = graph.successor_starts[s]; k < graph.successor_starts[s + 1]; ++k) {
+			graph.current[graph.successors[k]] += 1;
+		}
+		uint32_t depth;
+		double amplification = propagate(&graph, NULL, parameters->ttl > 0 ? parameters->ttl - 1 : 0, &depth);
+
+		fprintf(out, "source ");
+		print_node_name(out, &graph, s);
+		fprintf(out, ": worst-case amplification %g, depth %u\n", amplification, depth);
+		if (parameters->input_rate > 0) {
+			double rate = amplification * parameters->input_rate;
+			total_rate += rate;
+			fprintf(out, "source ");
+			print_node_name(out, &graph, s);
+			fprintf(out, ": %g events/s handled at %g input events/s\n", rate, parameters->input_rate);
+		}
+		if (parameters->amplification_budget > 0 && !(amplification <= parameters->amplification_budget)) {
+			fprintf(out, "source ");
+			print_node_name(out, &graph, s);
+			fprintf(out, " exceeds amplification budget %g\n", parameters->amplification_budget);
+			within_budget = false;
+		}
+	}
+	if (parameters->input_rate > 0) {
+		fprintf(out, "total: %g events/s handled\n", total_rate);
+	}
+
+	if (!analyze_cycles(out, &graph, parameters)) {
+		within_budget = false;
+	}
+
+cleanup:
+	free(specs);
+	free(channels);
+	free(graph.successor_starts);
+	free(graph.successors);
+	free(graph.gains);
+	free(graph.current);
+	free(graph.next);
+	return within_budget;
+}
@@ -0,0 +1,16 @@
+#ifndef ANALYSIS_H_
+#define ANALYSIS_H_
+
+#include <stdio.h>
+#include "graph.h"
+
+typedef struct {
+	uint32_t ttl;
+	double input_rate;  // Events per second read by each source, 0 to skip the rate estimates
+	double amplification_budget;  // Maximum allowed events handled per source event, 0 to disable the check
+} GraphAnalysisParameters;
+
+// Prints worst-case event amplification for each source node and each cycle, returns false if the budget is exceeded or the graph cannot be built. Works on the configuration alone, so no nodes are created and no devices are opened
+bool graph_analyze(FILE * out, FullConfig * config, const GraphAnalysisParameters * parameters);
+
+#endif /* end of include guard: ANALYSIS_H_ */
@@ -0,0 +1,326 @@
+#include <stdio.h>
+#include <time.h>
+#include "../hash_table.h"
+#include "../ring_buffer.h"
+#include "../events.h"
+
+// Every measurement repeats its operation about this many times
+#define TARGET_OPERATIONS (1 << 21)
+#define BULK_LENGTH 64
+#define MAX_SIZE 65536
+
+typedef TYPED_HASH_TABLE(size_t) NameTable;
+typedef TYPED_INT_HASH_TABLE(size_t) IntTable;
+typedef TYPED_RING_BUFFER(uint64_t) ValueBuffer;
+
+static const size_t table_sizes[] = {16, 1024, MAX_SIZE};
+static const size_t buffer_sizes[] = {16, 1024, MAX_SIZE};
+static const size_t modifier_byte_lengths[] = {4, 32, 256};
+static const size_t event_counts[] = {16, 256, 4096};
+
+static char names[MAX_SIZE * 2][16];
+static HashTableKey name_keys[MAX_SIZE * 2];
+static uint64_t int_keys[MAX_SIZE * 2];
+static volatile uint64_t sink;
+static size_t errors;
+
+static double
+seconds()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// One tab-separated line per measurement, under the header printed by main
+static void
+report(const char * benchmark, const char * variant, size_t size, double elapsed, size_t operations)
+{
+	printf("%s\t%s\t%zu\t%.2f\n", benchmark, variant, size, elapsed * 1e9 / operations);
+}
+
+inline static size_t
+rounds_for(size_t size)
+{
+	return size >= TARGET_OPERATIONS ? 1 : TARGET_OPERATIONS / size;
+}
+
+// Keys [0, size) are inserted, keys [size, 2 size) are absent
+static void
+bench_hash_table(size_t size)
+{
+	size_t rounds = rounds_for(size);
+	double insert = 0, hit = 0, miss = 0, delete = 0;
+	for (size_t r = 0; r < rounds; ++r) {
+		NameTable table;
+		hash_table_init(&table, NULL);
+		double start = seconds();
+		for (size_t i = 0; i < size; ++i) {
+			hash_table_insert(&table, name_keys[i], &i);
+		}
+		double inserted = seconds();
+		for (size_t i = 0; i < size; ++i) {
+			errors += hash_table_find(&table, name_keys[i]) < 0;
+		}
+		double found = seconds();
+		for (size_t i = size; i < size * 2; ++i) {
+			errors += hash_table_find(&table, name_keys[i]) >= 0;
+		}
+		double missed = seconds();
+		for (size_t i = 0; i < size; ++i) {
+			errors += !hash_table_delete_by_key(&table, name_keys[i]);
+		}
+		double deleted = seconds();
+		hash_table_deinit(&table);
+		insert += inserted - start;
+		hit += found - inserted;
+		miss += missed - found;
+		delete += deleted - missed;
+	}
+	report("hash_table_insert", "string", size, insert, rounds * size);
+	report("hash_table_find_hit", "string", size, hit, rounds * size);
+	report("hash_table_find_miss", "string", size, miss, rounds * size);
+	report("hash_table_delete", "string", size, delete, rounds * size);
+}
+
+static void
+bench_int_hash_table(size_t size)
+{
+	size_t rounds = rounds_for(size);
+	double insert = 0, hit = 0, miss = 0, delete = 0;
+	for (size_t r = 0; r < rounds; ++r) {
+		IntTable table;
+		int_hash_table_init(&table, NULL);
+		double start = seconds();
+		for (size_t i = 0; i < size; ++i) {
+			int_hash_table_insert(&table, int_keys[i], &i);
+		}
+		double inserted = seconds();
+		for (size_t i = 0; i < size; ++i) {
+			errors += int_hash_table_find(&table, int_keys[i]) < 0;
+		}
+		double found = seconds();
+		for (size_t i = size; i < size * 2; ++i) {
+			errors += int_hash_table_find(&table, int_keys[i]) >= 0;
+		}
+		double missed = seconds();
+		for (size_t i = 0; i < size; ++i) {
+			errors += !int_hash_table_delete_by_key(&table, int_keys[i]);
+		}
+		double deleted = seconds();
+		int_hash_table_deinit(&table);
+		insert += inserted - start;
+		hit += found - inserted;
+		miss += missed - found;
+		delete += deleted - missed;
+	}
+	report("hash_table_insert", "pointer", size, insert, rounds * size);
+	report("hash_table_find_hit", "pointer", size, hit, rounds * size);
+	report("hash_table_find_miss", "pointer", size, miss, rounds * size);
+	report("hash_table_delete", "pointer", size, delete, rounds * size);
+}
+
+// Growing from empty to size and draining, which also shrinks, then pushing and popping at a steady length of size
+static void
+bench_ring_buffer(size_t size)
+{
+	size_t rounds = rounds_for(size);
+	uint64_t values[BULK_LENGTH];
+	for (size_t i = 0; i < BULK_LENGTH; ++i) {
+		values[i] = i;
+	}
+
+	ValueBuffer buffer;
+	ring_buffer_init(&buffer);
+	double start = seconds();
+	for (size_t r = 0; r < rounds; ++r) {
+		for (uint64_t i = 0; i < size; ++i) {
+			ring_buffer_push(&buffer, &i);
+		}
+		for (size_t i = 0; i < size; ++i) {
+			uint64_t value;
+			sink += ring_buffer_pop(&buffer, &value);
+			sink += value;
+		}
+	}
+	report("ring_buffer_grow_drain", "growable", size, seconds() - start, rounds * size * 2);
+
+	for (uint64_t i = 0; i < size; ++i) {
+		ring_buffer_push(&buffer, &i);
+	}
+	start = seconds();
+	for (size_t i = 0; i < TARGET_OPERATIONS; ++i) {
+		uint64_t value;
+		sink += ring_buffer_pop(&buffer, &value);
+		ring_buffer_push(&buffer, &value);
+	}
+	report("ring_buffer_push_pop", "growable", size, seconds() - start, TARGET_OPERATIONS * 2);
+
+	size_t bulk_rounds = TARGET_OPERATIONS / BULK_LENGTH;
+	start = seconds();
+	for (size_t i = 0; i < bulk_rounds; ++i) {
+		ring_buffer_push_bulk(&buffer, values, BULK_LENGTH);
+		sink += ring_buffer_pop_bulk(&buffer, values, BULK_LENGTH);
+	}
+	report("ring_buffer_bulk_push_pop", "growable", size, seconds() - start, bulk_rounds * BULK_LENGTH * 2);
+	ring_buffer_deinit(&buffer);
+
+	ring_buffer_init_fixed(&buffer, size);
+	for (uint64_t i = 0; i + 1 < size; ++i) {
+		ring_buffer_push(&buffer, &i);
+	}
+	start = seconds();
+	for (size_t i = 0; i < TARGET_OPERATIONS; ++i) {
+		uint64_t value;
+		sink += ring_buffer_pop(&buffer, &value);
+		ring_buffer_push(&buffer, &value);
+	}
+	report("ring_buffer_push_pop", "fixed", size, seconds() - start, TARGET_OPERATIONS * 2);
+	ring_buffer_deinit(&buffer);
+}
+
+// Elements spread over byte_length bytes, the sets are extended once before the timed loops
+static void
+bench_modifier_set(size_t byte_length)
+{
+	Modifier modifier_count = byte_length * 8;
+	ModifierSet target = EMPTY_MODIFIER_SET, source = EMPTY_MODIFIER_SET, empty = EMPTY_MODIFIER_SET;
+	modifier_set_extend(&target, byte_length);
+	for (Modifier m = 0; m < modifier_count; m += 3) {
+		modifier_set_set(&source, m);
+	}
+
+	double start = seconds();
+	for (size_t i = 0; i < TARGET_OPERATIONS; ++i) {
+		modifier_set_set(&target, (i * 7) % modifier_count);
+	}
+	report("modifier_set_set", "element", byte_length, seconds() - start, TARGET_OPERATIONS);
+
+	start = seconds();
+	for (size_t i = 0; i < TARGET_OPERATIONS; ++i) {
+		sink += modifier_set_has(target, (i * 5) % modifier_count);
+	}
+	report("modifier_set_has", "element", byte_length, seconds() - start, TARGET_OPERATIONS);
+
+	start = seconds();
+	for (size_t i = 0; i < TARGET_OPERATIONS; ++i) {
+		modifier_set_toggle(&target, (i * 11) % modifier_count);
+	}
+	report("modifier_set_toggle", "element", byte_length, seconds() - start, TARGET_OPERATIONS);
+
+	start = seconds();
+	for (size_t i = 0; i < TARGET_OPERATIONS; ++i) {
+		modifier_set_unset(&target, (i * 13) % modifier_count);
+	}
+	report("modifier_set_unset", "element", byte_length, seconds() - start, TARGET_OPERATIONS);
+
+	size_t set_rounds = TARGET_OPERATIONS / 16;
+	start = seconds();
+	for (size_t i = 0; i < set_rounds; ++i) {
+		modifier_set_operation_from(&target, source, i % 3);
+	}
+	report("modifier_set_operation_from", "set", byte_length, seconds() - start, set_rounds);
+
+	start = seconds();
+	for (size_t i = 0; i < set_rounds; ++i) {
+		sink += modifier_set_matches_mask(target, source, empty, empty);
+	}
+	report("modifier_set_matches_mask", "set", byte_length, seconds() - start, set_rounds);
+
+	start = seconds();
+	for (size_t i = 0; i < set_rounds; ++i) {
+		ModifierSet copy = modifier_set_copy(source);
+		sink += copy.byte_length;
+		modifier_set_destruct(&copy);
+	}
+	report("modifier_set_copy", "set", byte_length, seconds() - start, set_rounds);
+
+	modifier_set_destruct(&target);
+	modifier_set_destruct(&source);
+}
+
+// event_create keeps the list sorted by scanning from the end, so the order of the timestamps decides its cost
+static void
+bench_events(size_t count, const char * order)
+{
+	size_t rounds = rounds_for(count * 16);
+	AbsoluteTime base = get_current_time();
+	uint64_t state = count;
+	double create = 0, replicate = 0, destroy = 0;
+	for (size_t r = 0; r < rounds; ++r) {
+		EventData data = {
+			.code = {.ns = 0, .major = 0, .minor = 0},
+			.ttl = DEFAULT_EVENT_TTL,
+			.priority = 0,
+			.payload = 0,
+			.modifiers = EMPTY_MODIFIER_SET,
+			.time = base,
+		};
+		double start = seconds();
+		for (size_t i = 0; i < count; ++i) {
+			size_t offset = i;
+			if (order[0] == 'r') {
+				offset = count - i;
+			} else if (order[0] == 's') {
+				state = state * 6364136223846793005 + 1442695040888963407;
+				offset = (state >> 33) % count;
+			}
+			data.time = absolute_time_add_relative(base, relative_time_from_millisecond(offset));
+			data.payload = i;
+			event_create(&data);
+		}
+		double created = seconds();
+		FOREACH_EVENT(event) {
+			if (event_replicate(event, 1)) {
+				event = event->next;
+			}
+		}
+		double replicated = seconds();
+		size_t length = 0;
+		FOREACH_EVENT(event) {
+			++length;
+			errors += event->next != &END_EVENTS && absolute_time_cmp(event->data.time, event->next->data.time) > 0;
+		}
+		errors += length != count * 2;
+		event_destroy_all();
+		double destroyed = seconds();
+		create += created - start;
+		replicate += replicated - created;
+		destroy += destroyed - replicated;
+	}
+	report("event_create", order, count, create, rounds * count);
+	report("event_replicate", order, count, replicate, rounds * count);
+	report("event_destroy", order, count, destroy, rounds * count * 2);
+}
+
+int
+main()
+{
+	for (size_t i = 0; i < MAX_SIZE * 2; ++i) {
+		snprintf(names[i], sizeof(names[i]), "node_%zu", i);
+		name_keys[i] = hash_table_key_from_cstr(names[i]);
+		int_keys[i] = 0x7F0000000000 + i * 64;
+	}
+
+	printf("benchmark\tvariant\tsize\tns_per_operation\n");
+	for (size_t i = 0; i < lengthof(table_sizes); ++i) {
+		bench_hash_table(table_sizes[i]);
+		bench_int_hash_table(table_sizes[i]);
+	}
+	for (size_t i = 0; i < lengthof(buffer_sizes); ++i) {
+		bench_ring_buffer(buffer_sizes[i]);
+	}
+	for (size_t i = 0; i < lengthof(modifier_byte_lengths); ++i) {
+		bench_modifier_set(modifier_byte_lengths[i]);
+	}
+	for (size_t i = 0; i < lengthof(event_counts); ++i) {
+		bench_events(event_counts[i], "in_order");
+		bench_events(event_counts[i], "reversed");
+		bench_events(event_counts[i], "shuffled");
+	}
+	if (errors) {
+		fprintf(stderr, "Unexpected container contents: %zu\n", errors);
+		return 1;
+	}
+	return 0;
+}
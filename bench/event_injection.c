@@ -0,0 +1,129 @@
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <time.h>
+#include "../event_injection.h"
+
+#define INJECTIONS_PER_PRODUCER 200000
+#define MAX_PRODUCERS 16
+
+typedef struct {
+	EventInjection as_EventInjection;
+	size_t producer;
+} Injection;
+
+typedef struct {
+	pthread_t thread;
+	size_t index;
+	Injection *injections;
+} Producer;
+
+static const size_t producer_counts[] = {1, 4, 8, 16};
+static pthread_barrier_t start_barrier;
+static size_t next_sequence[MAX_PRODUCERS];
+static size_t errors;
+
+static double
+seconds()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Each producer's injections arrive in the order of its pushes
+static void
+deliver(EventInjection * self, EventNode * event)
+{
+	Injection *injection = DOWNCAST(Injection, EventInjection, self);
+	if (!event) {
+		++errors;
+		return;
+	}
+	errors += (size_t) event->data.payload != next_sequence[injection->producer]++;
+	event_destroy(event);
+}
+
+static void *
+produce(void * argument)
+{
+	Producer *producer = argument;
+	pthread_barrier_wait(&start_barrier);
+	for (size_t i = 0; i < INJECTIONS_PER_PRODUCER; ++i) {
+		event_injection_push(&producer->injections[i].as_EventInjection);
+	}
+	return NULL;
+}
+
+static bool
+run(size_t producer_count)
+{
+	static Producer producers[MAX_PRODUCERS];
+	AbsoluteTime time = get_current_time();
+	for (size_t p = 0; p < producer_count; ++p) {
+		producers[p].index = p;
+		producers[p].injections = T_ALLOC(INJECTIONS_PER_PRODUCER, Injection);
+		if (!producers[p].injections) {
+			return false;
+		}
+		for (size_t i = 0; i < INJECTIONS_PER_PRODUCER; ++i) {
+			producers[p].injections[i] = (Injection) {
+				.as_EventInjection = {
+					.data = {
+						.code = {.ns = 0, .major = 0, .minor = p},
+						.ttl = DEFAULT_EVENT_TTL,
+						.priority = 0,
+						.payload = i,
+						.modifiers = EMPTY_MODIFIER_SET,
+						.time = time,
+					},
+					.deliver = &deliver,
+				},
+				.producer = p,
+			};
+		}
+		next_sequence[p] = 0;
+	}
+
+	pthread_barrier_init(&start_barrier, NULL, producer_count + 1);
+	for (size_t p = 0; p < producer_count; ++p) {
+		pthread_create(&producers[p].thread, NULL, &produce, &producers[p]);
+	}
+	size_t total = producer_count * INJECTIONS_PER_PRODUCER;
+	size_t delivered = 0, drains = 0;
+	double start = seconds();
+	pthread_barrier_wait(&start_barrier);
+	// Sleeps on the wake fd like the processing loop
+	struct pollfd wake = {.fd = event_injection_wake_fd(), .events = POLLIN};
+	while (delivered < total) {
+		size_t count = event_injection_drain();
+		delivered += count;
+		++drains;
+		if (!count) {
+			poll(&wake, 1, -1);
+		}
+	}
+	double elapsed = seconds() - start;
+	pthread_barrier_destroy(&start_barrier);
+	for (size_t p = 0; p < producer_count; ++p) {
+		pthread_join(producers[p].thread, NULL);
+		free(producers[p].injections);
+	}
+	printf("\t%2zu producers: %6.1f ns/injection, %5.2f M injections/s, %zu drains\n", producer_count, elapsed * 1e9 / total, total / elapsed * 1e-6, drains);
+	return delivered == total;
+}
+
+int
+main()
+{
+	bool success = true;
+	printf("event_injection, %d injections per producer\n", INJECTIONS_PER_PRODUCER);
+	for (size_t i = 0; i < lengthof(producer_counts); ++i) {
+		success = run(producer_counts[i]) && success;
+	}
+	if (errors || !success) {
+		fprintf(stderr, "Injections lost or reordered\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,198 @@
+#include <stdio.h>
+#include <time.h>
+#include <libconfig.h>
+#include <linux/input.h>
+#include <linux/input-event-codes.h>
+#include "../hash_table.h"
+
+#define MAX_NAMES 4096
+#define HASH_REPETITIONS 2000
+#define DEFAULT_CONFIG_A "config.cfg"
+#define DEFAULT_CONFIG_B "quadtap-both-click.cfg"
+
+typedef struct {
+	const char *title;
+	size_t length;
+	const char *names[MAX_NAMES];
+} NameList;
+
+typedef struct {
+	const char *title;
+	uint64_t (*function)(const char *bytes, size_t length);
+} HashFunction;
+
+static const HashFunction functions[] = {
+	{"fnv_1a", &hash_table_hash_fnv_1a},
+	{"wyhash", &hash_table_hash_wyhash},
+};
+
+static NameList event_codes = {.title = "event code names", .length = 0};
+static NameList node_names = {.title = "node names", .length = 0};
+static NameList predicate_names = {.title = "predicate names", .length = 0};
+
+static double
+seconds()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void
+add_name(NameList * list, const char * name)
+{
+	if (name && list->length < MAX_NAMES) {
+		list->names[list->length++] = name;
+	}
+}
+
+static void
+populate_event_code_names()
+{
+#define DECLARE_EVENT_CODE(enum_name, prefix_name, unqualified_name) { \
+	add_name(&event_codes, #prefix_name "_" #unqualified_name); \
+	add_name(&event_codes, #enum_name "." #unqualified_name); \
+}
+
+#include "../event_code_names.cc"
+
+#undef DECLARE_EVENT_CODE
+}
+
+// The names are owned by the config, which is kept until exit
+static bool
+populate_config_names(config_t * config, const char * path)
+{
+	config_init(config);
+	if (config_read_file(config, path) != CONFIG_TRUE) {
+		fprintf(stderr, "%s:%d: %s\n", path, config_error_line(config), config_error_text(config));
+		return false;
+	}
+	config_setting_t *root = config_root_setting(config);
+	config_setting_t *nodes = config_setting_get_member(root, "nodes");
+	config_setting_t *predicates = config_setting_get_member(root, "predicates");
+	for (int i = 0; nodes && i < config_setting_length(nodes); ++i) {
+		add_name(&node_names, config_setting_name(config_setting_get_elem(nodes, i)));
+	}
+	for (int i = 0; predicates && i < config_setting_length(predicates); ++i) {
+		add_name(&predicate_names, config_setting_name(config_setting_get_elem(predicates, i)));
+	}
+	return true;
+}
+
+// Chi-squared statistic of the bucket counts divided by its degrees of freedom, about 1 for a uniform hash
+static double
+chi_squared_ratio(const uint64_t * hashes, size_t length, uint8_t shift, size_t bucket_count)
+{
+	static size_t counts[MAX_NAMES * 2];
+	memset(counts, 0, bucket_count * sizeof(size_t));
+	for (size_t i = 0; i < length; ++i) {
+		++counts[(hashes[i] >> shift) & (bucket_count - 1)];
+	}
+	double expected = (double) length / bucket_count;
+	double sum = 0;
+	for (size_t i = 0; i < bucket_count; ++i) {
+		sum += (counts[i] - expected) * (counts[i] - expected) / expected;
+	}
+	return sum / (bucket_count - 1);
+}
+
+static void
+measure(const NameList * list, const HashFunction * function)
+{
+	static uint64_t hashes[MAX_NAMES];
+	static size_t lengths[MAX_NAMES];
+	size_t bytes = 0;
+	for (size_t i = 0; i < list->length; ++i) {
+		lengths[i] = strlen(list->names[i]);
+		hashes[i] = function->function(list->names[i], lengths[i]);
+		bytes += lengths[i];
+	}
+
+	// Power of two bucket counts like the tables, low bits as control tags and the bits above them as groups
+	size_t bucket_count = 2;
+	while (bucket_count < list->length) {
+		bucket_count <<= 1;
+	}
+	double low = chi_squared_ratio(hashes, list->length, 0, bucket_count);
+	double high = chi_squared_ratio(hashes, list->length, 7, bucket_count);
+
+	uint64_t sink = 0;
+	double start = seconds();
+	for (size_t r = 0; r < HASH_REPETITIONS; ++r) {
+		for (size_t i = 0; i < list->length; ++i) {
+			sink += function->function(list->names[i], lengths[i]);
+		}
+	}
+	double elapsed = seconds() - start;
+	__asm__ volatile ("" : : "r" (sink));
+	printf("\t%-8s %6.1f ns/key %6.2f GB/s, chi-squared/df %5.2f (low bits) %5.2f (bits 7+), %zu buckets\n", function->title, elapsed * 1e9 / HASH_REPETITIONS / list->length, bytes * HASH_REPETITIONS / elapsed * 1e-9, low, high, bucket_count);
+}
+
+typedef TYPED_HASH_TABLE(size_t) NameTable;
+
+// Lookups through the hash table with the function selected at build time
+static bool
+measure_lookups(const NameList * list)
+{
+	static HashTableKey keys[MAX_NAMES];
+	NameTable table;
+	hash_table_init(&table, NULL);
+	for (size_t i = 0; i < list->length; ++i) {
+		keys[i] = hash_table_key_from_cstr(list->names[i]);
+		hash_table_insert(&table, keys[i], &i);
+	}
+	size_t errors = 0;
+	double start = seconds();
+	for (size_t r = 0; r < HASH_REPETITIONS; ++r) {
+		for (size_t i = 0; i < list->length; ++i) {
+			HashTableIndex index = hash_table_find(&table, hash_table_key_from_bytes(keys[i].bytes, keys[i].length));
+			errors += index < 0 || strcmp(list->names[table.value_array[index]], list->names[i]) != 0;  // Some names are repeated
+		}
+	}
+	double elapsed = seconds() - start;
+	printf("\thash_table_find %6.1f ns/key\n", elapsed * 1e9 / HASH_REPETITIONS / list->length);
+	hash_table_deinit(&table);
+	return !errors;
+}
+
+int
+main(int argc, char ** argv)
+{
+	const char *default_paths[] = {DEFAULT_CONFIG_A, DEFAULT_CONFIG_B};
+	const char **paths = argc > 1 ? (const char**) argv + 1 : default_paths;
+	size_t path_count = argc > 1 ? (size_t) argc - 1 : sizeof(default_paths) / sizeof(*default_paths);
+	config_t *configs = T_ALLOC(path_count, config_t);
+	if (!configs) {
+		return 1;
+	}
+	populate_event_code_names();
+	for (size_t i = 0; i < path_count; ++i) {
+		if (!populate_config_names(&configs[i], paths[i])) {
+			return 1;
+		}
+	}
+
+	bool success = true;
+	const NameList *lists[] = {&event_codes, &node_names, &predicate_names};
+	printf("Hash functions, tables built with HASH_TABLE_HASH=%d\n", HASH_TABLE_HASH);
+	for (size_t i = 0; i < sizeof(lists) / sizeof(*lists); ++i) {
+		if (!lists[i]->length) {
+			continue;
+		}
+		printf("%s, %zu keys\n", lists[i]->title, lists[i]->length);
+		for (size_t j = 0; j < sizeof(functions) / sizeof(*functions); ++j) {
+			measure(lists[i], &functions[j]);
+		}
+		success = measure_lookups(lists[i]) && success;
+	}
+	if (!success) {
+		fprintf(stderr, "Unexpected lookup results\n");
+	}
+
+	for (size_t i = 0; i < path_count; ++i) {
+		config_destroy(&configs[i]);
+	}
+	free(configs);
+	return success ? 0 : 1;
+}
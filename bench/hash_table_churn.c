@@ -0,0 +1,94 @@
+#include <stdio.h>
+#include <time.h>
+#include "../hash_table.h"
+
+#define LIVE_ENTRIES 4096
+#define PHASE_OPERATIONS 1000000
+#define PHASE_COUNT 8
+
+typedef TYPED_INT_HASH_TABLE(uint64_t) PointerSet;
+typedef TYPED_HASH_TABLE(uint64_t) NameSet;
+
+static double
+seconds()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Distinct heap-like addresses, like the events buffered by the window node
+inline static uint64_t
+pointer_key(uint64_t serial)
+{
+	return 0x7F0000000000 + serial * 64;
+}
+
+// Each operation inserts the newest entry, looks up a live and a removed one and deletes the oldest
+static bool
+churn_pointers()
+{
+	PointerSet set;
+	int_hash_table_init(&set, NULL);
+	uint64_t serial = 0;
+	for (; serial < LIVE_ENTRIES; ++serial) {
+		int_hash_table_insert(&set, pointer_key(serial), &serial);
+	}
+	size_t errors = 0;
+	printf("int_hash_table churn, %d live entries\n", LIVE_ENTRIES);
+	for (size_t phase = 0; phase < PHASE_COUNT; ++phase) {
+		double start = seconds();
+		for (size_t i = 0; i < PHASE_OPERATIONS; ++i, ++serial) {
+			int_hash_table_insert(&set, pointer_key(serial), &serial);
+			errors += int_hash_table_find(&set, pointer_key(serial - LIVE_ENTRIES / 2)) < 0;
+			errors += int_hash_table_find(&set, pointer_key(serial - LIVE_ENTRIES - 1)) >= 0;
+			errors += !int_hash_table_delete_by_key(&set, pointer_key(serial - LIVE_ENTRIES));
+		}
+		double elapsed = seconds() - start;
+		printf("\tphase %zu: %6.1f ns/operation, capacity %zu\n", phase, elapsed * 1e9 / PHASE_OPERATIONS, set.capacity);
+	}
+	int_hash_table_deinit(&set);
+	return !errors;
+}
+
+// Same pattern with string keys, cycling through twice as many names as live entries
+static bool
+churn_names()
+{
+	static char names[LIVE_ENTRIES * 2][24];
+	for (size_t i = 0; i < LIVE_ENTRIES * 2; ++i) {
+		snprintf(names[i], sizeof(names[i]), "node_%zu", i);
+	}
+	NameSet set;
+	hash_table_init(&set, NULL);
+	uint64_t serial = 0;
+	for (; serial < LIVE_ENTRIES; ++serial) {
+		hash_table_insert(&set, hash_table_key_from_cstr(names[serial % (LIVE_ENTRIES * 2)]), &serial);
+	}
+	size_t errors = 0;
+	printf("hash_table churn, %d live entries\n", LIVE_ENTRIES);
+	for (size_t phase = 0; phase < PHASE_COUNT; ++phase) {
+		double start = seconds();
+		for (size_t i = 0; i < PHASE_OPERATIONS; ++i, ++serial) {
+			hash_table_insert(&set, hash_table_key_from_cstr(names[serial % (LIVE_ENTRIES * 2)]), &serial);
+			errors += hash_table_find(&set, hash_table_key_from_cstr(names[(serial - LIVE_ENTRIES / 2) % (LIVE_ENTRIES * 2)])) < 0;
+			errors += hash_table_find(&set, hash_table_key_from_cstr(names[(serial - LIVE_ENTRIES - 1) % (LIVE_ENTRIES * 2)])) >= 0;
+			errors += !hash_table_delete_by_key(&set, hash_table_key_from_cstr(names[(serial - LIVE_ENTRIES) % (LIVE_ENTRIES * 2)]));
+		}
+		double elapsed = seconds() - start;
+		printf("\tphase %zu: %6.1f ns/operation, capacity %zu\n", phase, elapsed * 1e9 / PHASE_OPERATIONS, set.capacity);
+	}
+	hash_table_deinit(&set);
+	return !errors;
+}
+
+int
+main()
+{
+	bool success = churn_pointers();
+	success = churn_names() && success;
+	if (!success) {
+		fprintf(stderr, "Unexpected lookup results\n");
+	}
+	return success ? 0 : 1;
+}
@@ -0,0 +1,418 @@
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "../event_predicate.h"
+#include "../event_predicate_index.h"
+#include "../event_predicate_kernels.h"
+#include "../event_predicate_native.h"
+
+#define ROUNDS 64
+#define NATIVE_ROUNDS 4
+#define MAX_PREDICATES 48
+#define EVENT_COUNT 150  // Not a multiple of EVPRED_BATCH_LANES, so that the last batch is partial
+#define MODIFIER_COUNT 16
+#define WORDS ((EVENT_COUNT + EVPRED_BATCH_LANES - 1) / EVPRED_BATCH_LANES)
+
+static size_t errors = 0;
+static uint64_t random_state = 0x9e3779b97f4a7c15;
+
+// Bounds where the sign or the high half of a 64-bit value changes, the SSE2 comparison handles the halves separately
+static const int64_t edges[] = {
+	INT64_MIN,
+	-((int64_t) 1 << 32) - 1,
+	-((int64_t) 1 << 32),
+	INT32_MIN,
+	-1,
+	0,
+	INT32_MAX,
+	UINT32_MAX,
+	(int64_t) 1 << 32,
+	INT64_MAX,
+};
+
+static uint64_t
+random_next()
+{
+	random_state ^= random_state << 13;
+	random_state ^= random_state >> 7;
+	random_state ^= random_state << 17;
+	return random_state;
+}
+
+static int64_t
+random_value()
+{
+	switch (random_next() % 4) {
+	case 0:
+		return (int64_t) random_next();
+	case 1:
+		return (int64_t) (random_next() % 9) - 4;
+	default:
+		// Wraps around at the extremes, which are edges too
+		return (int64_t) ((uint64_t) edges[random_next() % (sizeof(edges) / sizeof(edges[0]))] + random_next() % 3 - 1);
+	}
+}
+
+static ModifierSet
+random_modifiers(size_t count)
+{
+	ModifierSet modifiers = EMPTY_MODIFIER_SET;
+	for (size_t i = 0; i < count; ++i) {
+		modifier_set_set(&modifiers, random_next() % MODIFIER_COUNT);
+	}
+	return modifiers;
+}
+
+static EventPredicate
+random_leaf()
+{
+	EventPredicate predicate = {
+		.type = EVPRED_ACCEPT,
+	};
+	switch (random_next() % 8) {
+	case 0:
+		break;
+	case 1:
+	case 2:
+		predicate.type = random_next() % 2 ? EVPRED_CODE_SET : EVPRED_PAYLOAD_SET;
+		predicate.set_data.length = 1 + random_next() % 6;
+		predicate.set_data.values = T_ALLOC(predicate.set_data.length, int64_t);
+		for (size_t i = 0; i < predicate.set_data.length; ++i) {
+			predicate.set_data.values[i] = predicate.type == EVPRED_CODE_SET ? (uint16_t) random_value() : random_value();
+		}
+		break;
+	case 3:
+		predicate.type = EVPRED_MODIFIER;
+		predicate.single_modifier = random_next() % MODIFIER_COUNT;
+		break;
+	case 4:
+		predicate.type = EVPRED_MODIFIER_MASK;
+		predicate.modifier_mask_data.required = random_modifiers(random_next() % 2);
+		predicate.modifier_mask_data.forbidden = random_modifiers(random_next() % 2);
+		predicate.modifier_mask_data.any = random_modifiers(random_next() % 3);
+		break;
+	default:
+		predicate.type = EVPRED_CODE_NS + random_next() % (EVPRED_INPUT_INDEX - EVPRED_CODE_NS + 1);
+		predicate.range_data.min_value = random_value();
+		predicate.range_data.max_value = random_value();
+		// Mostly nonempty ranges
+		if (predicate.range_data.min_value > predicate.range_data.max_value && random_next() % 4) {
+			int64_t min_value = predicate.range_data.max_value;
+			predicate.range_data.max_value = predicate.range_data.min_value;
+			predicate.range_data.min_value = min_value;
+		}
+		break;
+	}
+	return predicate;
+}
+
+static EventPredicate
+random_aggregate(EventPredicateHandle count)
+{
+	EventPredicate predicate = {
+		.type = random_next() % 2 ? EVPRED_CONJUNCTION : EVPRED_DISJUNCTION,
+		.aggregate_data = {
+			.length = 1 + random_next() % 4,
+		},
+	};
+	predicate.aggregate_data.handles = T_ALLOC(predicate.aggregate_data.length, EventPredicateHandle);
+	for (size_t i = 0; i < predicate.aggregate_data.length; ++i) {
+		predicate.aggregate_data.handles[i] = random_next() % count;
+	}
+	return predicate;
+}
+
+// Registers the predicates, some of them mutable, and returns their count
+static EventPredicateHandle
+register_predicates(bool * mutable)
+{
+	EventPredicateHandle count = 4 + random_next() % (MAX_PREDICATES - 4);
+	for (EventPredicateHandle i = 0; i < count; ++i) {
+		EventPredicate predicate = i < 4 || random_next() % 5 < 3 ? random_leaf() : random_aggregate(i);
+		predicate.enabled = random_next() % 8 != 0;
+		predicate.inverted = random_next() % 4 == 0;
+		if (event_predicate_register(predicate) != i) {
+			fprintf(stderr, "Could not register predicate %d\n", i);
+			exit(1);
+		}
+		mutable[i] = random_next() % 6 == 0;
+		if (mutable[i]) {
+			event_predicate_mark_mutable(i);
+		}
+	}
+	return count;
+}
+
+static void
+random_events(EventNode * events, uint8_t (*modifier_bits)[MODIFIER_COUNT / 8])
+{
+	for (size_t i = 0; i < EVENT_COUNT; ++i) {
+		for (size_t j = 0; j < MODIFIER_COUNT / 8; ++j) {
+			modifier_bits[i][j] = random_next();
+		}
+		events[i] = (EventNode) {
+			.data = {
+				.code = {
+					.ns = random_value(),
+					.major = random_value(),
+					.minor = random_value(),
+				},
+				.payload = random_value(),
+				.modifiers = {
+					.byte_length = random_next() % (MODIFIER_COUNT / 8 + 1),
+					.bits = modifier_bits[i],
+				},
+			},
+			.input_index = random_value(),
+		};
+	}
+}
+
+static bool
+modifiers_match(const EventPredicate * predicate, ModifierSet modifiers)
+{
+	bool any_expected = false, any_found = false;
+	for (Modifier modifier = 0; modifier < MODIFIER_COUNT; ++modifier) {
+		bool found = modifier_set_has(modifiers, modifier);
+		if ((modifier_set_has(predicate->modifier_mask_data.required, modifier) && !found) || (modifier_set_has(predicate->modifier_mask_data.forbidden, modifier) && found)) {
+			return false;
+		}
+		if (modifier_set_has(predicate->modifier_mask_data.any, modifier)) {
+			any_expected = true;
+			any_found |= found;
+		}
+	}
+	return !any_expected || any_found;
+}
+
+// Evaluates the registered definition directly, without folding or compiling it
+static EventPredicateResult
+reference_result(EventPredicateHandle handle, EventNode * event)
+{
+	EventPredicate predicate = event_predicate_get(handle);
+	if (!predicate.enabled) {
+		return EVPREDRES_DISABLED;
+	}
+	const int64_t fields[] = {
+		event->data.code.ns,
+		event->data.code.major,
+		event->data.code.minor,
+		event->data.payload,
+		event->input_index,
+	};
+	bool accepted = false;
+	switch (predicate.type) {
+	case EVPRED_ACCEPT:
+		accepted = true;
+		break;
+	case EVPRED_CODE_NS:
+	case EVPRED_CODE_MAJOR:
+	case EVPRED_CODE_MINOR:
+	case EVPRED_PAYLOAD:
+	case EVPRED_INPUT_INDEX:
+		{
+			int64_t value = fields[predicate.type - EVPRED_CODE_NS];
+			accepted = predicate.range_data.min_value <= value && value <= predicate.range_data.max_value;
+		}
+		break;
+	case EVPRED_CONJUNCTION:
+	case EVPRED_DISJUNCTION:
+		// Disabled arguments are skipped
+		accepted = predicate.type == EVPRED_CONJUNCTION;
+		for (size_t i = 0; i < predicate.aggregate_data.length; ++i) {
+			EventPredicateResult result = reference_result(predicate.aggregate_data.handles[i], event);
+			if (result != EVPREDRES_DISABLED && (result == EVPREDRES_ACCEPTED) != accepted) {
+				accepted = !accepted;
+				break;
+			}
+		}
+		break;
+	case EVPRED_MODIFIER:
+		accepted = modifier_set_has(event->data.modifiers, predicate.single_modifier);
+		break;
+	case EVPRED_MODIFIER_MASK:
+		accepted = modifiers_match(&predicate, event->data.modifiers);
+		break;
+	case EVPRED_CODE_SET:
+	case EVPRED_PAYLOAD_SET:
+		{
+			int64_t value = predicate.type == EVPRED_CODE_SET ? event->data.code.minor : event->data.payload;
+			for (size_t i = 0; i < predicate.set_data.length; ++i) {
+				accepted |= predicate.set_data.values[i] == value;
+			}
+		}
+		break;
+	default:
+		return EVPREDRES_DISABLED;
+	}
+	return accepted != predicate.inverted ? EVPREDRES_ACCEPTED : EVPREDRES_REJECTED;
+}
+
+static void
+check_apply(const char * stage, EventPredicateHandle count, EventNode * events)
+{
+	for (EventPredicateHandle handle = 0; handle < count; ++handle) {
+		for (size_t i = 0; i < EVENT_COUNT; ++i) {
+			EventPredicateResult expected = reference_result(handle, &events[i]), result = event_predicate_apply(handle, &events[i]);
+			if (result != expected) {
+				fprintf(stderr, "%s: predicate %d, event %zu: expected %d, got %d\n", stage, handle, i, expected, result);
+				++errors;
+			}
+		}
+	}
+}
+
+// Runs the batches with each kernel in turn, the lanes past the events must be cleared
+static void
+check_batches(const char * stage, EventPredicateHandle count, EventNode * events)
+{
+	EventNode *pointers[EVENT_COUNT];
+	for (size_t i = 0; i < EVENT_COUNT; ++i) {
+		pointers[i] = &events[i];
+	}
+	const EventPredicateKernel *kernels;
+	size_t kernel_count = event_predicate_supported_kernels(&kernels);
+	EventPredicateRangeMask selected = event_predicate_range_mask;
+	for (size_t k = 0; k < kernel_count; ++k) {
+		event_predicate_range_mask = kernels[k].range_mask;
+		for (EventPredicateHandle handle = 0; handle < count; ++handle) {
+			uint64_t accepted[WORDS];
+			for (size_t word = 0; word < WORDS; ++word) {
+				accepted[word] = UINT64_MAX;
+			}
+			event_predicate_apply_batch(handle, pointers, EVENT_COUNT, accepted);
+			for (size_t i = 0; i < WORDS * EVPRED_BATCH_LANES; ++i) {
+				bool expected = i < EVENT_COUNT && reference_result(handle, &events[i]) == EVPREDRES_ACCEPTED;
+				bool result = accepted[i / EVPRED_BATCH_LANES] >> (i % EVPRED_BATCH_LANES) & 1;
+				if (result != expected) {
+					fprintf(stderr, "%s, %s kernel: predicate %d, lane %zu: expected %d, got %d\n", stage, kernels[k].name, handle, i, expected, result);
+					++errors;
+				}
+			}
+		}
+	}
+	event_predicate_range_mask = selected;
+}
+
+static void
+check_index(const char * stage, const EventPredicateIndex * index, EventPredicateHandle count, EventNode * events)
+{
+	for (size_t i = 0; i < EVENT_COUNT; ++i) {
+		bool candidate[MAX_PREDICATES] = {false};
+		size_t candidate_count;
+		const uint32_t *candidates = event_predicate_index_candidates(index, &events[i], &candidate_count);
+		for (size_t j = 0; j < candidate_count; ++j) {
+			candidate[candidates[j]] = true;
+		}
+		for (EventPredicateHandle handle = 0; handle < count; ++handle) {
+			bool expected = reference_result(handle, &events[i]) == EVPREDRES_ACCEPTED;
+			bool result = candidate[handle] && event_predicate_index_accepts(index, handle, &events[i]);
+			if (result != expected) {
+				fprintf(stderr, "%s, index: predicate %d, event %zu: expected %d, got %d\n", stage, handle, i, expected, result);
+				++errors;
+			}
+		}
+	}
+}
+
+// Checks every path, then again after changing the flags of the mutable predicates
+static void
+check_paths(const char * stage, EventPredicateHandle count, const bool * mutable, const EventPredicateIndex * index, EventNode * events)
+{
+	for (size_t pass = 0; pass < 2; ++pass) {
+		check_apply(stage, count, events);
+		check_batches(stage, count, events);
+		if (index) {
+			check_index(stage, index, count, events);
+		}
+		for (EventPredicateHandle handle = 0; handle < count; ++handle) {
+			if (mutable[handle]) {
+				event_predicate_set_enabled(handle, random_next() % 4 != 0);
+				event_predicate_set_inverted(handle, random_next() % 2);
+			}
+		}
+	}
+}
+
+// Returns false if the compiler is not available
+static bool
+load_native(const char * directory)
+{
+	EventPredicateNativeStatus status = event_predicate_native_load(directory);
+	while (status == EVPRED_NATIVE_BUILDING) {
+		usleep(10000);
+		status = event_predicate_native_poll();
+	}
+	return status == EVPRED_NATIVE_LOADED;
+}
+
+static void
+remove_directory(const char * path)
+{
+	DIR *directory = opendir(path);
+	if (!directory) {
+		return;
+	}
+	struct dirent *entry;
+	while ((entry = readdir(directory))) {
+		if (entry->d_name[0] != '.') {
+			unlinkat(dirfd(directory), entry->d_name, 0);
+		}
+	}
+	closedir(directory);
+	rmdir(path);
+}
+
+static void
+check_round(size_t round, const char * native_directory)
+{
+	event_predicate_reset();
+	bool mutable[MAX_PREDICATES];
+	EventPredicateHandle count = register_predicates(mutable);
+	EventNode events[EVENT_COUNT];
+	uint8_t modifier_bits[EVENT_COUNT][MODIFIER_COUNT / 8];
+	random_events(events, modifier_bits);
+
+	check_paths("tree", count, mutable, NULL, events);
+	event_predicate_fold_constants();
+	EventPredicateHandle handles[MAX_PREDICATES];
+	for (EventPredicateHandle handle = 0; handle < count; ++handle) {
+		handles[handle] = handle;
+	}
+	EventPredicateIndex index;
+	bool indexed = event_predicate_index_build(&index, handles, count);
+	check_paths("folded", count, mutable, indexed ? &index : NULL, events);
+	event_predicate_compile_all();
+	check_paths("compiled", count, mutable, indexed ? &index : NULL, events);
+	if (native_directory && round < NATIVE_ROUNDS) {
+		if (load_native(native_directory)) {
+			check_paths("native", count, mutable, indexed ? &index : NULL, events);
+			event_predicate_native_unload();
+		} else if (round == 0) {
+			fprintf(stderr, "Native predicates not checked, they could not be built\n");
+		}
+	}
+	if (indexed) {
+		event_predicate_index_destroy(&index);
+	}
+}
+
+int
+main()
+{
+	char native_directory[] = "/tmp/predicate_batch-XXXXXX";
+	bool native = mkdtemp(native_directory);
+	for (size_t round = 0; round < ROUNDS; ++round) {
+		check_round(round, native ? native_directory : NULL);
+	}
+	event_predicate_reset();
+	if (native) {
+		remove_directory(native_directory);
+	}
+	if (errors) {
+		fprintf(stderr, "Unexpected predicate results\n");
+		return 1;
+	}
+	return 0;
+}
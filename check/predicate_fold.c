@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include "../event_predicate.h"
+
+static size_t errors = 0;
+
+static EventPredicateHandle
+register_range(EventPredicateType type, int64_t min_value, int64_t max_value)
+{
+	return event_predicate_register((EventPredicate) {
+		.type = type,
+		.enabled = true,
+		.inverted = false,
+		.range_data = {
+			.min_value = min_value,
+			.max_value = max_value,
+		},
+	});
+}
+
+static EventPredicateHandle
+register_aggregate(EventPredicateType type, EventPredicateHandle lhs, EventPredicateHandle rhs)
+{
+	EventPredicateHandle *handles = T_ALLOC(2, EventPredicateHandle);
+	if (!handles) {
+		return -1;
+	}
+	handles[0] = lhs;
+	handles[1] = rhs;
+	return event_predicate_register((EventPredicate) {
+		.type = type,
+		.enabled = true,
+		.inverted = false,
+		.aggregate_data = {
+			.length = 2,
+			.handles = handles,
+		},
+	});
+}
+
+static void
+expect(const char * description, EventPredicateHandle handle, EventNode * event, EventPredicateResult expected)
+{
+	EventPredicateResult result = event_predicate_apply(handle, event);
+	if (result != expected) {
+		fprintf(stderr, "%s: expected %d, got %d\n", description, expected, result);
+		++errors;
+	}
+}
+
+// Aggregates with the same definition must not be merged if they contain distinct mutable predicates
+static void
+check_mutable_descendants(bool compiled)
+{
+	event_predicate_reset();
+	EventPredicateHandle mutable_lhs = register_range(EVPRED_CODE_MINOR, 6, 6);
+	EventPredicateHandle mutable_rhs = register_range(EVPRED_CODE_MINOR, 6, 6);
+	EventPredicateHandle payload = register_range(EVPRED_PAYLOAD, 1, 1);
+	EventPredicateHandle disjunction = register_aggregate(EVPRED_DISJUNCTION, register_aggregate(EVPRED_CONJUNCTION, mutable_lhs, payload), register_aggregate(EVPRED_CONJUNCTION, mutable_rhs, payload));
+	event_predicate_mark_mutable(mutable_lhs);
+	event_predicate_mark_mutable(mutable_rhs);
+	event_predicate_fold_constants();
+	if (compiled) {
+		event_predicate_compile_all();
+	}
+
+	EventNode event = {
+		.data = {
+			.code = {.ns = 0, .major = 0, .minor = 5},
+			.payload = 1,
+			.modifiers = EMPTY_MODIFIER_SET,
+		},
+	};
+	const char *description = compiled ? "compiled" : "folded";
+	expect(description, disjunction, &event, EVPREDRES_REJECTED);
+	event_predicate_set_inverted(mutable_rhs, true);
+	expect(description, disjunction, &event, EVPREDRES_ACCEPTED);
+	event_predicate_set_inverted(mutable_rhs, false);
+	event_predicate_set_inverted(mutable_lhs, true);
+	expect(description, disjunction, &event, EVPREDRES_ACCEPTED);
+}
+
+int
+main()
+{
+	check_mutable_descendants(false);
+	check_mutable_descendants(true);
+	event_predicate_reset();
+	if (errors) {
+		fprintf(stderr, "Unexpected predicate results\n");
+		return 1;
+	}
+	return 0;
+}
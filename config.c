@@ -1,3 +1,5 @@
+#include <errno.h>
+#include <stdio.h>
 #include <string.h>
 #include "config.h"
 #include "event_code_names.h"
@@ -73,6 +75,8 @@ load_single_channel_config(const config_setting_t *config_member, const Constant
 	GraphChannelConfig result = {
 		.from = {NULL, 0},
 		.to = {NULL, 0},
+		.capacity = 0,
+		.overflow = CHANNEL_OVERFLOW_DROP_NEWEST,
 	};
 	if (!config_member) {
 		return result;
@@ -96,6 +100,19 @@ load_single_channel_config(const config_setting_t *config_member, const Constant
 	}
 	load_channel_end_config(ends[0], &result.from.name, &result.from.index, constants);
 	load_channel_end_config(ends[1], &result.to.name, &result.to.index, constants);
+	long long capacity = resolve_constant(constants, config_setting_get_member(config_member, "capacity"));
+	if (capacity > 0) {
+		result.capacity = capacity;
+	}
+	const char *overflow_name = NULL;
+	if (config_setting_lookup_string(config_member, "overflow", &overflow_name) == CONFIG_TRUE) {
+		GraphChannelOverflowPolicy overflow = parse_channel_overflow_policy(overflow_name);
+		if (overflow != CHANNEL_OVERFLOW_INVALID) {
+			result.overflow = overflow;
+		} else {
+			fprintf(stderr, "Unknown channel overflow policy \"%s\"\n", overflow_name);
+		}
+	}
 	return result;
 }
 
@@ -285,9 +302,35 @@ parse_event_predicate_type(const char *name)
 	if (strcmp(name, "modifier") == 0) {
 		return EVPRED_MODIFIER;
 	}
+	if (strcmp(name, "modifier_mask") == 0) {
+		return EVPRED_MODIFIER_MASK;
+	}
+	if (strcmp(name, "code_set") == 0) {
+		return EVPRED_CODE_SET;
+	}
+	if (strcmp(name, "payload_set") == 0) {
+		return EVPRED_PAYLOAD_SET;
+	}
 	return EVPRED_INVALID;
 }
 
+// Returns false if a modifier is out of range
+static bool
+load_modifier_set(const config_setting_t * setting, const ConstantRegistry * constants, ModifierSet * result)
+{
+	*result = EMPTY_MODIFIER_SET;
+	ssize_t length = setting ? config_setting_length(setting) : 0;
+	for (ssize_t i = 0; i < length; ++i) {
+		long long modifier = resolve_constant_or(constants, config_setting_get_elem(setting, i), -1);
+		if (modifier < 0 || modifier > MODIFIER_MAX) {
+			modifier_set_destruct(result);
+			return false;
+		}
+		modifier_set_set(result, modifier);
+	}
+	return true;
+}
+
 static EventPredicateHandle
 load_single_predicate(const config_setting_t * setting, EventPredicateHandleRegistry * registry, const ConstantRegistry * constants)
 {
@@ -327,7 +370,13 @@ load_single_predicate(const config_setting_t * setting, EventPredicateHandleRegi
 			if (length > 0) {
 				handles = T_ALLOC(length, EventPredicateHandle);
 				for (ssize_t i = 0; i < length; ++i) {
+					errno = 0;
 					handles[i] = resolve_event_predicate(registry, constants, config_setting_get_elem(args, i));
+					// Rejected as too deep, so is every predicate containing it
+					if (handles[i] < 0 && errno == ELOOP) {
+						free(handles);
+						return -1;
+					}
 				}
 			}
 			predicate.aggregate_data.length = length;
@@ -343,6 +392,41 @@ load_single_predicate(const config_setting_t * setting, EventPredicateHandleRegi
 			predicate.single_modifier = modifier;
 		}
 		break;
+	case EVPRED_MODIFIER_MASK:
+		{
+			ModifierSet *required = &predicate.modifier_mask_data.required;
+			ModifierSet *forbidden = &predicate.modifier_mask_data.forbidden;
+			ModifierSet *any = &predicate.modifier_mask_data.any;
+			*forbidden = *any = EMPTY_MODIFIER_SET;
+			if (!load_modifier_set(config_setting_get_member(setting, "required"), constants, required)
+				|| !load_modifier_set(config_setting_get_member(setting, "forbidden"), constants, forbidden)
+				|| !load_modifier_set(config_setting_get_member(setting, "any"), constants, any)) {
+				modifier_set_destruct(required);
+				modifier_set_destruct(forbidden);
+				modifier_set_destruct(any);
+				return -1;
+			}
+		}
+		break;
+	case EVPRED_CODE_SET:
+	case EVPRED_PAYLOAD_SET:
+		{
+			config_setting_t *values_setting = config_setting_get_member(setting, "values");
+			int64_t *values = NULL;
+			ssize_t length = values_setting ? config_setting_length(values_setting) : 0;
+			if (length > 0) {
+				values = T_ALLOC(length, int64_t);
+				if (!values) {
+					return -1;
+				}
+				for (ssize_t i = 0; i < length; ++i) {
+					values[i] = resolve_constant(constants, config_setting_get_elem(values_setting, i));
+				}
+			}
+			predicate.set_data.length = length > 0 ? length : 0;
+			predicate.set_data.values = values;
+		}
+		break;
 	default:
 		return -1;
 	}
@@ -353,12 +437,25 @@ load_single_predicate(const config_setting_t * setting, EventPredicateHandleRegi
 	predicate.inverted = inverted != 0;
 
 	EventPredicateHandle handle = event_predicate_register(predicate);
+	if (handle < 0 && errno == ELOOP) {
+		fprintf(stderr, "Predicate nested deeper than %d levels at line %u\n", EVPRED_MAX_DEPTH, config_setting_source_line(setting));
+	}
 	if (handle < 0) {
 		if ((predicate.type == EVPRED_CONJUNCTION || predicate.type == EVPRED_DISJUNCTION) && predicate.aggregate_data.handles) {
 			free(predicate.aggregate_data.handles);
 			predicate.aggregate_data.handles = NULL;
 			predicate.aggregate_data.length = 0;
 		}
+		if (predicate.type == EVPRED_MODIFIER_MASK) {
+			modifier_set_destruct(&predicate.modifier_mask_data.required);
+			modifier_set_destruct(&predicate.modifier_mask_data.forbidden);
+			modifier_set_destruct(&predicate.modifier_mask_data.any);
+		}
+		if ((predicate.type == EVPRED_CODE_SET || predicate.type == EVPRED_PAYLOAD_SET) && predicate.set_data.values) {
+			free(predicate.set_data.values);
+			predicate.set_data.values = NULL;
+			predicate.set_data.length = 0;
+		}
 	}
 
 	return handle;
@@ -387,6 +484,49 @@ load_predicates_section(const config_setting_t *config_section, EventPredicateHa
 	}
 }
 
+GraphChannelOverflowPolicy
+parse_channel_overflow_policy(const char *name)
+{
+	if (!name) {
+		return CHANNEL_OVERFLOW_INVALID;
+	}
+	if (strcmp(name, "drop_newest") == 0) {
+		return CHANNEL_OVERFLOW_DROP_NEWEST;
+	}
+	if (strcmp(name, "drop_oldest") == 0) {
+		return CHANNEL_OVERFLOW_DROP_OLDEST;
+	}
+	if (strcmp(name, "coalesce") == 0) {
+		return CHANNEL_OVERFLOW_COALESCE;
+	}
+	if (strcmp(name, "block") == 0) {
+		return CHANNEL_OVERFLOW_BLOCK;
+	}
+	return CHANNEL_OVERFLOW_INVALID;
+}
+
+static size_t
+section_length(const config_setting_t *config_section)
+{
+	if (!config_section) {
+		return 0;
+	}
+	int length = config_setting_length(config_section);
+	return length > 0 ? length : 0;
+}
+
+// Upper bound of the entries the sections add to the ConstantRegistry
+static size_t
+count_constants(const config_setting_t *constants_section, const config_setting_t *enums_section)
+{
+	size_t count = section_length(constants_section);
+	size_t enum_count = section_length(enums_section);
+	for (size_t i = 0; i < enum_count; ++i) {
+		count += section_length(config_setting_get_elem(enums_section, i));
+	}
+	return count;
+}
+
 bool
 load_config(const config_setting_t *config_root, FullConfig *config)
 {
@@ -399,12 +539,11 @@ load_config(const config_setting_t *config_root, FullConfig *config)
 	const config_setting_t *enums_config = config_setting_get_member(config_root, "enums");
 	const config_setting_t *predicates_config = config_setting_get_member(config_root, "predicates");
 	hash_table_init(&config->constants, NULL);
-	hash_table_insert(&config->constants, hash_table_key_from_cstr("false"), (long long[1]) {0});
-	hash_table_insert(&config->constants, hash_table_key_from_cstr("true"), (long long[1]) {1});
-	populate_event_codes(&config->constants);
+	hash_table_reserve(&config->constants, count_constants(constants_config, enums_config));
 	load_constants_section(constants_config, &config->constants);
 	load_enums_section(enums_config, &config->constants);
 	hash_table_init(&config->predicates, NULL);
+	hash_table_reserve(&config->predicates, section_length(predicates_config));
 	load_predicates_section(predicates_config, &config->predicates, &config->constants);
 	config->nodes = load_nodes_section(node_config);
 	config->channels = load_channels_section(channel_config, &config->constants);
@@ -431,6 +570,18 @@ reset_config(FullConfig *config)
 	hash_table_deinit(&config->predicates);
 }
 
+// Constants of the config shadow the builtin ones
+static bool
+lookup_constant(const ConstantRegistry * registry, const HashTableKey key, long long * value)
+{
+	HashTableIndex idx = hash_table_find(registry, key);
+	if (idx >= 0) {
+		*value = registry->value_array[idx];
+		return true;
+	}
+	return builtin_constant_lookup(key, value);
+}
+
 long long
 resolve_constant_or(const ConstantRegistry * registry, const config_setting_t * setting, long long dflt)
 {
@@ -442,11 +593,9 @@ resolve_constant_or(const ConstantRegistry * registry, const config_setting_t *
 			return dflt;
 		}
 		const char *name = config_setting_get_string(setting);
-		HashTableIndex idx = hash_table_find(registry, hash_table_key_from_cstr(name));
-		if (idx < 0) {
-			return dflt;
-		}
-		return registry->value_array[idx];
+		long long value = dflt;
+		lookup_constant(registry, hash_table_key_from_cstr(name), &value);
+		return value;
 	}
 	if (config_setting_is_number(setting)) {
 		return config_setting_get_int64(setting);
@@ -474,6 +623,93 @@ resolve_event_predicate(EventPredicateHandleRegistry * registry, const ConstantR
 	return load_single_predicate(setting, registry, constants);
 }
 
+static bool
+config_name_equivalent(InitializationEnvironment * lhs_env, InitializationEnvironment * rhs_env, const char * name)
+{
+	HashTableKey key = hash_table_key_from_cstr(name);
+
+	long long lhs_value, rhs_value;
+	bool lhs_found = lookup_constant(&lhs_env->constants, key, &lhs_value);
+	bool rhs_found = lookup_constant(&rhs_env->constants, key, &rhs_value);
+	if (lhs_found != rhs_found) {
+		return false;
+	}
+	if (lhs_found && lhs_value != rhs_value) {
+		return false;
+	}
+
+	HashTableIndex lhs_idx = hash_table_find(&lhs_env->predicates, key);
+	HashTableIndex rhs_idx = hash_table_find(&rhs_env->predicates, key);
+	if ((lhs_idx < 0) != (rhs_idx < 0)) {
+		return false;
+	}
+	if (lhs_idx >= 0 && !event_predicate_equivalent(lhs_env->predicates.value_array[lhs_idx], rhs_env->predicates.value_array[rhs_idx], true)) {
+		return false;
+	}
+
+	return true;
+}
+
+bool
+config_setting_equivalent(InitializationEnvironment * lhs_env, const config_setting_t * lhs, InitializationEnvironment * rhs_env, const config_setting_t * rhs)
+{
+	if (!lhs || !rhs) {
+		return lhs == rhs;
+	}
+	if (config_setting_is_number(lhs) && config_setting_is_number(rhs)) {
+		if (config_setting_type(lhs) == CONFIG_TYPE_FLOAT || config_setting_type(rhs) == CONFIG_TYPE_FLOAT) {
+			return config_setting_get_float(lhs) == config_setting_get_float(rhs);
+		}
+		return config_setting_get_int64(lhs) == config_setting_get_int64(rhs);
+	}
+	int type = config_setting_type(lhs);
+	if (type != config_setting_type(rhs)) {
+		return false;
+	}
+	switch (type) {
+	case CONFIG_TYPE_BOOL:
+		return config_setting_get_bool(lhs) == config_setting_get_bool(rhs);
+	case CONFIG_TYPE_STRING:
+		{
+			const char *lhs_str = config_setting_get_string(lhs);
+			const char *rhs_str = config_setting_get_string(rhs);
+			if (!lhs_str || !rhs_str) {
+				return lhs_str == rhs_str;
+			}
+			if (strcmp(lhs_str, rhs_str) != 0) {
+				return false;
+			}
+			return config_name_equivalent(lhs_env, rhs_env, lhs_str);
+		}
+	case CONFIG_TYPE_GROUP:
+	case CONFIG_TYPE_LIST:
+	case CONFIG_TYPE_ARRAY:
+		{
+			ssize_t length = config_setting_length(lhs);
+			if (length != config_setting_length(rhs)) {
+				return false;
+			}
+			for (ssize_t i = 0; i < length; ++i) {
+				const config_setting_t *lhs_elem = config_setting_get_elem(lhs, i);
+				const config_setting_t *rhs_elem = config_setting_get_elem(rhs, i);
+				if (type == CONFIG_TYPE_GROUP) {
+					const char *lhs_name = config_setting_name(lhs_elem);
+					const char *rhs_name = config_setting_name(rhs_elem);
+					if (!lhs_name || !rhs_name || strcmp(lhs_name, rhs_name) != 0) {
+						return false;
+					}
+				}
+				if (!config_setting_equivalent(lhs_env, lhs_elem, rhs_env, rhs_elem)) {
+					return false;
+				}
+			}
+			return true;
+		}
+	default:
+		return false;
+	}
+}
+
 long long
 env_resolve_constant_or(InitializationEnvironment * env, const config_setting_t * setting, long long dflt)
 {
@@ -17,11 +17,21 @@ typedef struct {
 	GraphNodeConfig *items;
 } GraphNodeConfigSection;
 
+typedef enum {
+	CHANNEL_OVERFLOW_INVALID = -1,
+	CHANNEL_OVERFLOW_DROP_NEWEST,
+	CHANNEL_OVERFLOW_DROP_OLDEST,
+	CHANNEL_OVERFLOW_COALESCE,
+	CHANNEL_OVERFLOW_BLOCK,
+} GraphChannelOverflowPolicy;
+
 typedef struct {
 	struct {
 		const char *name;
 		size_t index;
 	} from, to;
+	size_t capacity;  // 0 if unbounded
+	GraphChannelOverflowPolicy overflow;
 } GraphChannelConfig;
 
 typedef struct {
@@ -49,9 +59,12 @@ typedef struct {
 } FullConfig;
 
 bool load_config(const config_setting_t *config_root, FullConfig *config);
+GraphChannelOverflowPolicy parse_channel_overflow_policy(const char *name);
 void reset_config(FullConfig *config);
 long long resolve_constant_or(const ConstantRegistry * registry, const config_setting_t * setting, long long dflt);
 EventPredicateHandle resolve_event_predicate(EventPredicateHandleRegistry * registry, const ConstantRegistry * constants, const config_setting_t * setting);
+// Whether two settings would configure a node identically, names are resolved in the corresponding environments
+bool config_setting_equivalent(InitializationEnvironment * lhs_env, const config_setting_t * lhs, InitializationEnvironment * rhs_env, const config_setting_t * rhs);
 
 // These are not inline to make non-breaking ABI changes
 long long env_resolve_constant_or(InitializationEnvironment * env, const config_setting_t * setting, long long dflt);
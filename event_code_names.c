@@ -1,20 +1,23 @@
-#include <linux/input.h>
-#include <linux/input-event-codes.h>
 #include "event_code_names.h"
+#include "event_code_table.h"
 
-void
-populate_event_codes(ConstantRegistry * registry)
+bool
+builtin_constant_lookup(const HashTableKey key, long long * value)
 {
-	if (!registry) {
-		return;
+	if (!key.bytes) {
+		return false;
 	}
-
-#define DECLARE_EVENT_CODE(enum_name, prefix_name, unqualified_name) { \
-	const long long value = prefix_name##_##unqualified_name; \
-	hash_table_insert(registry, hash_table_key_from_cstr(#prefix_name "_" #unqualified_name), &value); \
-	hash_table_insert(registry, hash_table_key_from_cstr(#enum_name "." #unqualified_name), &value); \
-}
-
-#include "event_code_names.cc"
-
+	uint64_t hash = builtin_constant_mix(key.pre_hash, BUILTIN_CONSTANT_SEED);
+	uint16_t displacement = builtin_constant_displacements[builtin_constant_bucket(hash, BUILTIN_CONSTANT_BUCKET_COUNT)];
+	const BuiltinConstant *entry = &builtin_constants[builtin_constant_slot(hash, displacement, BUILTIN_CONSTANT_SLOT_MASK)];
+	if (entry->pre_hash != key.pre_hash || entry->name_length != key.length || !entry->name_length) {
+		return false;
+	}
+	if (memcmp(builtin_constant_names + entry->name_offset, key.bytes, key.length) != 0) {
+		return false;
+	}
+	if (value) {
+		*value = entry->value;
+	}
+	return true;
 }
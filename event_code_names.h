@@ -3,6 +3,35 @@
 
 #include "config.h"
 
-void populate_event_codes(ConstantRegistry * registry);
+// Entry of the builtin constant table generated by event_code_table_gen, empty slots have a zero name_length
+typedef struct {
+	uint64_t pre_hash;
+	uint32_t name_offset;
+	uint32_t name_length;
+	long long value;
+} BuiltinConstant;
+
+// Finds true, false and the event codes of event_code_names.cc in a perfect hash table built at compile time
+bool builtin_constant_lookup(const HashTableKey key, long long * value);
+
+// The generated table hashes the mixed pre-hash into a bucket, the displacement of the bucket selects the slot
+__attribute__((unused)) inline static uint64_t
+builtin_constant_mix(uint64_t pre_hash, uint64_t seed)
+{
+	uint64_t hash = (pre_hash ^ seed) * 0x9E3779B97F4A7C15;
+	return hash ^ (hash >> 29);
+}
+
+__attribute__((unused)) inline static size_t
+builtin_constant_bucket(uint64_t hash, size_t bucket_count)
+{
+	return (hash >> 32) * bucket_count >> 32;
+}
+
+__attribute__((unused)) inline static size_t
+builtin_constant_slot(uint64_t hash, uint16_t displacement, size_t slot_mask)
+{
+	return (hash + displacement * ((hash >> 16) | 1)) & slot_mask;
+}
 
 #endif /* end of include guard: EVENT_CODE_NAMES_H_ */
@@ -0,0 +1,3682 @@
+// Generated by event_code_table_gen from event_code_names.cc
+
+#define BUILTIN_CONSTANT_SEED 0x5AA503CA952FCFCB
+#define BUILTIN_CONSTANT_SLOT_MASK 2047
+#define BUILTIN_CONSTANT_BUCKET_COUNT 399
+
+static const char builtin_constant_names[] =
+	"false\0"
+	"true\0"
+	"INPUT_PROP_POINTER\0"
+	"input_property.POINTER\0"
+	"INPUT_PROP_DIRECT\0"
+	"input_property.DIRECT\0"
+	"INPUT_PROP_BUTTONPAD\0"
+	"input_property.BUTTONPAD\0"
+	"INPUT_PROP_SEMI_MT\0"
+	"input_property.SEMI_MT\0"
+	"INPUT_PROP_TOPBUTTONPAD\0"
+	"input_property.TOPBUTTONPAD\0"
+	"INPUT_PROP_POINTING_STICK\0"
+	"input_property.POINTING_STICK\0"
+	"INPUT_PROP_ACCELEROMETER\0"
+	"input_property.ACCELEROMETER\0"
+	"INPUT_PROP_MAX\0"
+	"input_property.MAX\0"
+	"INPUT_PROP_CNT\0"
+	"input_property.CNT\0"
+	"EV_SYN\0"
+	"event_type.SYN\0"
+	"EV_KEY\0"
+	"event_type.KEY\0"
+	"EV_REL\0"
+	"event_type.REL\0"
+	"EV_ABS\0"
+	"event_type.ABS\0"
+	"EV_MSC\0"
+	"event_type.MSC\0"
+	"EV_SW\0"
+	"event_type.SW\0"
+	"EV_LED\0"
+	"event_type.LED\0"
+	"EV_SND\0"
+	"event_type.SND\0"
+	"EV_REP\0"
+	"event_type.REP\0"
+	"EV_FF\0"
+	"event_type.FF\0"
+	"EV_PWR\0"
+	"event_type.PWR\0"
+	"EV_FF_STATUS\0"
+	"event_type.FF_STATUS\0"
+	"EV_MAX\0"
+	"event_type.MAX\0"
+	"EV_CNT\0"
+	"event_type.CNT\0"
+	"SYN_REPORT\0"
+	"synchronization_event.REPORT\0"
+	"SYN_CONFIG\0"
+	"synchronization_event.CONFIG\0"
+	"SYN_MT_REPORT\0"
+	"synchronization_event.MT_REPORT\0"
+	"SYN_DROPPED\0"
+	"synchronization_event.DROPPED\0"
+	"SYN_MAX\0"
+	"synchronization_event.MAX\0"
+	"SYN_CNT\0"
+	"synchronization_event.CNT\0"
+	"KEY_RESERVED\0"
+	"key_event.RESERVED\0"
+	"KEY_ESC\0"
+	"key_event.ESC\0"
+	"KEY_1\0"
+	"key_event.1\0"
+	"KEY_2\0"
+	"key_event.2\0"
+	"KEY_3\0"
+	"key_event.3\0"
+	"KEY_4\0"
+	"key_event.4\0"
+	"KEY_5\0"
+	"key_event.5\0"
+	"KEY_6\0"
+	"key_event.6\0"
+	"KEY_7\0"
+	"key_event.7\0"
+	"KEY_8\0"
+	"key_event.8\0"
+	"KEY_9\0"
+	"key_event.9\0"
+	"KEY_0\0"
+	"key_event.0\0"
+	"KEY_MINUS\0"
+	"key_event.MINUS\0"
+	"KEY_EQUAL\0"
+	"key_event.EQUAL\0"
+	"KEY_BACKSPACE\0"
+	"key_event.BACKSPACE\0"
+	"KEY_TAB\0"
+	"key_event.TAB\0"
+	"KEY_Q\0"
+	"key_event.Q\0"
+	"KEY_W\0"
+	"key_event.W\0"
+	"KEY_E\0"
+	"key_event.E\0"
+	"KEY_R\0"
+	"key_event.R\0"
+	"KEY_T\0"
+	"key_event.T\0"
+	"KEY_Y\0"
+	"key_event.Y\0"
+	"KEY_U\0"
+	"key_event.U\0"
+	"KEY_I\0"
+	"key_event.I\0"
+	"KEY_O\0"
+	"key_event.O\0"
+	"KEY_P\0"
+	"key_event.P\0"
+	"KEY_LEFTBRACE\0"
+	"key_event.LEFTBRACE\0"
+	"KEY_RIGHTBRACE\0"
+	"key_event.RIGHTBRACE\0"
+	"KEY_ENTER\0"
+	"key_event.ENTER\0"
+	"KEY_LEFTCTRL\0"
+	"key_event.LEFTCTRL\0"
+	"KEY_A\0"
+	"key_event.A\0"
+	"KEY_S\0"
+	"key_event.S\0"
+	"KEY_D\0"
+	"key_event.D\0"
+	"KEY_F\0"
+	"key_event.F\0"
+	"KEY_G\0"
+	"key_event.G\0"
+	"KEY_H\0"
+	"key_event.H\0"
+	"KEY_J\0"
+	"key_event.J\0"
+	"KEY_K\0"
+	"key_event.K\0"
+	"KEY_L\0"
+	"key_event.L\0"
+	"KEY_SEMICOLON\0"
+	"key_event.SEMICOLON\0"
+	"KEY_APOSTROPHE\0"
+	"key_event.APOSTROPHE\0"
+	"KEY_GRAVE\0"
+	"key_event.GRAVE\0"
+	"KEY_LEFTSHIFT\0"
+	"key_event.LEFTSHIFT\0"
+	"KEY_BACKSLASH\0"
+	"key_event.BACKSLASH\0"
+	"KEY_Z\0"
+	"key_event.Z\0"
+	"KEY_X\0"
+	"key_event.X\0"
+	"KEY_C\0"
+	"key_event.C\0"
+	"KEY_V\0"
+	"key_event.V\0"
+	"KEY_B\0"
+	"key_event.B\0"
+	"KEY_N\0"
+	"key_event.N\0"
+	"KEY_M\0"
+	"key_event.M\0"
+	"KEY_COMMA\0"
+	"key_event.COMMA\0"
+	"KEY_DOT\0"
+	"key_event.DOT\0"
+	"KEY_SLASH\0"
+	"key_event.SLASH\0"
+	"KEY_RIGHTSHIFT\0"
+	"key_event.RIGHTSHIFT\0"
+	"KEY_KPASTERISK\0"
+	"key_event.KPASTERISK\0"
+	"KEY_LEFTALT\0"
+	"key_event.LEFTALT\0"
+	"KEY_SPACE\0"
+	"key_event.SPACE\0"
+	"KEY_CAPSLOCK\0"
+	"key_event.CAPSLOCK\0"
+	"KEY_F1\0"
+	"key_event.F1\0"
+	"KEY_F2\0"
+	"key_event.F2\0"
+	"KEY_F3\0"
+	"key_event.F3\0"
+	"KEY_F4\0"
+	"key_event.F4\0"
+	"KEY_F5\0"
+	"key_event.F5\0"
+	"KEY_F6\0"
+	"key_event.F6\0"
+	"KEY_F7\0"
+	"key_event.F7\0"
+	"KEY_F8\0"
+	"key_event.F8\0"
+	"KEY_F9\0"
+	"key_event.F9\0"
+	"KEY_F10\0"
+	"key_event.F10\0"
+	"KEY_NUMLOCK\0"
+	"key_event.NUMLOCK\0"
+	"KEY_SCROLLLOCK\0"
+	"key_event.SCROLLLOCK\0"
+	"KEY_KP7\0"
+	"key_event.KP7\0"
+	"KEY_KP8\0"
+	"key_event.KP8\0"
+	"KEY_KP9\0"
+	"key_event.KP9\0"
+	"KEY_KPMINUS\0"
+	"key_event.KPMINUS\0"
+	"KEY_KP4\0"
+	"key_event.KP4\0"
+	"KEY_KP5\0"
+	"key_event.KP5\0"
+	"KEY_KP6\0"
+	"key_event.KP6\0"
+	"KEY_KPPLUS\0"
+	"key_event.KPPLUS\0"
+	"KEY_KP1\0"
+	"key_event.KP1\0"
+	"KEY_KP2\0"
+	"key_event.KP2\0"
+	"KEY_KP3\0"
+	"key_event.KP3\0"
+	"KEY_KP0\0"
+	"key_event.KP0\0"
+	"KEY_KPDOT\0"
+	"key_event.KPDOT\0"
+	"KEY_ZENKAKUHANKAKU\0"
+	"key_event.ZENKAKUHANKAKU\0"
+	"KEY_102ND\0"
+	"key_event.102ND\0"
+	"KEY_F11\0"
+	"key_event.F11\0"
+	"KEY_F12\0"
+	"key_event.F12\0"
+	"KEY_RO\0"
+	"key_event.RO\0"
+	"KEY_KATAKANA\0"
+	"key_event.KATAKANA\0"
+	"KEY_HIRAGANA\0"
+	"key_event.HIRAGANA\0"
+	"KEY_HENKAN\0"
+	"key_event.HENKAN\0"
+	"KEY_KATAKANAHIRAGANA\0"
+	"key_event.KATAKANAHIRAGANA\0"
+	"KEY_MUHENKAN\0"
+	"key_event.MUHENKAN\0"
+	"KEY_KPJPCOMMA\0"
+	"key_event.KPJPCOMMA\0"
+	"KEY_KPENTER\0"
+	"key_event.KPENTER\0"
+	"KEY_RIGHTCTRL\0"
+	"key_event.RIGHTCTRL\0"
+	"KEY_KPSLASH\0"
+	"key_event.KPSLASH\0"
+	"KEY_SYSRQ\0"
+	"key_event.SYSRQ\0"
+	"KEY_RIGHTALT\0"
+	"key_event.RIGHTALT\0"
+	"KEY_LINEFEED\0"
+	"key_event.LINEFEED\0"
+	"KEY_HOME\0"
+	"key_event.HOME\0"
+	"KEY_UP\0"
+	"key_event.UP\0"
+	"KEY_PAGEUP\0"
+	"key_event.PAGEUP\0"
+	"KEY_LEFT\0"
+	"key_event.LEFT\0"
+	"KEY_RIGHT\0"
+	"key_event.RIGHT\0"
+	"KEY_END\0"
+	"key_event.END\0"
+	"KEY_DOWN\0"
+	"key_event.DOWN\0"
+	"KEY_PAGEDOWN\0"
+	"key_event.PAGEDOWN\0"
+	"KEY_INSERT\0"
+	"key_event.INSERT\0"
+	"KEY_DELETE\0"
+	"key_event.DELETE\0"
+	"KEY_MACRO\0"
+	"key_event.MACRO\0"
+	"KEY_MUTE\0"
+	"key_event.MUTE\0"
+	"KEY_VOLUMEDOWN\0"
+	"key_event.VOLUMEDOWN\0"
+	"KEY_VOLUMEUP\0"
+	"key_event.VOLUMEUP\0"
+	"KEY_POWER\0"
+	"key_event.POWER\0"
+	"KEY_KPEQUAL\0"
+	"key_event.KPEQUAL\0"
+	"KEY_KPPLUSMINUS\0"
+	"key_event.KPPLUSMINUS\0"
+	"KEY_PAUSE\0"
+	"key_event.PAUSE\0"
+	"KEY_SCALE\0"
+	"key_event.SCALE\0"
+	"KEY_KPCOMMA\0"
+	"key_event.KPCOMMA\0"
+	"KEY_HANGEUL\0"
+	"key_event.HANGEUL\0"
+	"KEY_HANGUEL\0"
+	"key_event.HANGUEL\0"
+	"KEY_HANJA\0"
+	"key_event.HANJA\0"
+	"KEY_YEN\0"
+	"key_event.YEN\0"
+	"KEY_LEFTMETA\0"
+	"key_event.LEFTMETA\0"
+	"KEY_RIGHTMETA\0"
+	"key_event.RIGHTMETA\0"
+	"KEY_COMPOSE\0"
+	"key_event.COMPOSE\0"
+	"KEY_STOP\0"
+	"key_event.STOP\0"
+	"KEY_AGAIN\0"
+	"key_event.AGAIN\0"
+	"KEY_PROPS\0"
+	"key_event.PROPS\0"
+	"KEY_UNDO\0"
+	"key_event.UNDO\0"
+	"KEY_FRONT\0"
+	"key_event.FRONT\0"
+	"KEY_COPY\0"
+	"key_event.COPY\0"
+	"KEY_OPEN\0"
+	"key_event.OPEN\0"
+	"KEY_PASTE\0"
+	"key_event.PASTE\0"
+	"KEY_FIND\0"
+	"key_event.FIND\0"
+	"KEY_CUT\0"
+	"key_event.CUT\0"
+	"KEY_HELP\0"
+	"key_event.HELP\0"
+	"KEY_MENU\0"
+	"key_event.MENU\0"
+	"KEY_CALC\0"
+	"key_event.CALC\0"
+	"KEY_SETUP\0"
+	"key_event.SETUP\0"
+	"KEY_SLEEP\0"
+	"key_event.SLEEP\0"
+	"KEY_WAKEUP\0"
+	"key_event.WAKEUP\0"
+	"KEY_FILE\0"
+	"key_event.FILE\0"
+	"KEY_SENDFILE\0"
+	"key_event.SENDFILE\0"
+	"KEY_DELETEFILE\0"
+	"key_event.DELETEFILE\0"
+	"KEY_XFER\0"
+	"key_event.XFER\0"
+	"KEY_PROG1\0"
+	"key_event.PROG1\0"
+	"KEY_PROG2\0"
+	"key_event.PROG2\0"
+	"KEY_WWW\0"
+	"key_event.WWW\0"
+	"KEY_MSDOS\0"
+	"key_event.MSDOS\0"
+	"KEY_COFFEE\0"
+	"key_event.COFFEE\0"
+	"KEY_SCREENLOCK\0"
+	"key_event.SCREENLOCK\0"
+	"KEY_ROTATE_DISPLAY\0"
+	"key_event.ROTATE_DISPLAY\0"
+	"KEY_DIRECTION\0"
+	"key_event.DIRECTION\0"
+	"KEY_CYCLEWINDOWS\0"
+	"key_event.CYCLEWINDOWS\0"
+	"KEY_MAIL\0"
+	"key_event.MAIL\0"
+	"KEY_BOOKMARKS\0"
+	"key_event.BOOKMARKS\0"
+	"KEY_COMPUTER\0"
+	"key_event.COMPUTER\0"
+	"KEY_BACK\0"
+	"key_event.BACK\0"
+	"KEY_FORWARD\0"
+	"key_event.FORWARD\0"
+	"KEY_CLOSECD\0"
+	"key_event.CLOSECD\0"
+	"KEY_EJECTCD\0"
+	"key_event.EJECTCD\0"
+	"KEY_EJECTCLOSECD\0"
+	"key_event.EJECTCLOSECD\0"
+	"KEY_NEXTSONG\0"
+	"key_event.NEXTSONG\0"
+	"KEY_PLAYPAUSE\0"
+	"key_event.PLAYPAUSE\0"
+	"KEY_PREVIOUSSONG\0"
+	"key_event.PREVIOUSSONG\0"
+	"KEY_STOPCD\0"
+	"key_event.STOPCD\0"
+	"KEY_RECORD\0"
+	"key_event.RECORD\0"
+	"KEY_REWIND\0"
+	"key_event.REWIND\0"
+	"KEY_PHONE\0"
+	"key_event.PHONE\0"
+	"KEY_ISO\0"
+	"key_event.ISO\0"
+	"KEY_CONFIG\0"
+	"key_event.CONFIG\0"
+	"KEY_HOMEPAGE\0"
+	"key_event.HOMEPAGE\0"
+	"KEY_REFRESH\0"
+	"key_event.REFRESH\0"
+	"KEY_EXIT\0"
+	"key_event.EXIT\0"
+	"KEY_MOVE\0"
+	"key_event.MOVE\0"
+	"KEY_EDIT\0"
+	"key_event.EDIT\0"
+	"KEY_SCROLLUP\0"
+	"key_event.SCROLLUP\0"
+	"KEY_SCROLLDOWN\0"
+	"key_event.SCROLLDOWN\0"
+	"KEY_KPLEFTPAREN\0"
+	"key_event.KPLEFTPAREN\0"
+	"KEY_KPRIGHTPAREN\0"
+	"key_event.KPRIGHTPAREN\0"
+	"KEY_NEW\0"
+	"key_event.NEW\0"
+	"KEY_REDO\0"
+	"key_event.REDO\0"
+	"KEY_F13\0"
+	"key_event.F13\0"
+	"KEY_F14\0"
+	"key_event.F14\0"
+	"KEY_F15\0"
+	"key_event.F15\0"
+	"KEY_F16\0"
+	"key_event.F16\0"
+	"KEY_F17\0"
+	"key_event.F17\0"
+	"KEY_F18\0"
+	"key_event.F18\0"
+	"KEY_F19\0"
+	"key_event.F19\0"
+	"KEY_F20\0"
+	"key_event.F20\0"
+	"KEY_F21\0"
+	"key_event.F21\0"
+	"KEY_F22\0"
+	"key_event.F22\0"
+	"KEY_F23\0"
+	"key_event.F23\0"
+	"KEY_F24\0"
+	"key_event.F24\0"
+	"KEY_PLAYCD\0"
+	"key_event.PLAYCD\0"
+	"KEY_PAUSECD\0"
+	"key_event.PAUSECD\0"
+	"KEY_PROG3\0"
+	"key_event.PROG3\0"
+	"KEY_PROG4\0"
+	"key_event.PROG4\0"
+	"KEY_DASHBOARD\0"
+	"key_event.DASHBOARD\0"
+	"KEY_SUSPEND\0"
+	"key_event.SUSPEND\0"
+	"KEY_CLOSE\0"
+	"key_event.CLOSE\0"
+	"KEY_PLAY\0"
+	"key_event.PLAY\0"
+	"KEY_FASTFORWARD\0"
+	"key_event.FASTFORWARD\0"
+	"KEY_BASSBOOST\0"
+	"key_event.BASSBOOST\0"
+	"KEY_PRINT\0"
+	"key_event.PRINT\0"
+	"KEY_HP\0"
+	"key_event.HP\0"
+	"KEY_CAMERA\0"
+	"key_event.CAMERA\0"
+	"KEY_SOUND\0"
+	"key_event.SOUND\0"
+	"KEY_QUESTION\0"
+	"key_event.QUESTION\0"
+	"KEY_EMAIL\0"
+	"key_event.EMAIL\0"
+	"KEY_CHAT\0"
+	"key_event.CHAT\0"
+	"KEY_SEARCH\0"
+	"key_event.SEARCH\0"
+	"KEY_CONNECT\0"
+	"key_event.CONNECT\0"
+	"KEY_FINANCE\0"
+	"key_event.FINANCE\0"
+	"KEY_SPORT\0"
+	"key_event.SPORT\0"
+	"KEY_SHOP\0"
+	"key_event.SHOP\0"
+	"KEY_ALTERASE\0"
+	"key_event.ALTERASE\0"
+	"KEY_CANCEL\0"
+	"key_event.CANCEL\0"
+	"KEY_BRIGHTNESSDOWN\0"
+	"key_event.BRIGHTNESSDOWN\0"
+	"KEY_BRIGHTNESSUP\0"
+	"key_event.BRIGHTNESSUP\0"
+	"KEY_MEDIA\0"
+	"key_event.MEDIA\0"
+	"KEY_SWITCHVIDEOMODE\0"
+	"key_event.SWITCHVIDEOMODE\0"
+	"KEY_KBDILLUMTOGGLE\0"
+	"key_event.KBDILLUMTOGGLE\0"
+	"KEY_KBDILLUMDOWN\0"
+	"key_event.KBDILLUMDOWN\0"
+	"KEY_KBDILLUMUP\0"
+	"key_event.KBDILLUMUP\0"
+	"KEY_SEND\0"
+	"key_event.SEND\0"
+	"KEY_REPLY\0"
+	"key_event.REPLY\0"
+	"KEY_FORWARDMAIL\0"
+	"key_event.FORWARDMAIL\0"
+	"KEY_SAVE\0"
+	"key_event.SAVE\0"
+	"KEY_DOCUMENTS\0"
+	"key_event.DOCUMENTS\0"
+	"KEY_BATTERY\0"
+	"key_event.BATTERY\0"
+	"KEY_BLUETOOTH\0"
+	"key_event.BLUETOOTH\0"
+	"KEY_WLAN\0"
+	"key_event.WLAN\0"
+	"KEY_UWB\0"
+	"key_event.UWB\0"
+	"KEY_UNKNOWN\0"
+	"key_event.UNKNOWN\0"
+	"KEY_VIDEO_NEXT\0"
+	"key_event.VIDEO_NEXT\0"
+	"KEY_VIDEO_PREV\0"
+	"key_event.VIDEO_PREV\0"
+	"KEY_BRIGHTNESS_CYCLE\0"
+	"key_event.BRIGHTNESS_CYCLE\0"
+	"KEY_BRIGHTNESS_AUTO\0"
+	"key_event.BRIGHTNESS_AUTO\0"
+	"KEY_BRIGHTNESS_ZERO\0"
+	"key_event.BRIGHTNESS_ZERO\0"
+	"KEY_DISPLAY_OFF\0"
+	"key_event.DISPLAY_OFF\0"
+	"KEY_WWAN\0"
+	"key_event.WWAN\0"
+	"KEY_WIMAX\0"
+	"key_event.WIMAX\0"
+	"KEY_RFKILL\0"
+	"key_event.RFKILL\0"
+	"KEY_MICMUTE\0"
+	"key_event.MICMUTE\0"
+	"BTN_MISC\0"
+	"button_event.MISC\0"
+	"BTN_0\0"
+	"button_event.0\0"
+	"BTN_1\0"
+	"button_event.1\0"
+	"BTN_2\0"
+	"button_event.2\0"
+	"BTN_3\0"
+	"button_event.3\0"
+	"BTN_4\0"
+	"button_event.4\0"
+	"BTN_5\0"
+	"button_event.5\0"
+	"BTN_6\0"
+	"button_event.6\0"
+	"BTN_7\0"
+	"button_event.7\0"
+	"BTN_8\0"
+	"button_event.8\0"
+	"BTN_9\0"
+	"button_event.9\0"
+	"BTN_MOUSE\0"
+	"button_event.MOUSE\0"
+	"BTN_LEFT\0"
+	"button_event.LEFT\0"
+	"BTN_RIGHT\0"
+	"button_event.RIGHT\0"
+	"BTN_MIDDLE\0"
+	"button_event.MIDDLE\0"
+	"BTN_SIDE\0"
+	"button_event.SIDE\0"
+	"BTN_EXTRA\0"
+	"button_event.EXTRA\0"
+	"BTN_FORWARD\0"
+	"button_event.FORWARD\0"
+	"BTN_BACK\0"
+	"button_event.BACK\0"
+	"BTN_TASK\0"
+	"button_event.TASK\0"
+	"BTN_JOYSTICK\0"
+	"button_event.JOYSTICK\0"
+	"BTN_TRIGGER\0"
+	"button_event.TRIGGER\0"
+	"BTN_THUMB\0"
+	"button_event.THUMB\0"
+	"BTN_THUMB2\0"
+	"button_event.THUMB2\0"
+	"BTN_TOP\0"
+	"button_event.TOP\0"
+	"BTN_TOP2\0"
+	"button_event.TOP2\0"
+	"BTN_PINKIE\0"
+	"button_event.PINKIE\0"
+	"BTN_BASE\0"
+	"button_event.BASE\0"
+	"BTN_BASE2\0"
+	"button_event.BASE2\0"
+	"BTN_BASE3\0"
+	"button_event.BASE3\0"
+	"BTN_BASE4\0"
+	"button_event.BASE4\0"
+	"BTN_BASE5\0"
+	"button_event.BASE5\0"
+	"BTN_BASE6\0"
+	"button_event.BASE6\0"
+	"BTN_DEAD\0"
+	"button_event.DEAD\0"
+	"BTN_GAMEPAD\0"
+	"button_event.GAMEPAD\0"
+	"BTN_SOUTH\0"
+	"button_event.SOUTH\0"
+	"BTN_EAST\0"
+	"button_event.EAST\0"
+	"BTN_NORTH\0"
+	"button_event.NORTH\0"
+	"BTN_WEST\0"
+	"button_event.WEST\0"
+	"BTN_A\0"
+	"button_event.A\0"
+	"BTN_B\0"
+	"button_event.B\0"
+	"BTN_C\0"
+	"button_event.C\0"
+	"BTN_X\0"
+	"button_event.X\0"
+	"BTN_Y\0"
+	"button_event.Y\0"
+	"BTN_Z\0"
+	"button_event.Z\0"
+	"BTN_TL\0"
+	"button_event.TL\0"
+	"BTN_TR\0"
+	"button_event.TR\0"
+	"BTN_TL2\0"
+	"button_event.TL2\0"
+	"BTN_TR2\0"
+	"button_event.TR2\0"
+	"BTN_SELECT\0"
+	"button_event.SELECT\0"
+	"BTN_START\0"
+	"button_event.START\0"
+	"BTN_MODE\0"
+	"button_event.MODE\0"
+	"BTN_THUMBL\0"
+	"button_event.THUMBL\0"
+	"BTN_THUMBR\0"
+	"button_event.THUMBR\0"
+	"BTN_DIGI\0"
+	"button_event.DIGI\0"
+	"BTN_TOOL_PEN\0"
+	"button_event.TOOL_PEN\0"
+	"BTN_TOOL_RUBBER\0"
+	"button_event.TOOL_RUBBER\0"
+	"BTN_TOOL_BRUSH\0"
+	"button_event.TOOL_BRUSH\0"
+	"BTN_TOOL_PENCIL\0"
+	"button_event.TOOL_PENCIL\0"
+	"BTN_TOOL_AIRBRUSH\0"
+	"button_event.TOOL_AIRBRUSH\0"
+	"BTN_TOOL_FINGER\0"
+	"button_event.TOOL_FINGER\0"
+	"BTN_TOOL_MOUSE\0"
+	"button_event.TOOL_MOUSE\0"
+	"BTN_TOOL_LENS\0"
+	"button_event.TOOL_LENS\0"
+	"BTN_TOOL_QUINTTAP\0"
+	"button_event.TOOL_QUINTTAP\0"
+	"BTN_STYLUS3\0"
+	"button_event.STYLUS3\0"
+	"BTN_TOUCH\0"
+	"button_event.TOUCH\0"
+	"BTN_STYLUS\0"
+	"button_event.STYLUS\0"
+	"BTN_STYLUS2\0"
+	"button_event.STYLUS2\0"
+	"BTN_TOOL_DOUBLETAP\0"
+	"button_event.TOOL_DOUBLETAP\0"
+	"BTN_TOOL_TRIPLETAP\0"
+	"button_event.TOOL_TRIPLETAP\0"
+	"BTN_TOOL_QUADTAP\0"
+	"button_event.TOOL_QUADTAP\0"
+	"BTN_WHEEL\0"
+	"button_event.WHEEL\0"
+	"BTN_GEAR_DOWN\0"
+	"button_event.GEAR_DOWN\0"
+	"BTN_GEAR_UP\0"
+	"button_event.GEAR_UP\0"
+	"KEY_OK\0"
+	"key_event.OK\0"
+	"KEY_SELECT\0"
+	"key_event.SELECT\0"
+	"KEY_GOTO\0"
+	"key_event.GOTO\0"
+	"KEY_CLEAR\0"
+	"key_event.CLEAR\0"
+	"KEY_POWER2\0"
+	"key_event.POWER2\0"
+	"KEY_OPTION\0"
+	"key_event.OPTION\0"
+	"KEY_INFO\0"
+	"key_event.INFO\0"
+	"KEY_TIME\0"
+	"key_event.TIME\0"
+	"KEY_VENDOR\0"
+	"key_event.VENDOR\0"
+	"KEY_ARCHIVE\0"
+	"key_event.ARCHIVE\0"
+	"KEY_PROGRAM\0"
+	"key_event.PROGRAM\0"
+	"KEY_CHANNEL\0"
+	"key_event.CHANNEL\0"
+	"KEY_FAVORITES\0"
+	"key_event.FAVORITES\0"
+	"KEY_EPG\0"
+	"key_event.EPG\0"
+	"KEY_PVR\0"
+	"key_event.PVR\0"
+	"KEY_MHP\0"
+	"key_event.MHP\0"
+	"KEY_LANGUAGE\0"
+	"key_event.LANGUAGE\0"
+	"KEY_TITLE\0"
+	"key_event.TITLE\0"
+	"KEY_SUBTITLE\0"
+	"key_event.SUBTITLE\0"
+	"KEY_ANGLE\0"
+	"key_event.ANGLE\0"
+	"KEY_FULL_SCREEN\0"
+	"key_event.FULL_SCREEN\0"
+	"KEY_ZOOM\0"
+	"key_event.ZOOM\0"
+	"KEY_MODE\0"
+	"key_event.MODE\0"
+	"KEY_KEYBOARD\0"
+	"key_event.KEYBOARD\0"
+	"KEY_ASPECT_RATIO\0"
+	"key_event.ASPECT_RATIO\0"
+	"KEY_SCREEN\0"
+	"key_event.SCREEN\0"
+	"KEY_PC\0"
+	"key_event.PC\0"
+	"KEY_TV\0"
+	"key_event.TV\0"
+	"KEY_TV2\0"
+	"key_event.TV2\0"
+	"KEY_VCR\0"
+	"key_event.VCR\0"
+	"KEY_VCR2\0"
+	"key_event.VCR2\0"
+	"KEY_SAT\0"
+	"key_event.SAT\0"
+	"KEY_SAT2\0"
+	"key_event.SAT2\0"
+	"KEY_CD\0"
+	"key_event.CD\0"
+	"KEY_TAPE\0"
+	"key_event.TAPE\0"
+	"KEY_RADIO\0"
+	"key_event.RADIO\0"
+	"KEY_TUNER\0"
+	"key_event.TUNER\0"
+	"KEY_PLAYER\0"
+	"key_event.PLAYER\0"
+	"KEY_TEXT\0"
+	"key_event.TEXT\0"
+	"KEY_DVD\0"
+	"key_event.DVD\0"
+	"KEY_AUX\0"
+	"key_event.AUX\0"
+	"KEY_MP3\0"
+	"key_event.MP3\0"
+	"KEY_AUDIO\0"
+	"key_event.AUDIO\0"
+	"KEY_VIDEO\0"
+	"key_event.VIDEO\0"
+	"KEY_DIRECTORY\0"
+	"key_event.DIRECTORY\0"
+	"KEY_LIST\0"
+	"key_event.LIST\0"
+	"KEY_MEMO\0"
+	"key_event.MEMO\0"
+	"KEY_CALENDAR\0"
+	"key_event.CALENDAR\0"
+	"KEY_RED\0"
+	"key_event.RED\0"
+	"KEY_GREEN\0"
+	"key_event.GREEN\0"
+	"KEY_YELLOW\0"
+	"key_event.YELLOW\0"
+	"KEY_BLUE\0"
+	"key_event.BLUE\0"
+	"KEY_CHANNELUP\0"
+	"key_event.CHANNELUP\0"
+	"KEY_CHANNELDOWN\0"
+	"key_event.CHANNELDOWN\0"
+	"KEY_FIRST\0"
+	"key_event.FIRST\0"
+	"KEY_LAST\0"
+	"key_event.LAST\0"
+	"KEY_AB\0"
+	"key_event.AB\0"
+	"KEY_NEXT\0"
+	"key_event.NEXT\0"
+	"KEY_RESTART\0"
+	"key_event.RESTART\0"
+	"KEY_SLOW\0"
+	"key_event.SLOW\0"
+	"KEY_SHUFFLE\0"
+	"key_event.SHUFFLE\0"
+	"KEY_BREAK\0"
+	"key_event.BREAK\0"
+	"KEY_PREVIOUS\0"
+	"key_event.PREVIOUS\0"
+	"KEY_DIGITS\0"
+	"key_event.DIGITS\0"
+	"KEY_TEEN\0"
+	"key_event.TEEN\0"
+	"KEY_TWEN\0"
+	"key_event.TWEN\0"
+	"KEY_VIDEOPHONE\0"
+	"key_event.VIDEOPHONE\0"
+	"KEY_GAMES\0"
+	"key_event.GAMES\0"
+	"KEY_ZOOMIN\0"
+	"key_event.ZOOMIN\0"
+	"KEY_ZOOMOUT\0"
+	"key_event.ZOOMOUT\0"
+	"KEY_ZOOMRESET\0"
+	"key_event.ZOOMRESET\0"
+	"KEY_WORDPROCESSOR\0"
+	"key_event.WORDPROCESSOR\0"
+	"KEY_EDITOR\0"
+	"key_event.EDITOR\0"
+	"KEY_SPREADSHEET\0"
+	"key_event.SPREADSHEET\0"
+	"KEY_GRAPHICSEDITOR\0"
+	"key_event.GRAPHICSEDITOR\0"
+	"KEY_PRESENTATION\0"
+	"key_event.PRESENTATION\0"
+	"KEY_DATABASE\0"
+	"key_event.DATABASE\0"
+	"KEY_NEWS\0"
+	"key_event.NEWS\0"
+	"KEY_VOICEMAIL\0"
+	"key_event.VOICEMAIL\0"
+	"KEY_ADDRESSBOOK\0"
+	"key_event.ADDRESSBOOK\0"
+	"KEY_MESSENGER\0"
+	"key_event.MESSENGER\0"
+	"KEY_DISPLAYTOGGLE\0"
+	"key_event.DISPLAYTOGGLE\0"
+	"KEY_BRIGHTNESS_TOGGLE\0"
+	"key_event.BRIGHTNESS_TOGGLE\0"
+	"KEY_SPELLCHECK\0"
+	"key_event.SPELLCHECK\0"
+	"KEY_LOGOFF\0"
+	"key_event.LOGOFF\0"
+	"KEY_DOLLAR\0"
+	"key_event.DOLLAR\0"
+	"KEY_EURO\0"
+	"key_event.EURO\0"
+	"KEY_FRAMEBACK\0"
+	"key_event.FRAMEBACK\0"
+	"KEY_FRAMEFORWARD\0"
+	"key_event.FRAMEFORWARD\0"
+	"KEY_CONTEXT_MENU\0"
+	"key_event.CONTEXT_MENU\0"
+	"KEY_MEDIA_REPEAT\0"
+	"key_event.MEDIA_REPEAT\0"
+	"KEY_10CHANNELSUP\0"
+	"key_event.10CHANNELSUP\0"
+	"KEY_10CHANNELSDOWN\0"
+	"key_event.10CHANNELSDOWN\0"
+	"KEY_IMAGES\0"
+	"key_event.IMAGES\0"
+	"KEY_NOTIFICATION_CENTER\0"
+	"key_event.NOTIFICATION_CENTER\0"
+	"KEY_PICKUP_PHONE\0"
+	"key_event.PICKUP_PHONE\0"
+	"KEY_HANGUP_PHONE\0"
+	"key_event.HANGUP_PHONE\0"
+	"KEY_DEL_EOL\0"
+	"key_event.DEL_EOL\0"
+	"KEY_DEL_EOS\0"
+	"key_event.DEL_EOS\0"
+	"KEY_INS_LINE\0"
+	"key_event.INS_LINE\0"
+	"KEY_DEL_LINE\0"
+	"key_event.DEL_LINE\0"
+	"KEY_FN\0"
+	"key_event.FN\0"
+	"KEY_FN_ESC\0"
+	"key_event.FN_ESC\0"
+	"KEY_FN_F1\0"
+	"key_event.FN_F1\0"
+	"KEY_FN_F2\0"
+	"key_event.FN_F2\0"
+	"KEY_FN_F3\0"
+	"key_event.FN_F3\0"
+	"KEY_FN_F4\0"
+	"key_event.FN_F4\0"
+	"KEY_FN_F5\0"
+	"key_event.FN_F5\0"
+	"KEY_FN_F6\0"
+	"key_event.FN_F6\0"
+	"KEY_FN_F7\0"
+	"key_event.FN_F7\0"
+	"KEY_FN_F8\0"
+	"key_event.FN_F8\0"
+	"KEY_FN_F9\0"
+	"key_event.FN_F9\0"
+	"KEY_FN_F10\0"
+	"key_event.FN_F10\0"
+	"KEY_FN_F11\0"
+	"key_event.FN_F11\0"
+	"KEY_FN_F12\0"
+	"key_event.FN_F12\0"
+	"KEY_FN_1\0"
+	"key_event.FN_1\0"
+	"KEY_FN_2\0"
+	"key_event.FN_2\0"
+	"KEY_FN_D\0"
+	"key_event.FN_D\0"
+	"KEY_FN_E\0"
+	"key_event.FN_E\0"
+	"KEY_FN_F\0"
+	"key_event.FN_F\0"
+	"KEY_FN_S\0"
+	"key_event.FN_S\0"
+	"KEY_FN_B\0"
+	"key_event.FN_B\0"
+	"KEY_FN_RIGHT_SHIFT\0"
+	"key_event.FN_RIGHT_SHIFT\0"
+	"KEY_BRL_DOT1\0"
+	"key_event.BRL_DOT1\0"
+	"KEY_BRL_DOT2\0"
+	"key_event.BRL_DOT2\0"
+	"KEY_BRL_DOT3\0"
+	"key_event.BRL_DOT3\0"
+	"KEY_BRL_DOT4\0"
+	"key_event.BRL_DOT4\0"
+	"KEY_BRL_DOT5\0"
+	"key_event.BRL_DOT5\0"
+	"KEY_BRL_DOT6\0"
+	"key_event.BRL_DOT6\0"
+	"KEY_BRL_DOT7\0"
+	"key_event.BRL_DOT7\0"
+	"KEY_BRL_DOT8\0"
+	"key_event.BRL_DOT8\0"
+	"KEY_BRL_DOT9\0"
+	"key_event.BRL_DOT9\0"
+	"KEY_BRL_DOT10\0"
+	"key_event.BRL_DOT10\0"
+	"KEY_NUMERIC_0\0"
+	"key_event.NUMERIC_0\0"
+	"KEY_NUMERIC_1\0"
+	"key_event.NUMERIC_1\0"
+	"KEY_NUMERIC_2\0"
+	"key_event.NUMERIC_2\0"
+	"KEY_NUMERIC_3\0"
+	"key_event.NUMERIC_3\0"
+	"KEY_NUMERIC_4\0"
+	"key_event.NUMERIC_4\0"
+	"KEY_NUMERIC_5\0"
+	"key_event.NUMERIC_5\0"
+	"KEY_NUMERIC_6\0"
+	"key_event.NUMERIC_6\0"
+	"KEY_NUMERIC_7\0"
+	"key_event.NUMERIC_7\0"
+	"KEY_NUMERIC_8\0"
+	"key_event.NUMERIC_8\0"
+	"KEY_NUMERIC_9\0"
+	"key_event.NUMERIC_9\0"
+	"KEY_NUMERIC_STAR\0"
+	"key_event.NUMERIC_STAR\0"
+	"KEY_NUMERIC_POUND\0"
+	"key_event.NUMERIC_POUND\0"
+	"KEY_NUMERIC_A\0"
+	"key_event.NUMERIC_A\0"
+	"KEY_NUMERIC_B\0"
+	"key_event.NUMERIC_B\0"
+	"KEY_NUMERIC_C\0"
+	"key_event.NUMERIC_C\0"
+	"KEY_NUMERIC_D\0"
+	"key_event.NUMERIC_D\0"
+	"KEY_CAMERA_FOCUS\0"
+	"key_event.CAMERA_FOCUS\0"
+	"KEY_WPS_BUTTON\0"
+	"key_event.WPS_BUTTON\0"
+	"KEY_TOUCHPAD_TOGGLE\0"
+	"key_event.TOUCHPAD_TOGGLE\0"
+	"KEY_TOUCHPAD_ON\0"
+	"key_event.TOUCHPAD_ON\0"
+	"KEY_TOUCHPAD_OFF\0"
+	"key_event.TOUCHPAD_OFF\0"
+	"KEY_CAMERA_ZOOMIN\0"
+	"key_event.CAMERA_ZOOMIN\0"
+	"KEY_CAMERA_ZOOMOUT\0"
+	"key_event.CAMERA_ZOOMOUT\0"
+	"KEY_CAMERA_UP\0"
+	"key_event.CAMERA_UP\0"
+	"KEY_CAMERA_DOWN\0"
+	"key_event.CAMERA_DOWN\0"
+	"KEY_CAMERA_LEFT\0"
+	"key_event.CAMERA_LEFT\0"
+	"KEY_CAMERA_RIGHT\0"
+	"key_event.CAMERA_RIGHT\0"
+	"KEY_ATTENDANT_ON\0"
+	"key_event.ATTENDANT_ON\0"
+	"KEY_ATTENDANT_OFF\0"
+	"key_event.ATTENDANT_OFF\0"
+	"KEY_ATTENDANT_TOGGLE\0"
+	"key_event.ATTENDANT_TOGGLE\0"
+	"KEY_LIGHTS_TOGGLE\0"
+	"key_event.LIGHTS_TOGGLE\0"
+	"BTN_DPAD_UP\0"
+	"button_event.DPAD_UP\0"
+	"BTN_DPAD_DOWN\0"
+	"button_event.DPAD_DOWN\0"
+	"BTN_DPAD_LEFT\0"
+	"button_event.DPAD_LEFT\0"
+	"BTN_DPAD_RIGHT\0"
+	"button_event.DPAD_RIGHT\0"
+	"KEY_ALS_TOGGLE\0"
+	"key_event.ALS_TOGGLE\0"
+	"KEY_ROTATE_LOCK_TOGGLE\0"
+	"key_event.ROTATE_LOCK_TOGGLE\0"
+	"KEY_REFRESH_RATE_TOGGLE\0"
+	"key_event.REFRESH_RATE_TOGGLE\0"
+	"KEY_BUTTONCONFIG\0"
+	"key_event.BUTTONCONFIG\0"
+	"KEY_TASKMANAGER\0"
+	"key_event.TASKMANAGER\0"
+	"KEY_JOURNAL\0"
+	"key_event.JOURNAL\0"
+	"KEY_CONTROLPANEL\0"
+	"key_event.CONTROLPANEL\0"
+	"KEY_APPSELECT\0"
+	"key_event.APPSELECT\0"
+	"KEY_SCREENSAVER\0"
+	"key_event.SCREENSAVER\0"
+	"KEY_VOICECOMMAND\0"
+	"key_event.VOICECOMMAND\0"
+	"KEY_ASSISTANT\0"
+	"key_event.ASSISTANT\0"
+	"KEY_EMOJI_PICKER\0"
+	"key_event.EMOJI_PICKER\0"
+	"KEY_KBD_LAYOUT_NEXT\0"
+	"key_event.KBD_LAYOUT_NEXT\0"
+	"KEY_DICTATE\0"
+	"key_event.DICTATE\0"
+	"KEY_BRIGHTNESS_MIN\0"
+	"key_event.BRIGHTNESS_MIN\0"
+	"KEY_BRIGHTNESS_MAX\0"
+	"key_event.BRIGHTNESS_MAX\0"
+	"KEY_KBDINPUTASSIST_PREV\0"
+	"key_event.KBDINPUTASSIST_PREV\0"
+	"KEY_KBDINPUTASSIST_NEXT\0"
+	"key_event.KBDINPUTASSIST_NEXT\0"
+	"KEY_KBDINPUTASSIST_PREVGROUP\0"
+	"key_event.KBDINPUTASSIST_PREVGROUP\0"
+	"KEY_KBDINPUTASSIST_NEXTGROUP\0"
+	"key_event.KBDINPUTASSIST_NEXTGROUP\0"
+	"KEY_KBDINPUTASSIST_ACCEPT\0"
+	"key_event.KBDINPUTASSIST_ACCEPT\0"
+	"KEY_KBDINPUTASSIST_CANCEL\0"
+	"key_event.KBDINPUTASSIST_CANCEL\0"
+	"KEY_RIGHT_UP\0"
+	"key_event.RIGHT_UP\0"
+	"KEY_RIGHT_DOWN\0"
+	"key_event.RIGHT_DOWN\0"
+	"KEY_LEFT_UP\0"
+	"key_event.LEFT_UP\0"
+	"KEY_LEFT_DOWN\0"
+	"key_event.LEFT_DOWN\0"
+	"KEY_NUMERIC_11\0"
+	"key_event.NUMERIC_11\0"
+	"KEY_NUMERIC_12\0"
+	"key_event.NUMERIC_12\0"
+	"KEY_ROOT_MENU\0"
+	"key_event.ROOT_MENU\0"
+	"KEY_MEDIA_TOP_MENU\0"
+	"key_event.MEDIA_TOP_MENU\0"
+	"KEY_AUDIO_DESC\0"
+	"key_event.AUDIO_DESC\0"
+	"KEY_3D_MODE\0"
+	"key_event.3D_MODE\0"
+	"KEY_NEXT_FAVORITE\0"
+	"key_event.NEXT_FAVORITE\0"
+	"KEY_STOP_RECORD\0"
+	"key_event.STOP_RECORD\0"
+	"KEY_PAUSE_RECORD\0"
+	"key_event.PAUSE_RECORD\0"
+	"KEY_VOD\0"
+	"key_event.VOD\0"
+	"KEY_UNMUTE\0"
+	"key_event.UNMUTE\0"
+	"KEY_FASTREVERSE\0"
+	"key_event.FASTREVERSE\0"
+	"KEY_SLOWREVERSE\0"
+	"key_event.SLOWREVERSE\0"
+	"KEY_DATA\0"
+	"key_event.DATA\0"
+	"KEY_ONSCREEN_KEYBOARD\0"
+	"key_event.ONSCREEN_KEYBOARD\0"
+	"KEY_PRIVACY_SCREEN_TOGGLE\0"
+	"key_event.PRIVACY_SCREEN_TOGGLE\0"
+	"KEY_SELECTIVE_SCREENSHOT\0"
+	"key_event.SELECTIVE_SCREENSHOT\0"
+	"KEY_NEXT_ELEMENT\0"
+	"key_event.NEXT_ELEMENT\0"
+	"KEY_PREVIOUS_ELEMENT\0"
+	"key_event.PREVIOUS_ELEMENT\0"
+	"KEY_AUTOPILOT_ENGAGE_TOGGLE\0"
+	"key_event.AUTOPILOT_ENGAGE_TOGGLE\0"
+	"KEY_MARK_WAYPOINT\0"
+	"key_event.MARK_WAYPOINT\0"
+	"KEY_SOS\0"
+	"key_event.SOS\0"
+	"KEY_NAV_CHART\0"
+	"key_event.NAV_CHART\0"
+	"KEY_FISHING_CHART\0"
+	"key_event.FISHING_CHART\0"
+	"KEY_SINGLE_RANGE_RADAR\0"
+	"key_event.SINGLE_RANGE_RADAR\0"
+	"KEY_DUAL_RANGE_RADAR\0"
+	"key_event.DUAL_RANGE_RADAR\0"
+	"KEY_RADAR_OVERLAY\0"
+	"key_event.RADAR_OVERLAY\0"
+	"KEY_TRADITIONAL_SONAR\0"
+	"key_event.TRADITIONAL_SONAR\0"
+	"KEY_CLEARVU_SONAR\0"
+	"key_event.CLEARVU_SONAR\0"
+	"KEY_SIDEVU_SONAR\0"
+	"key_event.SIDEVU_SONAR\0"
+	"KEY_NAV_INFO\0"
+	"key_event.NAV_INFO\0"
+	"KEY_BRIGHTNESS_MENU\0"
+	"key_event.BRIGHTNESS_MENU\0"
+	"KEY_MACRO1\0"
+	"key_event.MACRO1\0"
+	"KEY_MACRO2\0"
+	"key_event.MACRO2\0"
+	"KEY_MACRO3\0"
+	"key_event.MACRO3\0"
+	"KEY_MACRO4\0"
+	"key_event.MACRO4\0"
+	"KEY_MACRO5\0"
+	"key_event.MACRO5\0"
+	"KEY_MACRO6\0"
+	"key_event.MACRO6\0"
+	"KEY_MACRO7\0"
+	"key_event.MACRO7\0"
+	"KEY_MACRO8\0"
+	"key_event.MACRO8\0"
+	"KEY_MACRO9\0"
+	"key_event.MACRO9\0"
+	"KEY_MACRO10\0"
+	"key_event.MACRO10\0"
+	"KEY_MACRO11\0"
+	"key_event.MACRO11\0"
+	"KEY_MACRO12\0"
+	"key_event.MACRO12\0"
+	"KEY_MACRO13\0"
+	"key_event.MACRO13\0"
+	"KEY_MACRO14\0"
+	"key_event.MACRO14\0"
+	"KEY_MACRO15\0"
+	"key_event.MACRO15\0"
+	"KEY_MACRO16\0"
+	"key_event.MACRO16\0"
+	"KEY_MACRO17\0"
+	"key_event.MACRO17\0"
+	"KEY_MACRO18\0"
+	"key_event.MACRO18\0"
+	"KEY_MACRO19\0"
+	"key_event.MACRO19\0"
+	"KEY_MACRO20\0"
+	"key_event.MACRO20\0"
+	"KEY_MACRO21\0"
+	"key_event.MACRO21\0"
+	"KEY_MACRO22\0"
+	"key_event.MACRO22\0"
+	"KEY_MACRO23\0"
+	"key_event.MACRO23\0"
+	"KEY_MACRO24\0"
+	"key_event.MACRO24\0"
+	"KEY_MACRO25\0"
+	"key_event.MACRO25\0"
+	"KEY_MACRO26\0"
+	"key_event.MACRO26\0"
+	"KEY_MACRO27\0"
+	"key_event.MACRO27\0"
+	"KEY_MACRO28\0"
+	"key_event.MACRO28\0"
+	"KEY_MACRO29\0"
+	"key_event.MACRO29\0"
+	"KEY_MACRO30\0"
+	"key_event.MACRO30\0"
+	"KEY_MACRO_RECORD_START\0"
+	"key_event.MACRO_RECORD_START\0"
+	"KEY_MACRO_RECORD_STOP\0"
+	"key_event.MACRO_RECORD_STOP\0"
+	"KEY_MACRO_PRESET_CYCLE\0"
+	"key_event.MACRO_PRESET_CYCLE\0"
+	"KEY_MACRO_PRESET1\0"
+	"key_event.MACRO_PRESET1\0"
+	"KEY_MACRO_PRESET2\0"
+	"key_event.MACRO_PRESET2\0"
+	"KEY_MACRO_PRESET3\0"
+	"key_event.MACRO_PRESET3\0"
+	"KEY_KBD_LCD_MENU1\0"
+	"key_event.KBD_LCD_MENU1\0"
+	"KEY_KBD_LCD_MENU2\0"
+	"key_event.KBD_LCD_MENU2\0"
+	"KEY_KBD_LCD_MENU3\0"
+	"key_event.KBD_LCD_MENU3\0"
+	"KEY_KBD_LCD_MENU4\0"
+	"key_event.KBD_LCD_MENU4\0"
+	"KEY_KBD_LCD_MENU5\0"
+	"key_event.KBD_LCD_MENU5\0"
+	"BTN_TRIGGER_HAPPY\0"
+	"button_event.TRIGGER_HAPPY\0"
+	"BTN_TRIGGER_HAPPY1\0"
+	"button_event.TRIGGER_HAPPY1\0"
+	"BTN_TRIGGER_HAPPY2\0"
+	"button_event.TRIGGER_HAPPY2\0"
+	"BTN_TRIGGER_HAPPY3\0"
+	"button_event.TRIGGER_HAPPY3\0"
+	"BTN_TRIGGER_HAPPY4\0"
+	"button_event.TRIGGER_HAPPY4\0"
+	"BTN_TRIGGER_HAPPY5\0"
+	"button_event.TRIGGER_HAPPY5\0"
+	"BTN_TRIGGER_HAPPY6\0"
+	"button_event.TRIGGER_HAPPY6\0"
+	"BTN_TRIGGER_HAPPY7\0"
+	"button_event.TRIGGER_HAPPY7\0"
+	"BTN_TRIGGER_HAPPY8\0"
+	"button_event.TRIGGER_HAPPY8\0"
+	"BTN_TRIGGER_HAPPY9\0"
+	"button_event.TRIGGER_HAPPY9\0"
+	"BTN_TRIGGER_HAPPY10\0"
+	"button_event.TRIGGER_HAPPY10\0"
+	"BTN_TRIGGER_HAPPY11\0"
+	"button_event.TRIGGER_HAPPY11\0"
+	"BTN_TRIGGER_HAPPY12\0"
+	"button_event.TRIGGER_HAPPY12\0"
+	"BTN_TRIGGER_HAPPY13\0"
+	"button_event.TRIGGER_HAPPY13\0"
+	"BTN_TRIGGER_HAPPY14\0"
+	"button_event.TRIGGER_HAPPY14\0"
+	"BTN_TRIGGER_HAPPY15\0"
+	"button_event.TRIGGER_HAPPY15\0"
+	"BTN_TRIGGER_HAPPY16\0"
+	"button_event.TRIGGER_HAPPY16\0"
+	"BTN_TRIGGER_HAPPY17\0"
+	"button_event.TRIGGER_HAPPY17\0"
+	"BTN_TRIGGER_HAPPY18\0"
+	"button_event.TRIGGER_HAPPY18\0"
+	"BTN_TRIGGER_HAPPY19\0"
+	"button_event.TRIGGER_HAPPY19\0"
+	"BTN_TRIGGER_HAPPY20\0"
+	"button_event.TRIGGER_HAPPY20\0"
+	"BTN_TRIGGER_HAPPY21\0"
+	"button_event.TRIGGER_HAPPY21\0"
+	"BTN_TRIGGER_HAPPY22\0"
+	"button_event.TRIGGER_HAPPY22\0"
+	"BTN_TRIGGER_HAPPY23\0"
+	"button_event.TRIGGER_HAPPY23\0"
+	"BTN_TRIGGER_HAPPY24\0"
+	"button_event.TRIGGER_HAPPY24\0"
+	"BTN_TRIGGER_HAPPY25\0"
+	"button_event.TRIGGER_HAPPY25\0"
+	"BTN_TRIGGER_HAPPY26\0"
+	"button_event.TRIGGER_HAPPY26\0"
+	"BTN_TRIGGER_HAPPY27\0"
+	"button_event.TRIGGER_HAPPY27\0"
+	"BTN_TRIGGER_HAPPY28\0"
+	"button_event.TRIGGER_HAPPY28\0"
+	"BTN_TRIGGER_HAPPY29\0"
+	"button_event.TRIGGER_HAPPY29\0"
+	"BTN_TRIGGER_HAPPY30\0"
+	"button_event.TRIGGER_HAPPY30\0"
+	"BTN_TRIGGER_HAPPY31\0"
+	"button_event.TRIGGER_HAPPY31\0"
+	"BTN_TRIGGER_HAPPY32\0"
+	"button_event.TRIGGER_HAPPY32\0"
+	"BTN_TRIGGER_HAPPY33\0"
+	"button_event.TRIGGER_HAPPY33\0"
+	"BTN_TRIGGER_HAPPY34\0"
+	"button_event.TRIGGER_HAPPY34\0"
+	"BTN_TRIGGER_HAPPY35\0"
+	"button_event.TRIGGER_HAPPY35\0"
+	"BTN_TRIGGER_HAPPY36\0"
+	"button_event.TRIGGER_HAPPY36\0"
+	"BTN_TRIGGER_HAPPY37\0"
+	"button_event.TRIGGER_HAPPY37\0"
+	"BTN_TRIGGER_HAPPY38\0"
+	"button_event.TRIGGER_HAPPY38\0"
+	"BTN_TRIGGER_HAPPY39\0"
+	"button_event.TRIGGER_HAPPY39\0"
+	"BTN_TRIGGER_HAPPY40\0"
+	"button_event.TRIGGER_HAPPY40\0"
+	"KEY_MIN_INTERESTING\0"
+	"key_event.MIN_INTERESTING\0"
+	"KEY_MAX\0"
+	"key_event.MAX\0"
+	"KEY_CNT\0"
+	"key_event.CNT\0"
+	"REL_X\0"
+	"relative_axis.X\0"
+	"REL_Y\0"
+	"relative_axis.Y\0"
+	"REL_Z\0"
+	"relative_axis.Z\0"
+	"REL_RX\0"
+	"relative_axis.RX\0"
+	"REL_RY\0"
+	"relative_axis.RY\0"
+	"REL_RZ\0"
+	"relative_axis.RZ\0"
+	"REL_HWHEEL\0"
+	"relative_axis.HWHEEL\0"
+	"REL_DIAL\0"
+	"relative_axis.DIAL\0"
+	"REL_WHEEL\0"
+	"relative_axis.WHEEL\0"
+	"REL_MISC\0"
+	"relative_axis.MISC\0"
+	"REL_RESERVED\0"
+	"relative_axis.RESERVED\0"
+	"REL_WHEEL_HI_RES\0"
+	"relative_axis.WHEEL_HI_RES\0"
+	"REL_HWHEEL_HI_RES\0"
+	"relative_axis.HWHEEL_HI_RES\0"
+	"REL_MAX\0"
+	"relative_axis.MAX\0"
+	"REL_CNT\0"
+	"relative_axis.CNT\0"
+	"ABS_X\0"
+	"absolute_axis.X\0"
+	"ABS_Y\0"
+	"absolute_axis.Y\0"
+	"ABS_Z\0"
+	"absolute_axis.Z\0"
+	"ABS_RX\0"
+	"absolute_axis.RX\0"
+	"ABS_RY\0"
+	"absolute_axis.RY\0"
+	"ABS_RZ\0"
+	"absolute_axis.RZ\0"
+	"ABS_THROTTLE\0"
+	"absolute_axis.THROTTLE\0"
+	"ABS_RUDDER\0"
+	"absolute_axis.RUDDER\0"
+	"ABS_WHEEL\0"
+	"absolute_axis.WHEEL\0"
+	"ABS_GAS\0"
+	"absolute_axis.GAS\0"
+	"ABS_BRAKE\0"
+	"absolute_axis.BRAKE\0"
+	"ABS_HAT0X\0"
+	"absolute_axis.HAT0X\0"
+	"ABS_HAT0Y\0"
+	"absolute_axis.HAT0Y\0"
+	"ABS_HAT1X\0"
+	"absolute_axis.HAT1X\0"
+	"ABS_HAT1Y\0"
+	"absolute_axis.HAT1Y\0"
+	"ABS_HAT2X\0"
+	"absolute_axis.HAT2X\0"
+	"ABS_HAT2Y\0"
+	"absolute_axis.HAT2Y\0"
+	"ABS_HAT3X\0"
+	"absolute_axis.HAT3X\0"
+	"ABS_HAT3Y\0"
+	"absolute_axis.HAT3Y\0"
+	"ABS_PRESSURE\0"
+	"absolute_axis.PRESSURE\0"
+	"ABS_DISTANCE\0"
+	"absolute_axis.DISTANCE\0"
+	"ABS_TILT_X\0"
+	"absolute_axis.TILT_X\0"
+	"ABS_TILT_Y\0"
+	"absolute_axis.TILT_Y\0"
+	"ABS_TOOL_WIDTH\0"
+	"absolute_axis.TOOL_WIDTH\0"
+	"ABS_VOLUME\0"
+	"absolute_axis.VOLUME\0"
+	"ABS_MISC\0"
+	"absolute_axis.MISC\0"
+	"ABS_RESERVED\0"
+	"absolute_axis.RESERVED\0"
+	"ABS_MT_SLOT\0"
+	"absolute_axis.MT_SLOT\0"
+	"ABS_MT_TOUCH_MAJOR\0"
+	"absolute_axis.MT_TOUCH_MAJOR\0"
+	"ABS_MT_TOUCH_MINOR\0"
+	"absolute_axis.MT_TOUCH_MINOR\0"
+	"ABS_MT_WIDTH_MAJOR\0"
+	"absolute_axis.MT_WIDTH_MAJOR\0"
+	"ABS_MT_WIDTH_MINOR\0"
+	"absolute_axis.MT_WIDTH_MINOR\0"
+	"ABS_MT_ORIENTATION\0"
+	"absolute_axis.MT_ORIENTATION\0"
+	"ABS_MT_POSITION_X\0"
+	"absolute_axis.MT_POSITION_X\0"
+	"ABS_MT_POSITION_Y\0"
+	"absolute_axis.MT_POSITION_Y\0"
+	"ABS_MT_TOOL_TYPE\0"
+	"absolute_axis.MT_TOOL_TYPE\0"
+	"ABS_MT_BLOB_ID\0"
+	"absolute_axis.MT_BLOB_ID\0"
+	"ABS_MT_TRACKING_ID\0"
+	"absolute_axis.MT_TRACKING_ID\0"
+	"ABS_MT_PRESSURE\0"
+	"absolute_axis.MT_PRESSURE\0"
+	"ABS_MT_DISTANCE\0"
+	"absolute_axis.MT_DISTANCE\0"
+	"ABS_MT_TOOL_X\0"
+	"absolute_axis.MT_TOOL_X\0"
+	"ABS_MT_TOOL_Y\0"
+	"absolute_axis.MT_TOOL_Y\0"
+	"ABS_MAX\0"
+	"absolute_axis.MAX\0"
+	"ABS_CNT\0"
+	"absolute_axis.CNT\0"
+	"SW_LID\0"
+	"switch_event.LID\0"
+	"SW_TABLET_MODE\0"
+	"switch_event.TABLET_MODE\0"
+	"SW_HEADPHONE_INSERT\0"
+	"switch_event.HEADPHONE_INSERT\0"
+	"SW_RFKILL_ALL\0"
+	"switch_event.RFKILL_ALL\0"
+	"SW_RADIO\0"
+	"switch_event.RADIO\0"
+	"SW_MICROPHONE_INSERT\0"
+	"switch_event.MICROPHONE_INSERT\0"
+	"SW_DOCK\0"
+	"switch_event.DOCK\0"
+	"SW_LINEOUT_INSERT\0"
+	"switch_event.LINEOUT_INSERT\0"
+	"SW_JACK_PHYSICAL_INSERT\0"
+	"switch_event.JACK_PHYSICAL_INSERT\0"
+	"SW_VIDEOOUT_INSERT\0"
+	"switch_event.VIDEOOUT_INSERT\0"
+	"SW_CAMERA_LENS_COVER\0"
+	"switch_event.CAMERA_LENS_COVER\0"
+	"SW_KEYPAD_SLIDE\0"
+	"switch_event.KEYPAD_SLIDE\0"
+	"SW_FRONT_PROXIMITY\0"
+	"switch_event.FRONT_PROXIMITY\0"
+	"SW_ROTATE_LOCK\0"
+	"switch_event.ROTATE_LOCK\0"
+	"SW_LINEIN_INSERT\0"
+	"switch_event.LINEIN_INSERT\0"
+	"SW_MUTE_DEVICE\0"
+	"switch_event.MUTE_DEVICE\0"
+	"SW_PEN_INSERTED\0"
+	"switch_event.PEN_INSERTED\0"
+	"SW_MACHINE_COVER\0"
+	"switch_event.MACHINE_COVER\0"
+	"SW_MAX\0"
+	"switch_event.MAX\0"
+	"SW_CNT\0"
+	"switch_event.CNT\0"
+	"MSC_SERIAL\0"
+	"misc_event.SERIAL\0"
+	"MSC_PULSELED\0"
+	"misc_event.PULSELED\0"
+	"MSC_GESTURE\0"
+	"misc_event.GESTURE\0"
+	"MSC_RAW\0"
+	"misc_event.RAW\0"
+	"MSC_SCAN\0"
+	"misc_event.SCAN\0"
+	"MSC_TIMESTAMP\0"
+	"misc_event.TIMESTAMP\0"
+	"MSC_MAX\0"
+	"misc_event.MAX\0"
+	"MSC_CNT\0"
+	"misc_event.CNT\0"
+	"LED_NUML\0"
+	"led_event.NUML\0"
+	"LED_CAPSL\0"
+	"led_event.CAPSL\0"
+	"LED_SCROLLL\0"
+	"led_event.SCROLLL\0"
+	"LED_COMPOSE\0"
+	"led_event.COMPOSE\0"
+	"LED_KANA\0"
+	"led_event.KANA\0"
+	"LED_SLEEP\0"
+	"led_event.SLEEP\0"
+	"LED_SUSPEND\0"
+	"led_event.SUSPEND\0"
+	"LED_MUTE\0"
+	"led_event.MUTE\0"
+	"LED_MISC\0"
+	"led_event.MISC\0"
+	"LED_MAIL\0"
+	"led_event.MAIL\0"
+	"LED_CHARGING\0"
+	"led_event.CHARGING\0"
+	"LED_MAX\0"
+	"led_event.MAX\0"
+	"LED_CNT\0"
+	"led_event.CNT\0"
+	"REP_DELAY\0"
+	"repeat_event.DELAY\0"
+	"REP_PERIOD\0"
+	"repeat_event.PERIOD\0"
+	"REP_MAX\0"
+	"repeat_event.MAX\0"
+	"REP_CNT\0"
+	"repeat_event.CNT\0"
+	"SND_CLICK\0"
+	"sound_event.CLICK\0"
+	"SND_BELL\0"
+	"sound_event.BELL\0"
+	"SND_TONE\0"
+	"sound_event.TONE\0"
+	"SND_MAX\0"
+	"sound_event.MAX\0"
+	"SND_CNT\0"
+	"sound_event.CNT\0"
+	"FF_STATUS_STOPPED\0"
+	"force_feedback_status.STOPPED\0"
+	"FF_STATUS_PLAYING\0"
+	"force_feedback_status.PLAYING\0"
+	"FF_STATUS_MAX\0"
+	"force_feedback_status.MAX\0"
+	"FF_RUMBLE\0"
+	"force_feedback.RUMBLE\0"
+	"FF_PERIODIC\0"
+	"force_feedback.PERIODIC\0"
+	"FF_CONSTANT\0"
+	"force_feedback.CONSTANT\0"
+	"FF_SPRING\0"
+	"force_feedback.SPRING\0"
+	"FF_FRICTION\0"
+	"force_feedback.FRICTION\0"
+	"FF_DAMPER\0"
+	"force_feedback.DAMPER\0"
+	"FF_INERTIA\0"
+	"force_feedback.INERTIA\0"
+	"FF_RAMP\0"
+	"force_feedback.RAMP\0"
+	"FF_EFFECT_MIN\0"
+	"force_feedback.EFFECT_MIN\0"
+	"FF_EFFECT_MAX\0"
+	"force_feedback.EFFECT_MAX\0"
+	"FF_SQUARE\0"
+	"force_feedback.SQUARE\0"
+	"FF_TRIANGLE\0"
+	"force_feedback.TRIANGLE\0"
+	"FF_SINE\0"
+	"force_feedback.SINE\0"
+	"FF_SAW_UP\0"
+	"force_feedback.SAW_UP\0"
+	"FF_SAW_DOWN\0"
+	"force_feedback.SAW_DOWN\0"
+	"FF_CUSTOM\0"
+	"force_feedback.CUSTOM\0"
+	"FF_WAVEFORM_MIN\0"
+	"force_feedback.WAVEFORM_MIN\0"
+	"FF_WAVEFORM_MAX\0"
+	"force_feedback.WAVEFORM_MAX\0"
+	"FF_GAIN\0"
+	"force_feedback.GAIN\0"
+	"FF_AUTOCENTER\0"
+	"force_feedback.AUTOCENTER\0"
+	"FF_MAX_EFFECTS\0"
+	"force_feedback.MAX_EFFECTS\0"
+	"FF_MAX\0"
+	"force_feedback.MAX\0"
+	"FF_CNT\0"
+	"force_feedback.CNT\0";
+
+static const uint16_t builtin_constant_displacements[399] = {
+	3, 1, 30, 1, 1, 5, 0, 7, 17, 0, 8, 11, 4, 9, 2, 3,
+	2, 0, 0, 2, 5, 4, 2, 2, 36, 13, 17, 1, 0, 71, 45, 9,
+	2, 5, 35, 0, 1, 1, 12, 0, 23, 4, 6, 11, 0, 27, 0, 5,
+	3, 9, 7, 0, 2, 2, 21, 3, 3, 8, 2, 10, 2, 17, 94, 0,
+	9, 14, 0, 18, 0, 2, 2, 3, 0, 5, 5, 4, 9, 7, 17, 0,
+	10, 25, 0, 31, 25, 5, 0, 2, 3, 4, 5, 4, 17, 0, 3, 8,
+	2, 13, 4, 13, 27, 6, 12, 0, 0, 9, 16, 16, 7, 24, 13, 32,
+	2, 2, 0, 26, 35, 4, 31, 42, 2, 1, 28, 3, 15, 1, 10, 3,
+	8, 14, 19, 13, 16, 1, 16, 8, 0, 8, 56, 6, 13, 13, 0, 23,
+	0, 4, 15, 10, 18, 10, 12, 25, 19, 0, 1, 0, 30, 33, 5, 0,
+	12, 0, 0, 7, 0, 0, 11, 12, 11, 6, 2, 7, 4, 10, 27, 2,
+	3, 5, 5, 0, 17, 4, 3, 3, 2, 5, 7, 6, 2, 15, 1, 11,
+	1, 3, 0, 1, 13, 2, 26, 0, 47, 0, 4, 26, 1, 1, 20, 17,
+	15, 2, 8, 0, 0, 4, 5, 1, 3, 1, 37, 16, 0, 24, 16, 18,
+	18, 27, 24, 47, 3, 3, 4, 9, 13, 7, 19, 0, 8, 19, 3, 1,
+	2, 7, 64, 33, 1, 2, 1, 4, 25, 21, 22, 18, 0, 12, 7, 10,
+	0, 11, 10, 10, 9, 15, 0, 0, 26, 2, 38, 0, 11, 4, 2, 1,
+	2, 22, 22, 11, 15, 1, 22, 30, 1, 11, 0, 0, 22, 48, 18, 33,
+	0, 145, 8, 6, 50, 4, 11, 10, 5, 44, 93, 7, 1, 1, 56, 8,
+	4, 17, 89, 14, 0, 76, 16, 1, 83, 2, 15, 7, 5, 119, 42, 1,
+	37, 0, 3, 0, 0, 1, 7, 1, 2, 14, 55, 3, 8, 50, 28, 57,
+	10, 63, 2, 1, 23, 8, 2, 2, 5, 3, 24, 11, 20, 9, 8, 4,
+	23, 23, 34, 3, 11, 5, 10, 21, 34, 0, 3, 10, 6, 24, 47, 0,
+	1, 3, 7, 0, 0, 25, 5, 0, 121, 3, 49, 5, 45, 3, 51, 3,
+	0, 162, 2, 6, 4, 56, 17, 11, 6, 5, 11, 13, 8, 2, 14,
+};
+
+static const BuiltinConstant builtin_constants[2048] = {
+	{0, 0, 0, 0},
+	{0x2EED9B1CBDD3E7B4, 19028, 18, 708},  // BTN_TRIGGER_HAPPY5
+	{0x8BC415972652D2E6, 1871, 13, 42},  // KEY_LEFTSHIFT
+	{0x547EF57E8996FB84, 14894, 13, 545},  // BTN_DPAD_DOWN
+	{0xF2262349DEE9B491, 7567, 15, 246},  // key_event.WIMAX
+	{0, 0, 0, 0},
+	{0xFA49FDB74C460F7E, 1565, 15, 28},  // key_event.ENTER
+	{0xE445468E8DC14EA3, 20341, 19, 735},  // BTN_TRIGGER_HAPPY32
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x47BDE31D631D9BC5, 11367, 8, 409},  // KEY_SLOW
+	{0x3F3C2FC9782A04FE, 13879, 19, 517},  // key_event.NUMERIC_5
+	{0x49A02B2ECF97844B, 20828, 7, 767},  // KEY_MAX
+	{0x0430A6001EB62F17, 18501, 17, 692},  // KEY_MACRO_PRESET2
+	{0x75CB200B82EAC91B, 11817, 18, 424},  // KEY_GRAPHICSEDITOR
+	{0x766CDECC0AAE84DB, 7674, 14, 256},  // button_event.0
+	{0x6CF26C1221E54D5B, 21910, 10, 26},  // ABS_TILT_X
+	{0x94B82A716681DF87, 3975, 11, 122},  // KEY_HANGUEL
+	{0x069126E16DA24A24, 12983, 15, 471},  // key_event.FN_F6
+	{0xFBA77C12CDAED6E8, 5149, 16, 162},  // KEY_EJECTCLOSECD
+	{0x944812E1E648093D, 10398, 14, 372},  // key_event.ZOOM
+	{0xA6DE4C58C7F798E9, 21427, 16, 5},  // absolute_axis.RZ
+	{0x99FAA04894ED8742, 12442, 22, 440},  // key_event.10CHANNELSUP
+	{0, 0, 0, 0},
+	{0x9B44F12EE1FCD368, 7623, 17, 248},  // key_event.MICMUTE
+	{0x3D6927B7E8C566D3, 9887, 9, 355},  // KEY_CLEAR
+	{0, 0, 0, 0},
+	{0x993FC50037997E11, 13578, 18, 503},  // key_event.BRL_DOT7
+	{0, 0, 0, 0},
+	{0xE269B38E974D46DD, 16317, 11, 623},  // KEY_3D_MODE
+	{0x3F2FBB8C09DAB1AF, 15119, 29, 562},  // key_event.REFRESH_RATE_TOGGLE
+	{0xB9F39C9E0D056469, 20067, 28, 729},  // button_event.TRIGGER_HAPPY26
+	{0xD91481B438CBC912, 2113, 9, 53},  // KEY_SLASH
+	{0, 0, 0, 0},
+	{0x3B98EA21632AF431, 13514, 18, 501},  // key_event.BRL_DOT5
+	{0xB71934B98FA7FB14, 440, 14, 1},  // event_type.KEY
+	{0x153B75F76F188D80, 19000, 27, 707},  // button_event.TRIGGER_HAPPY4
+	{0x13FB40A8BF4D497D, 4477, 15, 141},  // key_event.SETUP
+	{0x19A287D63BD254AA, 1555, 9, 28},  // KEY_ENTER
+	{0x09A6E559488695DD, 6831, 19, 227},  // KEY_SWITCHVIDEOMODE
+	{0xADB534F534732744, 20900, 15, 1},  // relative_axis.Y
+	{0xF6CADECC728E8914, 8914, 10, 314},  // BTN_SELECT
+	{0x394F34EC06EF9A8D, 23829, 7, 8},  // MSC_CNT
+	{0xF6941E31C7807D76, 5833, 13, 185},  // key_event.F15
+	{0xD05711543A1DF7E9, 15647, 23, 608},  // KEY_KBDINPUTASSIST_PREV
+	{0x9DFB8054A1E8281E, 14391, 21, 531},  // key_event.TOUCHPAD_ON
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xDF46D911B80A1297, 6073, 11, 201},  // KEY_PAUSECD
+	{0xDCE9215E76B54AFB, 15007, 14, 560},  // KEY_ALS_TOGGLE
+	{0xC12149ECB26E4B0C, 8825, 15, 310},  // button_event.TL
+	{0xCC566538FE62FB96, 6581, 11, 219},  // KEY_FINANCE
+	{0xB21A8B31AC9A3F5A, 13051, 9, 474},  // KEY_FN_F9
+	{0xA3177366058513F1, 23902, 11, 2},  // LED_SCROLLL
+	{0x3C693AAA11F7C3E1, 5621, 14, 178},  // KEY_SCROLLDOWN
+	{0xE6FA97736A706447, 11460, 18, 412},  // key_event.PREVIOUS
+	{0x32B417E658722099, 8692, 5, 304},  // BTN_A
+	{0x690BFC15A0F6C0FB, 11093, 9, 399},  // KEY_GREEN
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x5A8B8076527AFA8E, 1703, 5, 35},  // KEY_H
+	{0xEF138E76DD525EBF, 6483, 15, 215},  // key_event.EMAIL
+	{0x257A92E257A4CB90, 7283, 14, 241},  // KEY_VIDEO_NEXT
+	{0x2DB7998E15874D7F, 8083, 8, 278},  // BTN_BACK
+	{0, 0, 0, 0},
+	{0xF8394F279DD8D903, 21542, 7, 9},  // ABS_GAS
+	{0x125E086A5E32C25B, 19724, 28, 722},  // button_event.TRIGGER_HAPPY19
+	{0x3D4E215A01A88943, 12921, 9, 469},  // KEY_FN_F4
+	{0x7CB45E22E536A6B4, 15095, 23, 562},  // KEY_REFRESH_RATE_TOGGLE
+	{0x4BBFD23DC404D008, 7695, 14, 257},  // button_event.1
+	{0x0D48F8FFC440CA0A, 976, 18, 0},  // key_event.RESERVED
+	{0xE050F3416D93EC33, 15409, 13, 583},  // KEY_ASSISTANT
+	{0xE4E586F327562F8C, 23876, 9, 1},  // LED_CAPSL
+	{0x95AB19AA1410A68B, 4983, 19, 156},  // key_event.BOOKMARKS
+	{0x0D8140B2F615AE1E, 13482, 18, 500},  // key_event.BRL_DOT4
+	{0xE46EFA34A3E4D541, 937, 25, 16},  // synchronization_event.CNT
+	{0xA5439E4F0DC98E98, 17322, 22, 647},  // key_event.SIDEVU_SONAR
+	{0xB830E7A670F34CB5, 12591, 16, 445},  // KEY_PICKUP_PHONE
+	{0xE5447CE211A0AA2B, 21658, 9, 18},  // ABS_HAT1X
+	{0x8647D52069086018, 23456, 14, 14},  // SW_MUTE_DEVICE
+	{0xB8573D1A81BD8643, 21638, 19, 17},  // absolute_axis.HAT0Y
+	{0x48FF93FB3F8B50F9, 4183, 15, 129},  // key_event.AGAIN
+	{0xC444D371B38D9939, 14165, 19, 525},  // key_event.NUMERIC_B
+	{0xD4888A145491AE79, 23914, 17, 2},  // led_event.SCROLLL
+	{0, 0, 0, 0},
+	{0xC777E3B39B3275E6, 3080, 16, 92},  // key_event.HENKAN
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xF8D22263EE70AA86, 19361, 19, 715},  // BTN_TRIGGER_HAPPY12
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x844100B6C85EB05A, 20537, 19, 739},  // BTN_TRIGGER_HAPPY36
+	{0x0D0CEC47A9C6376D, 712, 14, 32},  // event_type.CNT
+	{0xE9BAA7428C9BFA74, 24328, 8, 1},  // SND_BELL
+	{0xA4BD9226B3B0DC1C, 23589, 16, 16},  // switch_event.MAX
+	{0x52749FF5A7566CF4, 22579, 28, 57},  // absolute_axis.MT_TRACKING_ID
+	{0x7A1486EDD0BE3EC3, 12345, 16, 438},  // KEY_CONTEXT_MENU
+	{0xCC03FBFC02F62150, 17630, 16, 663},  // key_event.MACRO8
+	{0x7EA81510B85F31E0, 9141, 24, 321},  // button_event.TOOL_RUBBER
+	{0x56730DF4DFBE9C5E, 18107, 17, 679},  // key_event.MACRO24
+	{0x065B5C1B921A543E, 8547, 11, 304},  // BTN_GAMEPAD
+	{0xCDA6AB42714C29FF, 16949, 23, 638},  // key_event.MARK_WAYPOINT
+	{0xFE9D3BD827E31F17, 1413, 5, 22},  // KEY_U
+	{0xDD33EB9FF32D4B88, 18065, 11, 678},  // KEY_MACRO23
+	{0, 0, 0, 0},
+	{0x6E6F0A98FF36094A, 16973, 7, 639},  // KEY_SOS
+	{0xE8A9DF92A627D09F, 24476, 17, 1},  // FF_STATUS_PLAYING
+	{0x32ED5A0DE319086F, 9221, 24, 323},  // button_event.TOOL_PENCIL
+	{0xC1F1F3A8853E2D21, 9952, 16, 357},  // key_event.OPTION
+	{0x7579498E4ED867EF, 8062, 20, 277},  // button_event.FORWARD
+	{0xE41448DD90B5A060, 2567, 7, 71},  // KEY_KP7
+	{0, 0, 0, 0},
+	{0x567CC0B62128B193, 15166, 22, 576},  // key_event.BUTTONCONFIG
+	{0x90FB9C447A1CF007, 10720, 14, 384},  // key_event.TAPE
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x65EAEF9A3EB4FFD4, 14861, 11, 544},  // BTN_DPAD_UP
+	{0x6E85CF0796D89122, 1003, 13, 1},  // key_event.ESC
+	{0x8EF3890DA7E3174E, 18379, 27, 689},  // key_event.MACRO_RECORD_STOP
+	{0x29EDEDF37D963F1E, 1685, 5, 34},  // KEY_G
+	{0x9BA76ADC0DFCDC90, 19920, 28, 726},  // button_event.TRIGGER_HAPPY23
+	{0, 0, 0, 0},
+	{0x40660B78B1E3FBA3, 5574, 14, 176},  // key_event.EDIT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xFEE605E0836EA099, 8848, 15, 311},  // button_event.TR
+	{0, 0, 0, 0},
+	{0x3850D8DAF4A21EE9, 6646, 14, 221},  // key_event.SHOP
+	{0x3002818F41A6D9B6, 18095, 11, 679},  // KEY_MACRO24
+	{0xAB5622C3690214CE, 9913, 10, 356},  // KEY_POWER2
+	{0x688FC17CD148D8AA, 2280, 18, 58},  // key_event.CAPSLOCK
+	{0x1AC89F78FFE29202, 11205, 15, 403},  // KEY_CHANNELDOWN
+	{0xA4E42F29A8017FF7, 17885, 11, 672},  // KEY_MACRO17
+	{0, 0, 0, 0},
+	{0x938AD47B67849290, 22355, 28, 52},  // absolute_axis.MT_ORIENTATION
+	{0xECC0ACA98D058833, 21953, 20, 27},  // absolute_axis.TILT_Y
+	{0xC191C78C0AC6B8F5, 10520, 16, 375},  // key_event.SCREEN
+	{0x3E71A5239B2BC4C5, 16012, 18, 614},  // key_event.RIGHT_UP
+	{0xF55F55652F4B89BE, 4846, 24, 153},  // key_event.ROTATE_DISPLAY
+	{0xC11B947232FE4E23, 13981, 19, 520},  // key_event.NUMERIC_8
+	{0x3D5D61E58E2C03F1, 6415, 9, 213},  // KEY_SOUND
+	{0, 0, 0, 0},
+	{0x7A824416F85014DA, 1885, 19, 42},  // key_event.LEFTSHIFT
+	{0xE5451109D0DEEC45, 23613, 16, 17},  // switch_event.CNT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x2B0232BEEED8C374, 3255, 19, 97},  // key_event.RIGHTCTRL
+	{0x443CDAD7A422A0E6, 20312, 28, 734},  // button_event.TRIGGER_HAPPY31
+	{0x593D8D90481EE585, 8559, 20, 304},  // button_event.GAMEPAD
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xE1E6FE72F51D9690, 21070, 9, 8},  // REL_WHEEL
+	{0x6C8F494CA325586A, 2915, 9, 86},  // KEY_102ND
+	{0xDE7B3475DEC15BEF, 22948, 23, 3},  // switch_event.RFKILL_ALL
+	{0, 0, 0, 0},
+	{0x6306C962C31BB238, 17281, 23, 646},  // key_event.CLEARVU_SONAR
+	{0x07CF8B7648F57FC6, 19283, 28, 713},  // button_event.TRIGGER_HAPPY10
+	{0xB77E16F06962B1F2, 2619, 13, 73},  // key_event.KP9
+	{0x3864F9293BB068C1, 11000, 14, 395},  // key_event.LIST
+	{0x10A1DC3D437757DD, 6425, 15, 213},  // key_event.SOUND
+	{0, 0, 0, 0},
+	{0x1AF28EF397E772A9, 21280, 7, 16},  // REL_CNT
+	{0x24886AD2591AFE4D, 6085, 17, 201},  // key_event.PAUSECD
+	{0xD618A1ABA049BF7A, 25311, 18, 127},  // force_feedback.MAX
+	{0xA213B9D9176A4A2D, 21838, 12, 24},  // ABS_PRESSURE
+	{0x7B3E4EA670F37E11, 14729, 17, 540},  // KEY_ATTENDANT_OFF
+	{0xFE832EF90FB507A7, 3069, 10, 92},  // KEY_HENKAN
+	{0x1DD3E5BEEAFF6C44, 14131, 19, 524},  // key_event.NUMERIC_A
+	{0x221E04356D73FF6B, 7533, 8, 246},  // KEY_WWAN
+	{0x8FC24E2C434B6933, 1594, 18, 29},  // key_event.LEFTCTRL
+	{0xBDA422B4B57C423A, 11617, 10, 418},  // KEY_ZOOMIN
+	{0x1F4125BD0E570000, 613, 13, 21},  // event_type.FF
+	{0xD954EE19731C87AE, 10564, 12, 377},  // key_event.TV
+	{0x54967B7A577EDBFD, 8761, 14, 307},  // button_event.X
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x4F57DEE1BD091788, 11103, 15, 399},  // key_event.GREEN
+	{0x08E627AF1F0FFDBF, 11349, 17, 408},  // key_event.RESTART
+	{0x3BC002BD6F1A3F0C, 3191, 19, 95},  // key_event.KPJPCOMMA
+	{0, 0, 0, 0},
+	{0x2C5E82CD061EFB42, 10869, 13, 390},  // key_event.AUX
+	{0x6F88CD5807E43483, 12322, 22, 437},  // key_event.FRAMEFORWARD
+	{0xCC534BDDFB1297F2, 2531, 14, 70},  // KEY_SCROLLLOCK
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x1CE6459D14543DBB, 3595, 10, 110},  // KEY_INSERT
+	{0xD0C7B984B75A8D8B, 19998, 19, 728},  // BTN_TRIGGER_HAPPY25
+	{0xEEC8CC9B2043E4AA, 5869, 7, 187},  // KEY_F17
+	{0x0D1C4B1FBA92FA20, 16067, 11, 616},  // KEY_LEFT_UP
+	{0, 0, 0, 0},
+	{0x95ED6F477455C801, 1365, 11, 19},  // key_event.R
+	{0, 0, 0, 0},
+	{0xAC70E0A7184B5DFE, 853, 11, 3},  // SYN_DROPPED
+	{0, 0, 0, 0},
+	{0xBE582DA1807D4772, 358, 18, 31},  // input_property.MAX
+	{0x3273941CB6C6CD97, 1745, 11, 37},  // key_event.K
+	{0x24C1002BAE4A6FA8, 158, 22, 3},  // input_property.SEMI_MT
+	{0, 0, 0, 0},
+	{0xC8DDB0088400B5DA, 14573, 15, 536},  // KEY_CAMERA_DOWN
+	{0xD0FCA9EDE97B67A0, 16097, 13, 617},  // KEY_LEFT_DOWN
+	{0, 0, 0, 0},
+	{0x8FC01C4EB02BF8B3, 7173, 13, 237},  // KEY_BLUETOOTH
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x6344F6B23A3278DA, 23704, 18, 2},  // misc_event.GESTURE
+	{0x39A51BB9F8E7A0AB, 17825, 11, 670},  // KEY_MACRO15
+	{0xC27D60544F05B579, 9863, 8, 354},  // KEY_GOTO
+	{0x8880392AC1426E2E, 2251, 15, 57},  // key_event.SPACE
+	{0xADA2ECD24F4C9CE6, 13933, 13, 519},  // KEY_NUMERIC_7
+	{0x55FCA0F0E1282886, 10839, 7, 389},  // KEY_DVD
+	{0xC89442E21DAB2ABB, 4922, 22, 154},  // key_event.CYCLEWINDOWS
+	{0x5DEE127E2590A3CB, 5468, 18, 172},  // key_event.HOMEPAGE
+	{0x4D468F148E323E5B, 12170, 20, 432},  // key_event.SPELLCHECK
+	{0xD2F7766F7B86854F, 6815, 15, 226},  // key_event.MEDIA
+	{0xEE3E0FFC4F8F42DE, 3769, 9, 116},  // KEY_POWER
+	{0xA97C57B404DC4198, 20096, 19, 730},  // BTN_TRIGGER_HAPPY27
+	{0x17D3AC2BE205198F, 4763, 10, 152},  // KEY_COFFEE
+	{0xA6B058779AD4BD14, 7758, 14, 260},  // button_event.4
+	{0, 0, 0, 0},
+	{0x99A3414C42F16AC1, 15066, 28, 561},  // key_event.ROTATE_LOCK_TOGGLE
+	{0xB6D89EA298072EB0, 18287, 17, 685},  // key_event.MACRO30
+	{0x9A668569E85904B6, 25050, 23, 92},  // force_feedback.SAW_DOWN
+	{0xF131A7CE686B6E18, 18167, 17, 681},  // key_event.MACRO26
+	{0xD0E16AFAD8F3BC33, 14293, 14, 529},  // KEY_WPS_BUTTON
+	{0x393CA2CB65FF49E2, 592, 14, 20},  // event_type.REP
+	{0x8DAE29D1C341A932, 13450, 18, 499},  // key_event.BRL_DOT3
+	{0x90B3D6AA75BC6374, 25337, 18, 128},  // force_feedback.CNT
+	{0x8E093E41089B231F, 455, 6, 2},  // EV_REL
+	{0, 0, 0, 0},
+	{0x89152C4D60FF2FEC, 24596, 11, 81},  // FF_PERIODIC
+	{0, 0, 0, 0},
+	{0xA7BCE64D294E3E50, 21818, 19, 23},  // absolute_axis.HAT3Y
+	{0, 0, 0, 0},
+	{0x6212592A5AE27246, 10557, 6, 377},  // KEY_TV
+	{0xE264659981599B68, 5602, 18, 177},  // key_event.SCROLLUP
+	{0x7CB1869B129F3AEC, 1999, 11, 47},  // key_event.V
+	{0x104E87F5DE29FBF0, 9332, 14, 326},  // BTN_TOOL_MOUSE
+	{0x2912D20B34E9A6AB, 53, 17, 1},  // INPUT_PROP_DIRECT
+	{0xC03EEBC984253977, 11914, 18, 426},  // key_event.DATABASE
+	{0x59A3439A3F0B6341, 16821, 20, 636},  // KEY_PREVIOUS_ELEMENT
+	{0x9550D28A80F26D09, 3863, 9, 119},  // KEY_PAUSE
+	{0x3D4959B732BEC6FE, 13305, 8, 484},  // KEY_FN_B
+	{0, 0, 0, 0},
+	{0xA2B50610EB817E0C, 21396, 6, 4},  // ABS_RY
+	{0xA74EAC172D272B14, 24428, 17, 0},  // FF_STATUS_STOPPED
+	{0xB8E151C4328DD0E3, 8234, 10, 290},  // BTN_THUMB2
+	{0x07BB8315D17A0321, 9307, 24, 325},  // button_event.TOOL_FINGER
+	{0x0803C3CE935EDF74, 19655, 19, 721},  // BTN_TRIGGER_HAPPY18
+	{0, 0, 0, 0},
+	{0x57BEF92947548B61, 2513, 17, 69},  // key_event.NUMLOCK
+	{0, 0, 0, 0},
+	{0x889B7890C13ACD31, 8529, 17, 303},  // button_event.DEAD
+	{0xDE8D273FEA512635, 23201, 28, 8},  // switch_event.VIDEOOUT_INSERT
+	{0xEDA1E9AA2D29125D, 7963, 10, 274},  // BTN_MIDDLE
+	{0xC5652E05FAA3DB32, 16237, 18, 619},  // KEY_MEDIA_TOP_MENU
+	{0xF2614FB4AF23E935, 4584, 18, 145},  // key_event.SENDFILE
+	{0x2E707CDA2E8698ED, 12869, 9, 467},  // KEY_FN_F2
+	{0x931476DD338FF8D7, 10621, 8, 380},  // KEY_VCR2
+	{0x80EC5F75E924DD9C, 12671, 11, 448},  // KEY_DEL_EOL
+	{0, 0, 0, 0},
+	{0x7FD53C5A01FE6FA7, 5438, 16, 171},  // key_event.CONFIG
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x0CD6AC24DF5F2E4A, 2017, 11, 48},  // key_event.B
+	{0x21C7F38F8CE73C0F, 14514, 24, 534},  // key_event.CAMERA_ZOOMOUT
+	{0, 0, 0, 0},
+	{0xBFF686CB438EC222, 24258, 16, 1},  // repeat_event.MAX
+	{0x7CA6D98333D759A6, 5035, 8, 158},  // KEY_BACK
+	{0x9CDA6945C2D4C5EF, 18981, 18, 707},  // BTN_TRIGGER_HAPPY4
+	{0x9F5AF5466BA342AB, 24380, 7, 7},  // SND_MAX
+	{0xCEDB7F8CDD5E2F9E, 20704, 28, 742},  // button_event.TRIGGER_HAPPY39
+	{0, 0, 0, 0},
+	{0x3314666E4C0A9AF8, 4673, 15, 148},  // key_event.PROG1
+	{0x5C7FAEC99E55AA0E, 22730, 13, 61},  // ABS_MT_TOOL_Y
+	{0, 0, 0, 0},
+	{0xA7EB5C0ADC098D9C, 10367, 21, 372},  // key_event.FULL_SCREEN
+	{0xA7A3DEBCACFD165F, 19871, 28, 725},  // button_event.TRIGGER_HAPPY22
+	{0xB6E9C82C8A9E143A, 10941, 15, 393},  // key_event.VIDEO
+	{0xAFE9D9C711899D4F, 14185, 13, 526},  // KEY_NUMERIC_C
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x745F2D6D6DC2C52E, 16842, 26, 636},  // key_event.PREVIOUS_ELEMENT
+	{0, 0, 0, 0},
+	{0x2E9E907AD02414AC, 377, 14, 32},  // INPUT_PROP_CNT
+	{0x40B17BCB54C984D3, 13209, 8, 480},  // KEY_FN_D
+	{0xC1ABD178A9042417, 6782, 22, 225},  // key_event.BRIGHTNESSUP
+	{0x54762FFAB2099B75, 1095, 11, 6},  // key_event.5
+	{0x656B58B3EB654806, 1125, 5, 8},  // KEY_7
+	{0, 0, 0, 0},
+	{0x255E5E4FEBC395BD, 4723, 13, 150},  // key_event.WWW
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x575AF3EB21AE6197, 13947, 19, 519},  // key_event.NUMERIC_7
+	{0xD6E0B16A95E0196F, 7239, 13, 239},  // key_event.UWB
+	{0x805E798DBFFC0839, 6169, 19, 204},  // key_event.DASHBOARD
+	{0, 0, 0, 0},
+	{0xD8615FB183D8D966, 4099, 19, 126},  // key_event.RIGHTMETA
+	{0xF8D694503AA0DA64, 7710, 5, 258},  // BTN_2
+	{0xB554251842D7B267, 12795, 6, 464},  // KEY_FN
+	{0x0516E75CF131B7F8, 4299, 8, 134},  // KEY_OPEN
+	{0x773D24B425A8B37C, 15227, 11, 578},  // KEY_JOURNAL
+	{0x9E79DA07B4A484AD, 10645, 7, 381},  // KEY_SAT
+	{0x82363F0923CD4219, 3563, 12, 109},  // KEY_PAGEDOWN
+	{0xEEAF95C11A2A9A78, 570, 14, 18},  // event_type.SND
+	{0x70607E30B75D7F34, 19094, 27, 709},  // button_event.TRIGGER_HAPPY6
+	{0, 0, 0, 0},
+	{0x49944C86B8AEAE3C, 3661, 15, 112},  // key_event.MACRO
+	{0xD03DA1073E5DCF31, 738, 28, 0},  // synchronization_event.REPORT
+	{0x77DDAD6DA0A3318C, 14611, 15, 537},  // KEY_CAMERA_LEFT
+	{0x92C1DB4FA2D5521A, 15701, 23, 609},  // KEY_KBDINPUTASSIST_NEXT
+	{0x6B26AB85C66A85CE, 24337, 16, 1},  // sound_event.BELL
+	{0x50A25E1FF5D7AFBB, 1957, 5, 45},  // KEY_X
+	{0x2DB0E2EFE7AF96DC, 7207, 8, 238},  // KEY_WLAN
+	{0x8A2A6A0E6868AD8D, 705, 6, 32},  // EV_CNT
+	{0, 0, 0, 0},
+	{0x0FBF4FA3747FFA74, 20194, 19, 732},  // BTN_TRIGGER_HAPPY29
+	{0x7FBA97243C522C4E, 9815, 6, 352},  // KEY_OK
+	{0xAC77D65BBCA935D4, 8375, 9, 295},  // BTN_BASE2
+	{0x2CAD2FDE67861C85, 18543, 17, 693},  // KEY_MACRO_PRESET3
+	{0x7CA2A3879DA347DE, 20410, 28, 736},  // button_event.TRIGGER_HAPPY33
+	{0, 0, 0, 0},
+	{0xC626D3BD8F292280, 11147, 8, 401},  // KEY_BLUE
+	{0xEF8A67A9FE1BFF36, 21128, 12, 10},  // REL_RESERVED
+	{0x85F7CECD9E759DF5, 13161, 8, 478},  // KEY_FN_1
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x14081418D02D3B8E, 16931, 17, 638},  // KEY_MARK_WAYPOINT
+	{0x2EF7309198ED5799, 14792, 26, 541},  // key_event.ATTENDANT_TOGGLE
+	{0x93ED5AA7ED410061, 11024, 14, 396},  // key_event.MEMO
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xBDBF9431723F0215, 2855, 15, 83},  // key_event.KPDOT
+	{0xA2369A30D04CC555, 21491, 20, 7},  // absolute_axis.RUDDER
+	{0x89D5004C7D208BE7, 10017, 10, 360},  // KEY_VENDOR
+	{0xD51316B04B5F182E, 4031, 7, 124},  // KEY_YEN
+	{0, 0, 0, 0},
+	{0xAEAD5ED9B831992B, 18155, 11, 681},  // KEY_MACRO26
+	{0x78CC397BFB3F4416, 8357, 17, 294},  // button_event.BASE
+	{0x70EE6ED220A8C7FF, 17451, 10, 657},  // KEY_MACRO2
+	{0x41D77E6121879509, 1017, 5, 2},  // KEY_1
+	{0, 0, 0, 0},
+	{0x4D4CFAFDA332B421, 7836, 5, 264},  // BTN_8
+	{0x5DCD8C98A126D22B, 1939, 5, 44},  // KEY_Z
+	{0xADB123CF9A65108A, 16869, 27, 637},  // KEY_AUTOPILOT_ENGAGE_TOGGLE
+	{0xEC89AD4B159CB725, 11657, 17, 419},  // key_event.ZOOMOUT
+	{0xA4B82CDD1D09B3A3, 5119, 11, 161},  // KEY_EJECTCD
+	{0xACB70D584E06EAE8, 8755, 5, 307},  // BTN_X
+	{0x334D5724B9F17A6F, 9072, 17, 320},  // button_event.DIGI
+	{0xD366EB19D2942720, 17807, 17, 669},  // key_event.MACRO14
+	{0x158A7CC4A49EE38D, 6805, 9, 226},  // KEY_MEDIA
+	{0x685021D503B6535F, 21718, 9, 20},  // ABS_HAT2X
+	{0x776E3AA8A0B2A952, 22981, 18, 3},  // switch_event.RADIO
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x1499CDB57197D007, 16981, 13, 639},  // key_event.SOS
+	{0xAA2D170BF0A94A15, 13405, 12, 498},  // KEY_BRL_DOT2
+	{0x84B02F66BCB236BC, 5695, 16, 180},  // KEY_KPRIGHTPAREN
+	{0xC4AE362F397C8C10, 18035, 11, 677},  // KEY_MACRO22
+	{0xA99CB9F7E5AFE59A, 24168, 7, 16},  // LED_CNT
+	{0xDE06A023126F88EB, 16798, 22, 635},  // key_event.NEXT_ELEMENT
+	{0xC57E178C6B6F914F, 10437, 12, 374},  // KEY_KEYBOARD
+	{0x95C13A1192E78650, 17546, 16, 660},  // key_event.MACRO5
+	{0, 0, 0, 0},
+	{0x73E819564679DF61, 7109, 13, 235},  // KEY_DOCUMENTS
+	{0xAA3FDD86940DE9EE, 20938, 6, 3},  // REL_RX
+	{0x29B230C7D06672A5, 13242, 14, 481},  // key_event.FN_E
+	{0xEF3546DC7C5180AB, 21887, 22, 25},  // absolute_axis.DISTANCE
+	{0, 0, 0, 0},
+	{0x277DB9C211CE18AB, 17915, 11, 673},  // KEY_MACRO18
+	{0, 0, 0, 0},
+	{0x93CBD13C238130F1, 21728, 19, 20},  // absolute_axis.HAT2X
+	{0xC2961719D088DC4C, 8501, 18, 299},  // button_event.BASE6
+	{0xFED59F027D73BA79, 4085, 13, 126},  // KEY_RIGHTMETA
+	{0, 0, 0, 0},
+	{0x2FE66389FF0AD139, 1499, 19, 26},  // key_event.LEFTBRACE
+	{0x3A06416239AD6193, 22827, 16, 0},  // switch_event.LID
+	{0x073AC904E1074F09, 14771, 20, 541},  // KEY_ATTENDANT_TOGGLE
+	{0xC7FB57AA4A41A382, 6374, 12, 211},  // key_event.HP
+	{0x2E4DA5DE10A0A958, 23471, 24, 14},  // switch_event.MUTE_DEVICE
+	{0x69CBE90A7F14AA6A, 1291, 13, 15},  // key_event.TAB
+	{0xD1A54699C9E6F574, 21051, 18, 7},  // relative_axis.DIAL
+	{0xA4738CF465646F53, 20916, 5, 2},  // REL_Z
+	{0, 0, 0, 0},
+	{0x07E26BC025E1197D, 5673, 21, 179},  // key_event.KPLEFTPAREN
+	{0x190458B3884C21F9, 11991, 15, 429},  // KEY_ADDRESSBOOK
+	{0x608E09F0F4B6778E, 23412, 16, 13},  // SW_LINEIN_INSERT
+	{0xE257BB4BDB16C585, 10028, 16, 360},  // key_event.VENDOR
+	{0xB0BE0E104C1B5AD0, 10861, 7, 390},  // KEY_AUX
+	{0x2D9D5B43DF8B3814, 6103, 9, 202},  // KEY_PROG3
+	{0xA73E6233BE2A5761, 19047, 27, 708},  // button_event.TRIGGER_HAPPY5
+	{0x9A247F803EECFEAE, 20993, 16, 5},  // relative_axis.RZ
+	{0x6576971B86374B85, 23251, 30, 9},  // switch_event.CAMERA_LENS_COVER
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xDF8D55996B681246, 6351, 15, 210},  // key_event.PRINT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x4AEB74A9B72B45D2, 24700, 11, 84},  // FF_FRICTION
+	{0x747A62BEB36410F8, 19410, 19, 716},  // BTN_TRIGGER_HAPPY13
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xB6B9CD7C436B5C36, 19753, 19, 723},  // BTN_TRIGGER_HAPPY20
+	{0x5A967A24DF60A20A, 11119, 10, 400},  // KEY_YELLOW
+	{0x0E95B9BC8F1BD0A7, 5935, 7, 190},  // KEY_F20
+	{0xA3F97FDAE17F6A73, 14253, 16, 528},  // KEY_CAMERA_FOCUS
+	{0x582ABAB7A65846A1, 2787, 13, 80},  // key_event.KP2
+	{0x6096D3D5F98AC1D8, 18753, 17, 700},  // KEY_KBD_LCD_MENU5
+	{0, 0, 0, 0},
+	{0x34DDF3B0A2B2ABCE, 17423, 10, 656},  // KEY_MACRO1
+	{0x885C1DD3D487475D, 9264, 26, 324},  // button_event.TOOL_AIRBRUSH
+	{0x56B8180C76A42A1A, 15239, 17, 578},  // key_event.JOURNAL
+	{0x64146E47FCC4DD1F, 15274, 22, 579},  // key_event.CONTROLPANEL
+	{0x0573C90995E99C48, 2925, 15, 86},  // key_event.102ND
+	{0x256F3EBDA7DA0BF8, 20836, 13, 767},  // key_event.MAX
+	{0x461BD24B27DD4787, 2633, 11, 74},  // KEY_KPMINUS
+	{0x1FB2093DBA1DDE3C, 10607, 13, 379},  // key_event.VCR
+	{0x8FA36B36EC5F426D, 17563, 10, 661},  // KEY_MACRO6
+	{0xEAC28AC5E24EBFDC, 6155, 13, 204},  // KEY_DASHBOARD
+	{0, 0, 0, 0},
+	{0x8FB7EF600C6A50D1, 23755, 15, 4},  // misc_event.SCAN
+	{0x6C47CB0A85F9F10B, 13170, 14, 478},  // key_event.FN_1
+	{0xDD6AA65EFDD3DA3D, 15784, 34, 610},  // key_event.KBDINPUTASSIST_PREVGROUP
+	{0xE0D9C78B34E585D2, 7469, 25, 244},  // key_event.BRIGHTNESS_ZERO
+	{0xE474D5B0B4ED8DED, 17987, 17, 675},  // key_event.MACRO20
+	{0xFBBB3D761C7FCC50, 16046, 20, 615},  // key_event.RIGHT_DOWN
+	{0xC53FEEA8815E6D3F, 11, 18, 0},  // INPUT_PROP_POINTER
+	{0, 0, 0, 0},
+	{0x1389FE42384372D2, 15297, 13, 580},  // KEY_APPSELECT
+	{0xBBB72DDCD175D797, 17675, 11, 665},  // KEY_MACRO10
+	{0, 0, 0, 0},
+	{0xBF5798A67D64F892, 2211, 11, 56},  // KEY_LEFTALT
+	{0x0F503CE3620B94E5, 9408, 17, 328},  // BTN_TOOL_QUINTTAP
+	{0, 0, 0, 0},
+	{0x7BE204885A14A626, 20047, 19, 729},  // BTN_TRIGGER_HAPPY26
+	{0xF0AAEEF4C6FF04FC, 4149, 8, 128},  // KEY_STOP
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x2156AC47D372A985, 23582, 6, 16},  // SW_MAX
+	{0x581BD67B01221F99, 11516, 14, 414},  // key_event.TEEN
+	{0x1DE5792BC76BBC72, 12256, 14, 435},  // key_event.EURO
+	{0x1A19CCA20A958155, 3957, 17, 122},  // key_event.HANGEUL
+	{0x59A8154903C890E8, 15257, 16, 579},  // KEY_CONTROLPANEL
+	{0, 0, 0, 0},
+	{0x4C9D2C466A927A20, 23852, 8, 0},  // LED_NUML
+	{0, 0, 0, 0},
+	{0x0DED41DCB2C5B195, 19822, 28, 724},  // button_event.TRIGGER_HAPPY21
+	{0x271488DA26C932CB, 3701, 14, 114},  // KEY_VOLUMEDOWN
+	{0, 0, 0, 0},
+	{0x2FD560D43D537A45, 21578, 19, 10},  // absolute_axis.BRAKE
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x052AE6CE2A23908C, 4689, 9, 149},  // KEY_PROG2
+	{0x745BD1AB4C2B1D46, 7594, 16, 247},  // key_event.RFKILL
+	{0xEF14CBC76034F4E6, 4827, 18, 153},  // KEY_ROTATE_DISPLAY
+	{0x4EE322D87F888501, 18017, 17, 676},  // key_event.MACRO21
+	{0x18B46787FB765258, 15443, 16, 585},  // KEY_EMOJI_PICKER
+	{0xBB2862237F5F8A1A, 1131, 11, 8},  // key_event.7
+	{0x163B57EB28E748FD, 4571, 12, 145},  // KEY_SENDFILE
+	{0, 0, 0, 0},
+	{0xCFEF872EB09110DF, 4699, 15, 149},  // key_event.PROG2
+	{0x11C3E4C5EBA4263D, 20878, 15, 0},  // relative_axis.X
+	{0x166459468F8918E0, 13695, 13, 512},  // KEY_NUMERIC_0
+	{0, 0, 0, 0},
+	{0x87F3F622F02D93A2, 0, 5, 0},  // false
+	{0xECCBA347EC589E1E, 10169, 7, 365},  // KEY_EPG
+	{0x16ED27124692FC7B, 6661, 12, 222},  // KEY_ALTERASE
+	{0x87355E54945BB32F, 1179, 5, 11},  // KEY_0
+	{0x76180ABEE5EA6974, 17705, 11, 666},  // KEY_MACRO11
+	{0x4CA2B3E8B348EEED, 15883, 25, 612},  // KEY_KBDINPUTASSIST_ACCEPT
+	{0x87D44EB563C06DD1, 3395, 8, 102},  // KEY_HOME
+	{0xA1BA76F6063B2B5A, 8299, 17, 292},  // button_event.TOP2
+	{0xDC52385155667A54, 10057, 17, 361},  // key_event.ARCHIVE
+	{0x360B070D7911FEB8, 1619, 11, 30},  // key_event.A
+	{0, 0, 0, 0},
+	{0xEB4E9EEF35AC57F2, 21550, 17, 9},  // absolute_axis.GAS
+	{0, 0, 0, 0},
+	{0x47FB0E887007A427, 20872, 5, 0},  // REL_X
+	{0xE6B21EF5FCA54DCD, 1905, 13, 43},  // KEY_BACKSLASH
+	{0, 0, 0, 0},
+	{0xEECB7B454921DEF1, 4225, 8, 131},  // KEY_UNDO
+	{0xE5B0188FF0194F82, 6938, 22, 229},  // key_event.KBDILLUMDOWN
+	{0xE4D0A384F4E96E6E, 6976, 20, 230},  // key_event.KBDILLUMUP
+	{0x227513F721418ACC, 23096, 27, 6},  // switch_event.LINEOUT_INSERT
+	{0x454442EEB066ED4C, 21668, 19, 18},  // absolute_axis.HAT1X
+	{0x9430A79242C02E2D, 20243, 19, 733},  // BTN_TRIGGER_HAPPY30
+	{0xA7C78640C0B5209D, 24538, 25, 1},  // force_feedback_status.MAX
+	{0x75977D25094F8A19, 9626, 18, 334},  // BTN_TOOL_TRIPLETAP
+	{0xCE26A1285BD446EE, 18561, 23, 693},  // key_event.MACRO_PRESET3
+	{0xBD8283F218DE6D36, 5712, 22, 180},  // key_event.KPRIGHTPAREN
+	{0x5384368411D5D004, 1249, 13, 14},  // KEY_BACKSPACE
+	{0x4604EDBDB199DADC, 15999, 12, 614},  // KEY_RIGHT_UP
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x7CBD918915FA9D22, 25262, 14, 96},  // FF_MAX_EFFECTS
+	{0, 0, 0, 0},
+	{0x7C032CAF68EA74D1, 3517, 7, 107},  // KEY_END
+	{0x77E0FB789EAEA1D0, 767, 10, 1},  // SYN_CONFIG
+	{0x90514FE6F6F0C7DF, 11490, 16, 413},  // key_event.DIGITS
+	{0, 0, 0, 0},
+	{0xBEE7E43B7D94BF29, 3576, 18, 109},  // key_event.PAGEDOWN
+	{0x19F17F6E2A321E15, 1727, 11, 36},  // key_event.J
+	{0xC9AFBF8E148F666E, 2645, 17, 74},  // key_event.KPMINUS
+	{0x0C00F440C71A2989, 13281, 8, 483},  // KEY_FN_S
+	{0x2F0F8A5131DE57DC, 22211, 28, 49},  // absolute_axis.MT_TOUCH_MINOR
+	{0xDCCB69AD78285FF8, 3177, 13, 95},  // KEY_KPJPCOMMA
+	{0, 0, 0, 0},
+	{0xC47A772A1349917B, 19851, 19, 725},  // BTN_TRIGGER_HAPPY22
+	{0, 0, 0, 0},
+	{0x42BDBC73E5988A44, 7752, 5, 260},  // BTN_4
+	{0x9B2348080A93B57D, 9515, 10, 331},  // BTN_STYLUS
+	{0xE81CB7CDB6EDAAEB, 20655, 28, 741},  // button_event.TRIGGER_HAPPY38
+	{0x0EC589EF044924F6, 2099, 13, 52},  // key_event.DOT
+	{0, 0, 0, 0},
+	{0xBF5A192A30F7ECB2, 233, 25, 5},  // INPUT_PROP_POINTING_STICK
+	{0x8AAE27E918DAE6D6, 16203, 13, 618},  // KEY_ROOT_MENU
+	{0xB08B5B292CD4CDB9, 2992, 12, 89},  // key_event.RO
+	{0x130F9A8486F01F60, 3825, 15, 118},  // KEY_KPPLUSMINUS
+	{0x4401DCA2D33E0480, 22336, 18, 52},  // ABS_MT_ORIENTATION
+	{0xC441C085C646A216, 7216, 14, 238},  // key_event.WLAN
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x09BFA11A98ED8658, 521, 5, 5},  // EV_SW
+	{0, 0, 0, 0},
+	{0xD21B0E49818FAC33, 18585, 17, 696},  // KEY_KBD_LCD_MENU1
+	{0xD735ABF8EB246C87, 10711, 8, 384},  // KEY_TAPE
+	{0xB41BC6769F153956, 22820, 6, 0},  // SW_LID
+	{0, 0, 0, 0},
+	{0xFDC10F4F3D03979D, 3223, 17, 96},  // key_event.KPENTER
+	{0, 0, 0, 0},
+	{0x4FD591204E459B6C, 1667, 5, 33},  // KEY_F
+	{0x4F9A5C1F7B1E79DC, 18137, 17, 680},  // key_event.MACRO25
+	{0, 0, 0, 0},
+	{0x76FE6B78D87FA745, 24051, 14, 7},  // led_event.MUTE
+	{0x9F82220C662EC5FF, 259, 29, 5},  // input_property.POINTING_STICK
+	{0, 0, 0, 0},
+	{0x2692FA7D43F19A96, 14035, 16, 522},  // KEY_NUMERIC_STAR
+	{0x2DF0DD448798671C, 18407, 22, 690},  // KEY_MACRO_PRESET_CYCLE
+	{0, 0, 0, 0},
+	{0xD2A3DF2A4BAAD4A1, 13899, 13, 518},  // KEY_NUMERIC_6
+	{0x7CFC8B11F9AE1478, 2267, 12, 58},  // KEY_CAPSLOCK
+	{0x8B51E9A77C1404A9, 3344, 18, 100},  // key_event.RIGHTALT
+	{0x27C1E10148F7CABD, 21942, 10, 27},  // ABS_TILT_Y
+	{0, 0, 0, 0},
+	{0x06521CB455E63CEE, 10824, 14, 388},  // key_event.TEXT
+	{0xF400BD9DF0B70EC7, 21080, 19, 8},  // relative_axis.WHEEL
+	{0x9BA08E41BB458D50, 3548, 14, 108},  // key_event.DOWN
+	{0x2BE67ABAD5D53EE8, 5089, 11, 160},  // KEY_CLOSECD
+	{0, 0, 0, 0},
+	{0x9C433225A7F57130, 21598, 9, 16},  // ABS_HAT0X
+	{0, 0, 0, 0},
+	{0x210BA6F0BFD9E048, 4905, 16, 154},  // KEY_CYCLEWINDOWS
+	{0x495C7F57690B17FE, 22025, 20, 32},  // absolute_axis.VOLUME
+	{0x2C5605B966A05A10, 16405, 21, 625},  // key_event.STOP_RECORD
+	{0x6B4D2CAA89BD38D2, 7794, 5, 262},  // BTN_6
+	{0x8EE326C4CD02A0DD, 3686, 14, 113},  // key_event.MUTE
+	{0xC550444018A23DC6, 14553, 19, 535},  // key_event.CAMERA_UP
+	{0x1593E02CD722F769, 6551, 11, 218},  // KEY_CONNECT
+	{0x5E4A77525F3DFBE5, 24954, 23, 89},  // force_feedback.TRIANGLE
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x3D98CC41C6000045, 7994, 8, 275},  // BTN_SIDE
+	{0x764967A66E12DDE9, 5351, 10, 168},  // KEY_REWIND
+	{0x8CB4EE72459D1337, 6219, 9, 206},  // KEY_CLOSE
+	{0, 0, 0, 0},
+	{0x1B85E022A3098797, 13133, 10, 477},  // KEY_FN_F12
+	{0x989C068E1D47B280, 12731, 12, 450},  // KEY_INS_LINE
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xE6BE77AA2A1A9C4E, 11570, 20, 416},  // key_event.VIDEOPHONE
+	{0xBA2224361405E067, 24920, 21, 88},  // force_feedback.SQUARE
+	{0, 0, 0, 0},
+	{0x524D00F5166B2336, 8462, 9, 298},  // BTN_BASE5
+	{0xCA06A2661A5D8C17, 13661, 13, 506},  // KEY_BRL_DOT10
+	{0xE1E7CCE9B48B3867, 11391, 11, 410},  // KEY_SHUFFLE
+	{0, 0, 0, 0},
+	{0x853F0C98FEBADBAB, 2985, 6, 89},  // KEY_RO
+	{0, 0, 0, 0},
+	{0xA05F0A2A1F8EF0EC, 10771, 15, 386},  // key_event.TUNER
+	{0xA199964E5ADF1C2A, 5362, 16, 168},  // key_event.REWIND
+	{0xFD23D0EBC179715E, 4419, 8, 139},  // KEY_MENU
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x1C1B42C3076E66A5, 21628, 9, 17},  // ABS_HAT0Y
+	{0xA44E9EB9B48B6C5E, 21109, 18, 9},  // relative_axis.MISC
+	{0xA29387A14B993861, 14747, 23, 540},  // key_event.ATTENDANT_OFF
+	{0xAE18BCBA11B95838, 2740, 16, 78},  // key_event.KPPLUS
+	{0x1592F7CB6ECEFD4E, 11531, 8, 415},  // KEY_TWEN
+	{0x3063822F7F07A8B6, 2871, 18, 85},  // KEY_ZENKAKUHANKAKU
+	{0x59F3D536E419755C, 9043, 19, 318},  // button_event.THUMBR
+	{0xBC04A59D3A34E182, 21974, 14, 28},  // ABS_TOOL_WIDTH
+	{0xF011814D43B61874, 895, 7, 15},  // SYN_MAX
+	{0, 0, 0, 0},
+	{0x9EED884A193E5A6A, 4715, 7, 150},  // KEY_WWW
+	{0x843898813FB4F02A, 25330, 6, 128},  // FF_CNT
+	{0xC50E15960C16DDE8, 13116, 16, 476},  // key_event.FN_F11
+	{0x2D7591995AF46ACC, 11278, 14, 405},  // key_event.LAST
+	{0x0319686CBD607176, 5487, 11, 173},  // KEY_REFRESH
+	{0x41A684A2229FFBD9, 1637, 11, 31},  // key_event.S
+	{0xEC6E966677591003, 24802, 7, 87},  // FF_RAMP
+	{0x8F8437869E1FEAAD, 23806, 7, 7},  // MSC_MAX
+	{0xC4FC3C825ABECECB, 11447, 12, 412},  // KEY_PREVIOUS
+	{0x0B0D2668EFFA72F9, 19773, 28, 723},  // button_event.TRIGGER_HAPPY20
+	{0, 0, 0, 0},
+	{0xBFC036B270F85DD5, 7821, 14, 263},  // button_event.7
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x4C12C8B5DD86DC37, 23641, 17, 0},  // misc_event.SERIAL
+	{0xA6E36310291EBE80, 10450, 18, 374},  // key_event.KEYBOARD
+	{0xEC510D338AB027C9, 21254, 7, 15},  // REL_MAX
+	{0x9F96C09E9C6A6329, 18430, 28, 690},  // key_event.MACRO_PRESET_CYCLE
+	{0x5E0D0C96269BDBF2, 17574, 16, 661},  // key_event.MACRO6
+	{0xD3E1EC65F842746F, 8740, 14, 306},  // button_event.C
+	{0xA350D7C7490BDE3D, 9969, 8, 358},  // KEY_INFO
+	{0xB9CF5169F6AA56DE, 7800, 14, 262},  // button_event.6
+	{0x0DE0881FBA496427, 20586, 19, 740},  // BTN_TRIGGER_HAPPY37
+	{0x0DDBB5A6FC6703CF, 24042, 8, 7},  // LED_MUTE
+	{0, 0, 0, 0},
+	{0x23A3923D2779DB0E, 10306, 18, 370},  // key_event.SUBTITLE
+	{0xA6EE767CEDC1FB6A, 7495, 15, 245},  // KEY_DISPLAY_OFF
+	{0x80DEBA0D437A8667, 18477, 23, 691},  // key_event.MACRO_PRESET1
+	{0x2151C5133E6E0504, 2139, 14, 54},  // KEY_RIGHTSHIFT
+	{0x924E1DE04FD6B663, 19675, 28, 721},  // button_event.TRIGGER_HAPPY18
+	{0, 0, 0, 0},
+	{0xE268B0D372D31B32, 12895, 9, 468},  // KEY_FN_F3
+	{0x247DA278C1729116, 24404, 7, 8},  // SND_CNT
+	{0xF3647ED4DC9635DB, 9579, 18, 333},  // BTN_TOOL_DOUBLETAP
+	{0x23E8E31C8D61A3F8, 16500, 16, 628},  // key_event.UNMUTE
+	{0x1B486D0199CC9319, 16296, 20, 622},  // key_event.AUDIO_DESC
+	{0x95E2CB3F75D05753, 7123, 19, 235},  // key_event.DOCUMENTS
+	{0, 0, 0, 0},
+	{0x770A03DEB8AEB6E2, 7085, 8, 234},  // KEY_SAVE
+	{0x67792D2E3147B0B1, 14945, 22, 546},  // button_event.DPAD_LEFT
+	{0x078F2D46E9141607, 11479, 10, 413},  // KEY_DIGITS
+	{0xB9ACF8335FEEB58E, 9453, 11, 329},  // BTN_STYLUS3
+	{0xDD915FEDD08859ED, 10469, 16, 375},  // KEY_ASPECT_RATIO
+	{0, 0, 0, 0},
+	{0x8DE196CBC1FC86E4, 3606, 16, 110},  // key_event.INSERT
+	{0xEF63C8E7AF80BD82, 3037, 12, 91},  // KEY_HIRAGANA
+	{0, 0, 0, 0},
+	{0x0CA557B0A8255308, 5323, 10, 167},  // KEY_RECORD
+	{0x175ED6F776531048, 3945, 11, 122},  // KEY_HANGEUL
+	{0xE4D0F9A63A764662, 9125, 15, 321},  // BTN_TOOL_RUBBER
+	{0, 0, 0, 0},
+	{0x96FBAD6FE15FBB53, 6851, 25, 227},  // key_event.SWITCHVIDEOMODE
+	{0, 0, 0, 0},
+	{0x2E9A9FA7C136B4AC, 7779, 14, 261},  // button_event.5
+	{0xC3A6A5D717928127, 23630, 10, 0},  // MSC_SERIAL
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xB28A7BFCC6308E0F, 1449, 5, 24},  // KEY_O
+	{0xA8BBE12FA55D3954, 11300, 12, 406},  // key_event.AB
+	{0x83CC26E3CA1764E3, 19626, 28, 720},  // button_event.TRIGGER_HAPPY17
+	{0x8DACE29581E3B28D, 1077, 11, 5},  // key_event.4
+	{0xED97D906D8022D0B, 3467, 8, 105},  // KEY_LEFT
+	{0xDE0A79DBC3380F4B, 23814, 14, 7},  // misc_event.MAX
+	{0x46FEE009FFE004B8, 5016, 18, 157},  // key_event.COMPUTER
+	{0x0FB5C61DD0B4F853, 11039, 12, 397},  // KEY_CALENDAR
+	{0xBB5E3EC90FC34E8E, 20508, 28, 738},  // button_event.TRIGGER_HAPPY35
+	{0x70E5D9E9E3663451, 13194, 14, 479},  // key_event.FN_2
+	{0x740369211574354E, 8150, 21, 288},  // button_event.JOYSTICK
+	{0x88714768D711D578, 12520, 16, 442},  // key_event.IMAGES
+	{0x5F4BC598076E1F6D, 14015, 19, 521},  // key_event.NUMERIC_9
+	{0xE7DD9EA27151CD50, 21208, 17, 12},  // REL_HWHEEL_HI_RES
+	{0, 0, 0, 0},
+	{0x91F194BD01515A6D, 14627, 21, 537},  // key_event.CAMERA_LEFT
+	{0x68659E89C4CCF631, 1323, 5, 17},  // KEY_W
+	{0xAE740256D4505329, 20018, 28, 728},  // button_event.TRIGGER_HAPPY25
+	{0xDD5A401D604F5087, 10221, 13, 367},  // key_event.MHP
+	{0x3C74BBCCA3D8C83E, 18245, 11, 684},  // KEY_MACRO29
+	{0x668211F57E9114FC, 2419, 6, 65},  // KEY_F7
+	{0xB518EB513DBF7A7F, 5943, 13, 190},  // key_event.F20
+	{0x7454E52835C35BE5, 865, 29, 3},  // synchronization_event.DROPPED
+	{0x235935047142DFE3, 12826, 16, 465},  // key_event.FN_ESC
+	{0xF32B775AF0710D5D, 22384, 17, 53},  // ABS_MT_POSITION_X
+	{0x4417B17501520960, 23785, 20, 5},  // misc_event.TIMESTAMP
+	{0xCF47A25410C2DDF8, 6009, 13, 193},  // key_event.F23
+	{0, 0, 0, 0},
+	{0x8874217C6F89EFD4, 13061, 15, 474},  // key_event.FN_F9
+	{0, 0, 0, 0},
+	{0x2E1754E2CD852B6D, 10002, 14, 359},  // key_event.TIME
+	{0x70330AF30C1F9ED2, 22046, 8, 40},  // ABS_MISC
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x10AD03CCF857A61E, 9001, 10, 317},  // BTN_THUMBL
+	{0, 0, 0, 0},
+	{0x45FCB67F8A60A8CA, 114, 24, 2},  // input_property.BUTTONPAD
+	{0x24FD03AB77AC1BA4, 8273, 16, 291},  // button_event.TOP
+	{0x73CFEA0D315F5C12, 2035, 11, 49},  // key_event.N
+	{0xE1CF1AAC53223398, 14199, 19, 526},  // key_event.NUMERIC_C
+	{0x5B30291C49C73194, 10931, 9, 393},  // KEY_VIDEO
+	{0x721DAE119AF788F3, 23886, 15, 1},  // led_event.CAPSL
+	{0, 0, 0, 0},
+	{0x44D6C0A8DCC16925, 17305, 16, 647},  // KEY_SIDEVU_SONAR
+	{0x2B3EB34FD2D429A4, 25016, 21, 91},  // force_feedback.SAW_UP
+	{0, 0, 0, 0},
+	{0x6855A02D04DB45B5, 3476, 14, 105},  // key_event.LEFT
+	{0xA7745EDF4709BA0A, 12285, 19, 436},  // key_event.FRAMEBACK
+	{0xD5049AC047263FA0, 25202, 19, 96},  // force_feedback.GAIN
+	{0, 0, 0, 0},
+	{0x3CB33C5EBBA9A08B, 17717, 17, 666},  // key_event.MACRO11
+	{0, 0, 0, 0},
+	{0x41632904320F888B, 22520, 14, 56},  // ABS_MT_BLOB_ID
+	{0xDD6D55E4023D4EFA, 8328, 19, 293},  // button_event.PINKIE
+	{0xA21652E9A5B3400F, 3841, 21, 118},  // key_event.KPPLUSMINUS
+	{0, 0, 0, 0},
+	{0xF5B9F776254FAA07, 23932, 11, 3},  // LED_COMPOSE
+	{0x3990BADBA760C51D, 2707, 7, 77},  // KEY_KP6
+	{0x56242A24E3EDD5E4, 11376, 14, 409},  // key_event.SLOW
+	{0x39F69FE5B010B545, 4131, 17, 127},  // key_event.COMPOSE
+	{0x57F83EB58923FA73, 16079, 17, 616},  // key_event.LEFT_UP
+	{0x2C307F98E7CA5B34, 24190, 9, 0},  // REP_DELAY
+	{0x5D40F368303ABA0E, 21522, 19, 8},  // absolute_axis.WHEEL
+	{0, 0, 0, 0},
+	{0xD2CF2A9E47BD3C9A, 12155, 14, 432},  // KEY_SPELLCHECK
+	{0, 0, 0, 0},
+	{0x174D0B714D9335E4, 12631, 16, 446},  // KEY_HANGUP_PHONE
+	{0xCCD0C3E1FFA94041, 10191, 7, 366},  // KEY_PVR
+	{0xC73835BBB7BCA138, 19216, 18, 712},  // BTN_TRIGGER_HAPPY9
+	{0, 0, 0, 0},
+	{0xC949C33FA4C07198, 20969, 16, 4},  // relative_axis.RY
+	{0x78F866D152B8AC60, 9835, 10, 353},  // KEY_SELECT
+	{0, 0, 0, 0},
+	{0x2D85215648C5DDF9, 2801, 7, 81},  // KEY_KP3
+	{0, 0, 0, 0},
+	{0x26541A1AF6B0E8D9, 7253, 11, 240},  // KEY_UNKNOWN
+	{0xAD441706040B4202, 2439, 6, 66},  // KEY_F8
+	{0x80CB81EEF381084F, 14430, 22, 532},  // key_event.TOUCHPAD_OFF
+	{0x59D48407665D4BC9, 23971, 14, 4},  // led_event.KANA
+	{0x85181F3E53BC3B6F, 8205, 9, 289},  // BTN_THUMB
+	{0xCF9EF5B89F5871FD, 4395, 8, 138},  // KEY_HELP
+	{0xB299BBBE1F566FE8, 23861, 14, 0},  // led_event.NUML
+	{0x3369E305A293AFD3, 23124, 23, 7},  // SW_JACK_PHYSICAL_INSERT
+	{0x8DC50617D2AD1F32, 23078, 17, 6},  // SW_LINEOUT_INSERT
+	{0xFBF989722AA7599E, 634, 14, 22},  // event_type.PWR
+	{0xFA1ADA30B7C53970, 5272, 22, 165},  // key_event.PREVIOUSSONG
+	{0, 0, 0, 0},
+	{0x721865839CB6E9E8, 5657, 15, 179},  // KEY_KPLEFTPAREN
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x2739CD5433A344C4, 7916, 17, 272},  // button_event.LEFT
+	{0xE480740446D328C9, 11878, 22, 425},  // key_event.PRESENTATION
+	{0x80928509967E863F, 9181, 23, 322},  // button_event.TOOL_BRUSH
+	{0x9413AFEB0AE053BC, 2223, 17, 56},  // key_event.LEFTALT
+	{0x03A0BC68CECE29B0, 9347, 23, 326},  // button_event.TOOL_MOUSE
+	{0x54D3B9670657394C, 20459, 28, 737},  // button_event.TRIGGER_HAPPY34
+	{0x93DBE2B01118F9E4, 17144, 26, 643},  // key_event.DUAL_RANGE_RADAR
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x34E3911D88C0748F, 7187, 19, 237},  // key_event.BLUETOOTH
+	{0x334DB7FE60633640, 8665, 8, 308},  // BTN_WEST
+	{0, 0, 0, 0},
+	{0x071E29349F7F7073, 4547, 8, 144},  // KEY_FILE
+	{0xBD3D7703E8FC838D, 16639, 27, 632},  // key_event.ONSCREEN_KEYBOARD
+	{0x66DA52B3E7BE4275, 3050, 18, 91},  // key_event.HIRAGANA
+	{0x5CBC7CB6F94B81A4, 6398, 16, 212},  // key_event.CAMERA
+	{0x885E8ED9BDE739EC, 1185, 11, 11},  // key_event.0
+	{0xD87B6FA32FD86FA3, 23298, 25, 10},  // switch_event.KEYPAD_SLIDE
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xE8F9917B8D773746, 4747, 15, 151},  // key_event.MSDOS
+	{0, 0, 0, 0},
+	{0x305358F61AFF3F34, 14539, 13, 535},  // KEY_CAMERA_UP
+	{0xBDEC9F3D9176C1EA, 15967, 31, 613},  // key_event.KBDINPUTASSIST_CANCEL
+	{0, 0, 0, 0},
+	{0xD7C759F98FA7A2B3, 8974, 8, 316},  // BTN_MODE
+	{0x215AE63256EFF977, 1919, 19, 43},  // key_event.BACKSLASH
+	{0xAF0398887BB48589, 1789, 19, 39},  // key_event.SEMICOLON
+	{0x20FE62CE7F1A7ADD, 7773, 5, 261},  // BTN_5
+	{0xF4EB25F9A96341C7, 15725, 29, 609},  // key_event.KBDINPUTASSIST_NEXT
+	{0x2CCFD93B02E8044D, 17189, 23, 644},  // key_event.RADAR_OVERLAY
+	{0x529F2424FAA27C6E, 21181, 26, 11},  // relative_axis.WHEEL_HI_RES
+	{0, 0, 0, 0},
+	{0x97B76A56C2EF45BD, 5526, 14, 174},  // key_event.EXIT
+	{0x222150ED774BBFA7, 1655, 11, 32},  // key_event.D
+	{0xE13C72CC2085F660, 11015, 8, 396},  // KEY_MEMO
+	{0x5F52045ECA2EB524, 15311, 19, 580},  // key_event.APPSELECT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x9D1BA8A275F58749, 17434, 16, 656},  // key_event.MACRO1
+	{0x27F7F47921E180D0, 411, 6, 0},  // EV_SYN
+	{0x6B36FA04A0003027, 10389, 8, 372},  // KEY_ZOOM
+	{0, 0, 0, 0},
+	{0x20705D61BBFF9787, 25150, 15, 93},  // FF_WAVEFORM_MAX
+	{0x84608C49678780C8, 8797, 5, 309},  // BTN_Z
+	{0x72E5E777364B2980, 12081, 23, 431},  // key_event.DISPLAYTOGGLE
+	{0, 0, 0, 0},
+	{0x0299185F84427CB5, 16467, 7, 627},  // KEY_VOD
+	{0xE049C1FDAA3AD035, 7731, 5, 259},  // BTN_3
+	{0xCDE2B9DDB5A1228C, 8172, 11, 288},  // BTN_TRIGGER
+	{0, 0, 0, 0},
+	{0x34A4609331448BF3, 8646, 18, 307},  // button_event.NORTH
+	{0x269A56E4BE4DABC0, 11779, 15, 423},  // KEY_SPREADSHEET
+	{0, 0, 0, 0},
+	{0xD1D09B657B2FAAC1, 15622, 24, 593},  // key_event.BRIGHTNESS_MAX
+	{0xDCA60A073371ADEF, 2949, 13, 87},  // key_event.F11
+	{0, 0, 0, 0},
+	{0xCB0B4BCB91F182B5, 13811, 19, 515},  // key_event.NUMERIC_3
+	{0x72D8E0A875AE05A0, 9846, 16, 353},  // key_event.SELECT
+	{0x7523C67F33D348CA, 20390, 19, 736},  // BTN_TRIGGER_HAPPY33
+	{0xEE4DB4FD5292C0F3, 7265, 17, 240},  // key_event.UNKNOWN
+	{0xC8FE1C56EAE45D26, 6563, 17, 218},  // key_event.CONNECT
+	{0x53F8569B7C854863, 1305, 5, 16},  // KEY_Q
+	{0xE90CAA697207F5EF, 1613, 5, 30},  // KEY_A
+	{0, 0, 0, 0},
+	{0x3CD5DD45C9E360E1, 71, 21, 1},  // input_property.DIRECT
+	{0xCA6E7E2543311111, 12683, 17, 448},  // key_event.DEL_EOL
+	{0x197D539BDBFA5253, 13233, 8, 481},  // KEY_FN_E
+	{0x6D53EEF82399C07C, 24644, 23, 82},  // force_feedback.CONSTANT
+	{0x1F680403FB2862C7, 24712, 23, 84},  // force_feedback.FRICTION
+	{0x659A272E05B3DBCD, 4493, 9, 142},  // KEY_SLEEP
+	{0xE5A54F898203AE7D, 11933, 8, 427},  // KEY_NEWS
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x11333CA548CA8C9C, 1757, 5, 38},  // KEY_L
+	{0xFB0E46AF9905AB27, 3145, 12, 94},  // KEY_MUHENKAN
+	{0x4122C102F431F681, 5295, 10, 166},  // KEY_STOPCD
+	{0xE4D2F15202351CCB, 12763, 12, 451},  // KEY_DEL_LINE
+	{0, 0, 0, 0},
+	{0xDDB7411DD790296E, 7021, 9, 232},  // KEY_REPLY
+	{0x3DD811818AF54A6B, 23837, 14, 8},  // misc_event.CNT
+	{0x68BD1D903707C1E8, 18771, 23, 700},  // key_event.KBD_LCD_MENU5
+	{0x422CC8976CBA0AEC, 9924, 16, 356},  // key_event.POWER2
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xAFC79F2D4A675451, 22972, 8, 3},  // SW_RADIO
+	{0x6D4BA7C7B48C572A, 17263, 17, 646},  // KEY_CLEARVU_SONAR
+	{0x835AB493F8CBA2DC, 2779, 7, 80},  // KEY_KP2
+	{0, 0, 0, 0},
+	{0xD13B40270BE2B973, 3716, 20, 114},  // key_event.VOLUMEDOWN
+	{0x94BAC457E118F212, 10957, 13, 394},  // KEY_DIRECTORY
+	{0xAB0B1BE404F77D76, 23387, 24, 12},  // switch_event.ROTATE_LOCK
+	{0x4E03303BF04DEA34, 14589, 21, 536},  // key_event.CAMERA_DOWN
+	{0x18622CD9199B7C61, 5202, 18, 163},  // key_event.NEXTSONG
+	{0x6D9D0A82C56979C6, 24024, 17, 6},  // led_event.SUSPEND
+	{0xD06AB3CB63E6051B, 6307, 13, 209},  // KEY_BASSBOOST
+	{0x1AEB44795AE03147, 12537, 23, 444},  // KEY_NOTIFICATION_CENTER
+	{0x0C590BC9476795A4, 21608, 19, 16},  // absolute_axis.HAT0X
+	{0xDDBC38D45EF26FDC, 6001, 7, 193},  // KEY_F23
+	{0x810192C0334C000F, 17507, 10, 659},  // KEY_MACRO4
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xEC6432C962461EB6, 19900, 19, 726},  // BTN_TRIGGER_HAPPY23
+	{0x5AD5853ED6A67CB4, 17358, 18, 648},  // key_event.NAV_INFO
+	{0xD6783010C57D5218, 12509, 10, 442},  // KEY_IMAGES
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xA7FFBF194CFD8B84, 16897, 33, 637},  // key_event.AUTOPILOT_ENGAGE_TOGGLE
+	{0xA717B29635D736F0, 21758, 19, 21},  // absolute_axis.HAT2Y
+	{0x12AA2E6604D00737, 22859, 24, 1},  // switch_event.TABLET_MODE
+	{0x760ECCFECBDF795D, 3873, 15, 119},  // key_event.PAUSE
+	{0, 0, 0, 0},
+	{0xE870F0892D7CC39B, 10698, 12, 383},  // key_event.CD
+	{0x2FB286FEFF65D778, 19802, 19, 724},  // BTN_TRIGGER_HAPPY21
+	{0x8E44EC8249B8660F, 4284, 14, 133},  // key_event.COPY
+	{0x74CF73B239FE0F95, 21328, 5, 1},  // ABS_Y
+	{0x7BEB57FEEFBC5C9D, 11243, 9, 404},  // KEY_FIRST
+	{0x18C3ABB987031E8F, 13035, 15, 473},  // key_event.FN_F8
+	{0, 0, 0, 0},
+	{0xD2B661B2FA95EB31, 8674, 17, 308},  // button_event.WEST
+	{0x3C55D1860F7DB1E4, 11171, 13, 402},  // KEY_CHANNELUP
+	{0, 0, 0, 0},
+	{0xF598501E3D930D72, 4737, 9, 151},  // KEY_MSDOS
+	{0x1B3B0FD13BD5A019, 9465, 20, 329},  // button_event.STYLUS3
+	{0x50F6C69A18EA6FDA, 22666, 25, 59},  // absolute_axis.MT_DISTANCE
+	{0xD4BF616A33F30A50, 10847, 13, 389},  // key_event.DVD
+	{0x15A712A23531017A, 2053, 11, 50},  // key_event.M
+	{0, 0, 0, 0},
+	{0xBA996F827391BA5C, 4308, 14, 134},  // key_event.OPEN
+	{0xF4029F40CE8AFE64, 4954, 14, 155},  // key_event.MAIL
+	{0, 0, 0, 0},
+	{0x9A717F3650B18F67, 13629, 12, 505},  // KEY_BRL_DOT9
+	{0x14ED94BB81DFBBC9, 18603, 23, 696},  // key_event.KBD_LCD_MENU1
+	{0, 0, 0, 0},
+	{0x31AA546FEB854E69, 8864, 7, 312},  // BTN_TL2
+	{0xFB71FB89C65D9E32, 18627, 17, 697},  // KEY_KBD_LCD_MENU2
+	{0x8C1061EAB18FBE62, 22259, 28, 50},  // absolute_axis.MT_WIDTH_MAJOR
+	{0x8107EF9FC9FC0D16, 3623, 10, 111},  // KEY_DELETE
+	{0x01F7DC55469349CB, 20292, 19, 734},  // BTN_TRIGGER_HAPPY31
+	{0x87024593536FE60D, 649, 12, 23},  // EV_FF_STATUS
+	{0, 0, 0, 0},
+	{0x0B8F6B3529A3980B, 16693, 31, 633},  // key_event.PRIVACY_SCREEN_TOGGLE
+	{0xA14EE1E52E028F0B, 3795, 11, 117},  // KEY_KPEQUAL
+	{0x11B38EB7D910244C, 13329, 18, 485},  // KEY_FN_RIGHT_SHIFT
+	{0x879CDE6D616A0D38, 17687, 17, 665},  // key_event.MACRO10
+	{0x1A74BEB16FA5406B, 14837, 23, 542},  // key_event.LIGHTS_TOGGLE
+	{0x22F03F53DD79C238, 1023, 11, 2},  // key_event.1
+	{0, 0, 0, 0},
+	{0xE76BDF952CAE9874, 24524, 13, 1},  // FF_STATUS_MAX
+	{0x0F17E48ED2CFDE20, 1739, 5, 37},  // KEY_K
+	{0xFFA269417C9E3FE2, 17658, 16, 664},  // key_event.MACRO9
+	{0xE2A294C8EC9ED456, 1963, 11, 45},  // key_event.X
+	{0x44121B6D2DE10670, 6534, 16, 217},  // key_event.SEARCH
+	{0, 0, 0, 0},
+	{0xD25FACAA400AE8D1, 17345, 12, 648},  // KEY_NAV_INFO
+	{0x30D77755C6827147, 1855, 15, 41},  // key_event.GRAVE
+	{0x5BDBB490D0F37090, 7650, 17, 256},  // button_event.MISC
+	{0x3F8676582B3BF5CC, 22560, 18, 57},  // ABS_MT_TRACKING_ID
+	{0x799AAD0AFC0C5D47, 13610, 18, 504},  // key_event.BRL_DOT8
+	{0xB1A99C43C18712E0, 13546, 18, 502},  // key_event.BRL_DOT6
+	{0xFC736005A838AE59, 4663, 9, 148},  // KEY_PROG1
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x7DF3A544872506EC, 10235, 12, 368},  // KEY_LANGUAGE
+	{0x8FFEC643BEA0C69F, 10486, 22, 375},  // key_event.ASPECT_RATIO
+	{0, 0, 0, 0},
+	{0x9CA2EB9AED9E0899, 11709, 17, 421},  // KEY_WORDPROCESSOR
+	{0x7BD0E20CDF970433, 12776, 18, 451},  // key_event.DEL_LINE
+	{0, 0, 0, 0},
+	{0x4276694423A1FE90, 2065, 9, 51},  // KEY_COMMA
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xB8415B9811E0B1E3, 7006, 14, 231},  // key_event.SEND
+	{0xB80EE070A4F0CB98, 3987, 17, 122},  // key_event.HANGUEL
+	{0x3F2B6D388C88C297, 8925, 19, 314},  // button_event.SELECT
+	{0x92E0100A06263849, 21306, 5, 0},  // ABS_X
+	{0x6F83EB72EEBD1EDD, 4015, 15, 123},  // key_event.HANJA
+	{0, 0, 0, 0},
+	{0x4EB8384E0CD38A3E, 19122, 18, 710},  // BTN_TRIGGER_HAPPY7
+	{0x776D2661D3C5C1CA, 14495, 18, 534},  // KEY_CAMERA_ZOOMOUT
+	{0xAD559E6BD04F7D41, 8385, 18, 295},  // button_event.BASE2
+	{0, 0, 0, 0},
+	{0x2147DCE7D84F731C, 17867, 17, 671},  // key_event.MACRO16
+	{0x2F54C774744400F2, 18275, 11, 685},  // KEY_MACRO30
+	{0x2AF4AEEC1B5039F6, 18357, 21, 689},  // KEY_MACRO_RECORD_STOP
+	{0x6146A86ED55A00C1, 11645, 11, 419},  // KEY_ZOOMOUT
+	{0x18208A5F87E1C85A, 2011, 5, 48},  // KEY_B
+	{0xBDF61CA35449A340, 1824, 20, 40},  // key_event.APOSTROPHE
+	{0x771741F9E21A7CDE, 21512, 9, 8},  // ABS_WHEEL
+	{0, 0, 0, 0},
+	{0xB48D797B79D1FC52, 4275, 8, 133},  // KEY_COPY
+	{0xF96AAE451577FF53, 23000, 20, 4},  // SW_MICROPHONE_INSERT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x8184375D25B0D9C0, 3097, 20, 93},  // KEY_KATAKANAHIRAGANA
+	{0xD2EE002586B32CDA, 11507, 8, 414},  // KEY_TEEN
+	{0, 0, 0, 0},
+	{0x8E8D31767750076F, 12402, 22, 439},  // key_event.MEDIA_REPEAT
+	{0xDB174B63B9217FEE, 20733, 19, 743},  // BTN_TRIGGER_HAPPY40
+	{0x6400368DF3E27445, 15541, 17, 586},  // key_event.DICTATE
+	{0x8FD22CBAA160E810, 25084, 21, 93},  // force_feedback.CUSTOM
+	{0xB4F5EC7ADD2E63A5, 11601, 15, 417},  // key_event.GAMES
+	{0x216B882C7851BA42, 19235, 27, 712},  // button_event.TRIGGER_HAPPY9
+	{0x2236469ED117FD73, 1775, 13, 39},  // KEY_SEMICOLON
+	{0xC0364D875BF7AB20, 10653, 13, 381},  // key_event.SAT
+	{0xC0A1DB0079D82EA6, 24354, 8, 2},  // SND_TONE
+	{0xC17E7FD95125D6BC, 8897, 16, 313},  // button_event.TR2
+	{0x648230D682B8ECEE, 19577, 28, 719},  // button_event.TRIGGER_HAPPY16
+	{0x3653203D9270BB40, 14983, 23, 547},  // button_event.DPAD_RIGHT
+	{0x556466939567F407, 18795, 17, 704},  // BTN_TRIGGER_HAPPY
+	{0xEFCD6C7BF366739B, 477, 6, 3},  // EV_ABS
+	{0x2125714CAAAF66AE, 21688, 9, 19},  // ABS_HAT1Y
+	{0x4CE15FA7E4D35CBF, 21312, 15, 0},  // absolute_axis.X
+	{0, 0, 0, 0},
+	{0xE5B987D02C133C91, 3807, 17, 117},  // key_event.KPEQUAL
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x4B738CDC64EFDEAF, 6023, 7, 194},  // KEY_F24
+	{0, 0, 0, 0},
+	{0xCFECFBC45ABDEED3, 17029, 17, 641},  // KEY_FISHING_CHART
+	{0x3F6FCE5A5BC66DF8, 6031, 13, 194},  // key_event.F24
+	{0, 0, 0, 0},
+	{0xDDB358ECBFA7C63B, 14471, 23, 533},  // key_event.CAMERA_ZOOMIN
+	{0x8E3BA443993CB71E, 1975, 5, 46},  // KEY_C
+	{0x26F065284DCDAA7D, 8713, 5, 305},  // BTN_B
+	{0x40792A26821F7130, 19263, 19, 713},  // BTN_TRIGGER_HAPPY10
+	{0xD66A3888FC21F820, 1341, 5, 18},  // KEY_E
+	{0xDA7FCC95706B9868, 2487, 13, 68},  // key_event.F10
+	{0xABE51BF7594053AF, 9794, 20, 337},  // button_event.GEAR_UP
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xDFA454A5697A2D83, 7155, 17, 236},  // key_event.BATTERY
+	{0x2F589790B228B65A, 16281, 14, 622},  // KEY_AUDIO_DESC
+	{0x6B71F0425910E383, 24250, 7, 1},  // REP_MAX
+	{0x6DD9E1C29558334C, 3677, 8, 113},  // KEY_MUTE
+	{0, 0, 0, 0},
+	{0x3B72B9A268FBB066, 6, 4, 1},  // true
+	{0x50D348DADA0DCC21, 25006, 9, 91},  // FF_SAW_UP
+	{0, 0, 0, 0},
+	{0x5BB04C750B8C24EE, 6454, 18, 214},  // key_event.QUESTION
+	{0x2768B3FAB540F2B9, 14931, 13, 546},  // BTN_DPAD_LEFT
+	{0xA75DF81CC6C3F129, 21356, 15, 2},  // absolute_axis.Z
+	{0x8B38DD46DAC2020B, 5306, 16, 166},  // key_event.STOPCD
+	{0x0E3DAFBCF95D40CB, 12127, 27, 431},  // key_event.BRIGHTNESS_TOGGLE
+	{0, 0, 0, 0},
+	{0x61D60942D7411D00, 15347, 21, 581},  // key_event.SCREENSAVER
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x1DADD69A31B3DC0F, 8782, 14, 308},  // button_event.Y
+	{0, 0, 0, 0},
+	{0xA01AB4D3AFF2AAFD, 20488, 19, 738},  // BTN_TRIGGER_HAPPY35
+	{0xDCEEF0D409B18FF5, 6269, 15, 208},  // KEY_FASTFORWARD
+	{0x2052481FAE31E842, 5189, 12, 163},  // KEY_NEXTSONG
+	{0xBEB965235ECBB192, 4039, 13, 124},  // key_event.YEN
+	{0x567B254456D2804B, 4556, 14, 144},  // key_event.FILE
+	{0xB8EDB1F39861B1CF, 1519, 14, 27},  // KEY_RIGHTBRACE
+	{0x9352D5F62412C9D3, 4774, 16, 152},  // key_event.COFFEE
+	{0x6176A32D26B3668F, 9822, 12, 352},  // key_event.OK
+	{0, 0, 0, 0},
+	{0x211356BEE7012159, 7063, 21, 233},  // key_event.FORWARDMAIL
+	{0xEC91A4DD65946213, 11403, 17, 410},  // key_event.SHUFFLE
+	{0x26FA3C8F87FC9EE7, 24176, 13, 16},  // led_event.CNT
+	{0xBAF845D695D76397, 18125, 11, 680},  // KEY_MACRO25
+	{0x3943C2451EF36853, 9558, 20, 332},  // button_event.STYLUS2
+	{0xAF0402329EEB7624, 14873, 20, 544},  // button_event.DPAD_UP
+	{0x4C14E1189990C295, 13743, 19, 513},  // key_event.NUMERIC_1
+	{0x17D390C2CF20496A, 10199, 13, 366},  // key_event.PVR
+	{0xE2554B0155CEACE8, 12271, 13, 436},  // KEY_FRAMEBACK
+	{0xE758BAD211748A31, 17975, 11, 675},  // KEY_MACRO20
+	{0, 0, 0, 0},
+	{0x2809BA855DEEACFD, 3915, 11, 121},  // KEY_KPCOMMA
+	{0xD0B4B7856C7FC792, 16617, 21, 632},  // KEY_ONSCREEN_KEYBOARD
+	{0, 0, 0, 0},
+	{0x6652A53224AABA25, 5565, 8, 176},  // KEY_EDIT
+	{0x2827EC30BE387995, 2729, 10, 78},  // KEY_KPPLUS
+	{0xF4F54D77C878F072, 6740, 24, 224},  // key_event.BRIGHTNESSDOWN
+	{0, 0, 0, 0},
+	{0xA4854A4015E7E438, 5059, 11, 159},  // KEY_FORWARD
+	{0x339623CD7549F518, 8414, 18, 296},  // button_event.BASE3
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x980E22312F049413, 23230, 20, 9},  // SW_CAMERA_LENS_COVER
+	{0x8DB90ACCD17DDE08, 2597, 13, 72},  // key_event.KP8
+	{0x2E8425EF928D689E, 15941, 25, 613},  // KEY_KBDINPUTASSIST_CANCEL
+	{0, 0, 0, 0},
+	{0x63813A08701E820C, 9782, 11, 337},  // BTN_GEAR_UP
+	{0, 0, 0, 0},
+	{0x4F373474C649EDC0, 13290, 14, 483},  // key_event.FN_S
+	{0, 0, 0, 0},
+	{0xA09D7EBD938F2B09, 4519, 10, 143},  // KEY_WAKEUP
+	{0x779662BEBB4D70F1, 2765, 13, 79},  // key_event.KP1
+	{0, 0, 0, 0},
+	{0x47DCA03D685F33FB, 20782, 19, 113},  // KEY_MIN_INTERESTING
+	{0x41A8B9F013C4E902, 5987, 13, 192},  // key_event.F22
+	{0, 0, 0, 0},
+	{0x05A13D990A233A7B, 24844, 25, 80},  // force_feedback.EFFECT_MIN
+	{0x19339AFBFF72BF61, 1419, 11, 22},  // key_event.U
+	{0xE127BE066A1A9D46, 343, 14, 31},  // INPUT_PROP_MAX
+	{0x5DCCD8B46739F8BC, 6245, 8, 207},  // KEY_PLAY
+	{0x33329E5BEE3480C4, 8889, 7, 313},  // BTN_TR2
+	{0, 0, 0, 0},
+	{0x6ADACCAB4301F7FD, 18047, 17, 677},  // key_event.MACRO22
+	{0x7089EF74BAF137DB, 5957, 7, 191},  // KEY_F21
+	{0x7D57A28A6933E565, 5044, 14, 158},  // key_event.BACK
+	{0x1688F0B122201F06, 18859, 27, 704},  // button_event.TRIGGER_HAPPY1
+	{0x3EADA3367957BDF4, 1053, 5, 4},  // KEY_3
+	{0, 0, 0, 0},
+	{0x534FCC4E6EA82378, 23512, 25, 15},  // switch_event.PEN_INSERTED
+	{0x7B11482F24C49ADB, 9978, 14, 358},  // key_event.INFO
+	{0xA556A92A92D31552, 963, 12, 0},  // KEY_RESERVED
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x2B3C69076E4FCDD0, 24310, 17, 0},  // sound_event.CLICK
+	{0xFD6EE61673B998C9, 15460, 22, 585},  // key_event.EMOJI_PICKER
+	{0x11506C5B900C8E6B, 21698, 19, 19},  // absolute_axis.HAT1Y
+	{0xF4AC9069D69D3B0C, 12999, 9, 472},  // KEY_FN_F7
+	{0x3C2F9220B4136E00, 14968, 14, 547},  // BTN_DPAD_RIGHT
+	{0, 0, 0, 0},
+	{0xBAD75BF9E63B2EE5, 23746, 8, 4},  // MSC_SCAN
+	{0x401797D7D59C5F62, 2971, 13, 88},  // key_event.F12
+	{0x9BFEB38AFCD02748, 13642, 18, 505},  // key_event.BRL_DOT9
+	{0x456663B01988B4BF, 24736, 9, 85},  // FF_DAMPER
+	{0x92E95A13D1F32E12, 12843, 9, 466},  // KEY_FN_F1
+	{0x781A68AD598EBB29, 10087, 17, 362},  // key_event.PROGRAM
+	{0xE2500D18E3E37B1D, 12007, 21, 429},  // key_event.ADDRESSBOOK
+	{0xAA95252BD9C6E9BA, 1993, 5, 47},  // KEY_V
+	{0x8384CD77D9B772CE, 11957, 13, 428},  // KEY_VOICEMAIL
+	{0x45DFE7673F35513A, 16571, 21, 630},  // key_event.SLOWREVERSE
+	{0x6DA12D2C6D464272, 11901, 12, 426},  // KEY_DATABASE
+	{0x1B05AC60F6190EFC, 22087, 22, 46},  // absolute_axis.RESERVED
+	{0, 0, 0, 0},
+	{0xE643ED7C15A053D2, 17462, 16, 657},  // key_event.MACRO2
+	{0x517A3E50A41545B7, 9993, 8, 359},  // KEY_TIME
+	{0x3DA017051C01C03A, 1149, 11, 9},  // key_event.8
+	{0xEC333157B51BC462, 5803, 7, 184},  // KEY_F14
+	{0x39904AAE765DCFCE, 4945, 8, 155},  // KEY_MAIL
+	{0, 0, 0, 0},
+	{0x64A8D6E8A43BE650, 8003, 17, 275},  // button_event.SIDE
+	{0x2A8B06FFECBEF435, 19169, 18, 711},  // BTN_TRIGGER_HAPPY8
+	{0x158AE43B52761719, 21420, 6, 5},  // ABS_RZ
+	{0, 0, 0, 0},
+	{0xE9246725E9EFA2E7, 20439, 19, 737},  // BTN_TRIGGER_HAPPY34
+	{0x1DC80E1615173661, 21372, 6, 3},  // ABS_RX
+	{0xC729397F1C9687F1, 10787, 10, 387},  // KEY_PLAYER
+	{0x4CB6607AA0060BC5, 5517, 8, 174},  // KEY_EXIT
+	{0xCD4A169EC790DAAB, 19381, 28, 715},  // button_event.TRIGGER_HAPPY12
+	{0x18DDD054394024AD, 11795, 21, 423},  // key_event.SPREADSHEET
+	{0x1AFA39F47B5E56D5, 4503, 15, 142},  // key_event.SLEEP
+	{0x91F947CE82A4084C, 16111, 19, 617},  // key_event.LEFT_DOWN
+	{0x923B104A659FC006, 10676, 14, 382},  // key_event.SAT2
+	{0x612AC4A2D0C2C52F, 13386, 18, 497},  // key_event.BRL_DOT1
+	{0xEA2A0B303AC382A0, 19459, 19, 717},  // BTN_TRIGGER_HAPPY14
+	{0xF086BC10E70A8E7A, 15603, 18, 593},  // KEY_BRIGHTNESS_MAX
+	{0x32E6156B6CA3F94E, 9726, 18, 336},  // button_event.WHEEL
+	{0x598F18666E27ECBD, 23692, 11, 2},  // MSC_GESTURE
+	{0x769B87EB72FA4779, 5455, 12, 172},  // KEY_HOMEPAGE
+	{0x018D4D0C87904BAA, 8872, 16, 312},  // button_event.TL2
+	{0xE156FA8241217BB3, 1283, 7, 15},  // KEY_TAB
+	{0x61647AAC6CE9C7DB, 4618, 20, 146},  // key_event.DELETEFILE
+	{0xB1035C410816834B, 22448, 27, 54},  // absolute_axis.MT_POSITION_Y
+	{0xD52E35F9033D65A9, 23282, 15, 10},  // SW_KEYPAD_SLIDE
+	{0xC02F8B8716DCC737, 22402, 27, 53},  // absolute_axis.MT_POSITION_X
+	{0x4211AE1B55952607, 21568, 9, 10},  // ABS_BRAKE
+	{0, 0, 0, 0},
+	{0xC394E4DE30E45BD1, 3158, 18, 94},  // key_event.MUHENKAN
+	{0x56FA753A72657A85, 13418, 18, 498},  // key_event.BRL_DOT2
+	{0xC4DB3B16F6F8C329, 2175, 14, 55},  // KEY_KPASTERISK
+	{0xD23A8503C2CFAAF2, 11130, 16, 400},  // key_event.YELLOW
+	{0, 0, 0, 0},
+	{0xCC4A82BEEF92A69B, 6877, 18, 228},  // KEY_KBDILLUMTOGGLE
+	{0x06DCBF9DF4360886, 5913, 7, 189},  // KEY_F19
+	{0xF7380C290D50913F, 23324, 18, 11},  // SW_FRONT_PROXIMITY
+	{0xBA6509BBC12F3F84, 17855, 11, 671},  // KEY_MACRO16
+	{0x1E32F26160547D49, 25106, 15, 88},  // FF_WAVEFORM_MIN
+	{0x8D775794D243EB62, 13348, 24, 485},  // key_event.FN_RIGHT_SHIFT
+	{0, 0, 0, 0},
+	{0x0C77B552369BA56F, 21141, 22, 10},  // relative_axis.RESERVED
+	{0x1D35A14505FD9601, 12202, 16, 433},  // key_event.LOGOFF
+	{0x1675F3CAD3C6102A, 541, 6, 17},  // EV_LED
+	{0xC49248FA03EA6D41, 8734, 5, 306},  // BTN_C
+	{0x030E7A89AAD2E880, 13437, 12, 499},  // KEY_BRL_DOT3
+	{0x9FFE2C02355FD857, 1383, 11, 20},  // key_event.T
+	{0x0AFADB40CE74F3B4, 10248, 18, 368},  // key_event.LANGUAGE
+	{0, 0, 0, 0},
+	{0x75F8D144BBDA524A, 9690, 25, 335},  // button_event.TOOL_QUADTAP
+	{0xE8AED238D664A6C8, 3439, 10, 104},  // KEY_PAGEUP
+	{0xDCEC23575AD2A352, 8945, 9, 315},  // BTN_START
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x83643AE9941EE5F5, 3363, 12, 101},  // KEY_LINEFEED
+	{0xA8E519EBB242B395, 2757, 7, 79},  // KEY_KP1
+	{0xA66CDD6C50ADC249, 4005, 9, 123},  // KEY_HANJA
+	{0x7D298EA9A4773BD3, 7944, 18, 273},  // button_event.RIGHT
+	{0x4C82FC56263BCFD1, 20945, 16, 3},  // relative_axis.RX
+	{0xB3616D53412E7D8A, 13144, 16, 477},  // key_event.FN_F12
+	{0xE3CCF0A7FDF7A750, 8698, 14, 304},  // button_event.A
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x338285C4C94D6372, 11942, 14, 427},  // key_event.NEWS
+	{0xD08F805EDC88A0F4, 24608, 23, 81},  // force_feedback.PERIODIC
+	{0, 0, 0, 0},
+	{0xAF4CD9AA112ABEC8, 5735, 7, 181},  // KEY_NEW
+	{0x1DEF8492E4A6ED78, 20145, 19, 731},  // BTN_TRIGGER_HAPPY28
+	{0xEB9808A6C530D3C8, 1485, 13, 26},  // KEY_LEFTBRACE
+	{0x5933C81AD6C0344B, 11751, 10, 422},  // KEY_EDITOR
+	{0xEE210D4980EF7877, 17123, 20, 643},  // KEY_DUAL_RANGE_RADAR
+	{0xAA9A969848C89A42, 17518, 16, 659},  // key_event.MACRO4
+	{0, 0, 0, 0},
+	{0x22DAAC8AB91A8C3E, 6765, 16, 225},  // KEY_BRIGHTNESSUP
+	{0x355E912BCF6C283F, 14453, 17, 533},  // KEY_CAMERA_ZOOMIN
+	{0xA03283C764834EC5, 19479, 28, 717},  // button_event.TRIGGER_HAPPY14
+	{0x0936C1F62F295F75, 13533, 12, 502},  // KEY_BRL_DOT6
+	{0x40A656C0766EB64C, 418, 14, 0},  // event_type.SYN
+	{0xDCCFADCAAFB4E61B, 1631, 5, 31},  // KEY_S
+	{0x173E9D54B456CBB1, 11079, 13, 398},  // key_event.RED
+	{0x53459D22F973754D, 1311, 11, 16},  // key_event.Q
+	{0xD7EA61946A0BE285, 10798, 16, 387},  // key_event.PLAYER
+	{0x512A1060CD43B056, 24678, 21, 83},  // force_feedback.SPRING
+	{0x57BB79FD75F1A368, 23731, 14, 3},  // misc_event.RAW
+	{0x427531F14E23EEF5, 6139, 15, 203},  // key_event.PROG4
+	{0x9AE300E277EC9AF8, 17837, 17, 670},  // key_event.MACRO15
+	{0xCF019F53645EA95C, 7934, 9, 273},  // BTN_RIGHT
+	{0xD05FF920C68DE352, 18669, 17, 698},  // KEY_KBD_LCD_MENU3
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xBFAAFCF6D2D2FACD, 2466, 12, 67},  // key_event.F9
+	{0x65B288E7C83CF8ED, 22493, 26, 55},  // absolute_axis.MT_TOOL_TYPE
+	{0xFBE2AABF67A6EAAF, 21808, 9, 23},  // ABS_HAT3Y
+	{0x8997EC64B6259E17, 17479, 10, 658},  // KEY_MACRO3
+	{0xC211CF8E9063BA14, 24275, 7, 2},  // REP_CNT
+	{0x4A7D9BA5C2915C54, 11727, 23, 421},  // key_event.WORDPROCESSOR
+	{0x882D24CB30F19168, 7143, 11, 236},  // KEY_BATTERY
+	{0x03523CE6F9F4F505, 15386, 22, 582},  // key_event.VOICECOMMAND
+	{0x2A50CDE2CD22E082, 21164, 16, 11},  // REL_WHEEL_HI_RES
+	{0x07186B8F32941C04, 11253, 15, 404},  // key_event.FIRST
+	{0xCBA21CC41B86867D, 5334, 16, 167},  // key_event.RECORD
+	{0x9E7C6883569CC506, 19508, 19, 718},  // BTN_TRIGGER_HAPPY15
+	{0, 0, 0, 0},
+	{0xD3032E0FCE00FDA8, 13845, 19, 516},  // key_event.NUMERIC_4
+	{0x801080C0EBE1EF32, 4249, 9, 132},  // KEY_FRONT
+	{0x81777C40CB63F6D5, 12105, 21, 431},  // KEY_BRIGHTNESS_TOGGLE
+	{0x317FDEC8F7D39174, 17171, 17, 644},  // KEY_RADAR_OVERLAY
+	{0xFBACC6A617346F4C, 6721, 18, 224},  // KEY_BRIGHTNESSDOWN
+	{0x4DC9EF7EB8DFD5EB, 16365, 23, 624},  // key_event.NEXT_FAVORITE
+	{0xDD0E748D2A847CBC, 17377, 19, 649},  // KEY_BRIGHTNESS_MENU
+	{0xAEAB3AC957F62E10, 12063, 17, 431},  // KEY_DISPLAYTOGGLE
+	{0, 0, 0, 0},
+	{0xD9F9DE4DCDEF15A3, 13597, 12, 504},  // KEY_BRL_DOT8
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x8C0060EFD6264A97, 19969, 28, 727},  // button_event.TRIGGER_HAPPY24
+	{0, 0, 0, 0},
+	{0x4BD7E237576948CC, 8580, 9, 304},  // BTN_SOUTH
+	{0x497DA1699AF74C4A, 17213, 21, 645},  // KEY_TRADITIONAL_SONAR
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xE889910082FD23C7, 24942, 11, 89},  // FF_TRIANGLE
+	{0x426AF62B165A5260, 8841, 6, 311},  // BTN_TR
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xDF086D92CBB977B7, 5003, 12, 157},  // KEY_COMPUTER
+	{0xCE43796763AF8DD9, 24300, 9, 0},  // SND_CLICK
+	{0x74EFD90E0A0BAF99, 14052, 22, 522},  // key_event.NUMERIC_STAR
+	{0x42DA90D7CFB7E243, 8443, 18, 297},  // button_event.BASE4
+	{0x575A90FA1F82C963, 4358, 14, 136},  // key_event.FIND
+	{0xF5439870F6A2A41D, 4603, 14, 146},  // KEY_DELETEFILE
+	{0xFC235E2FFDF03C29, 5235, 19, 164},  // key_event.PLAYPAUSE
+	{0x6AFB55F72BA227A5, 5379, 9, 169},  // KEY_PHONE
+	{0, 0, 0, 0},
+	{0xB0E55601ADE63651, 7583, 10, 247},  // KEY_RFKILL
+	{0x170355245D47CCF3, 24779, 22, 86},  // force_feedback.INERTIA
+	{0xF3A7016BBD90387E, 3426, 12, 103},  // key_event.UP
+	{0x306F3AA2240765EC, 7231, 7, 239},  // KEY_UWB
+	{0x3AE3650EA6A28FCF, 16427, 16, 626},  // KEY_PAUSE_RECORD
+	{0, 0, 0, 0},
+	{0xE145FA2205FC57CF, 314, 28, 6},  // input_property.ACCELEROMETER
+	{0, 0, 0, 0},
+	{0x26203380BDB6D7F1, 9941, 10, 357},  // KEY_OPTION
+	{0xC2E7B4976F87EBA9, 3525, 13, 107},  // key_event.END
+	{0x2950B6A92E2847AE, 10991, 8, 395},  // KEY_LIST
+	{0, 0, 0, 0},
+	{0x7F35BE22EE1044B0, 19606, 19, 720},  // BTN_TRIGGER_HAPPY17
+	{0x45EB74A7B90F66AC, 13501, 12, 501},  // KEY_BRL_DOT5
+	{0xBE27E6C316D854C0, 23672, 19, 1},  // misc_event.PULSELED
+	{0x86DC57FB833F451D, 9103, 21, 320},  // button_event.TOOL_PEN
+	{0, 0, 0, 0},
+	{0x48F7912D52F9D982, 14649, 16, 538},  // KEY_CAMERA_RIGHT
+	{0x9C2912F3D3EA2616, 6387, 10, 212},  // KEY_CAMERA
+	{0xDCE257952B76D5E4, 21288, 17, 16},  // relative_axis.CNT
+	{0xB9CF5A5A4D50D286, 3899, 15, 120},  // key_event.SCALE
+	{0x754074EBA11E1E45, 14308, 20, 529},  // key_event.WPS_BUTTON
+	{0x0666A7B79CF430B6, 527, 13, 5},  // event_type.SW
+	{0xAAD102D378CAA33F, 1161, 5, 10},  // KEY_9
+	{0x4D8EBD899D5B7496, 4428, 14, 139},  // key_event.MENU
+	{0xBC237AB93C3722F1, 5101, 17, 160},  // key_event.CLOSECD
+	{0x2E1B3178D67C3746, 6621, 15, 220},  // key_event.SPORT
+	{0xA6CEAF26F44612B6, 2575, 13, 71},  // key_event.KP7
+	{0xCA66C67E6B02E58D, 22535, 24, 56},  // absolute_axis.MT_BLOB_ID
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x5590F4FB2CC5CA4F, 16995, 13, 640},  // KEY_NAV_CHART
+	{0x2F4870A50D2CA98A, 9205, 15, 323},  // BTN_TOOL_PENCIL
+	{0x84E9D4C1A55ED116, 16593, 8, 631},  // KEY_DATA
+	{0x49DB957DFB764FF2, 23429, 26, 13},  // switch_event.LINEIN_INSERT
+	{0x19FEB4B1E07D620E, 2611, 7, 73},  // KEY_KP9
+	{0x789AC619C9F5D61B, 1035, 5, 3},  // KEY_2
+	{0, 0, 0, 0},
+	{0x726FA6B60D233782, 7094, 14, 234},  // key_event.SAVE
+	{0xDCE47F4160FD99B3, 6674, 18, 222},  // key_event.ALTERASE
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x3C3CC244A5778020, 23343, 28, 11},  // switch_event.FRONT_PROXIMITY
+	{0x708FCAD1A0BB46BA, 15559, 18, 592},  // KEY_BRIGHTNESS_MIN
+	{0x0E9777F470BC3AB6, 3404, 14, 102},  // key_event.HOME
+	{0xB3F1F7E08C6BB151, 16256, 24, 619},  // key_event.MEDIA_TOP_MENU
+	{0x3BC71AC3AD5F27AB, 11185, 19, 402},  // key_event.CHANNELUP
+	{0xD850197D0E324708, 3450, 16, 104},  // key_event.PAGEUP
+	{0, 0, 0, 0},
+	{0x5DD1B0939BB622A6, 17927, 17, 673},  // key_event.MACRO18
+	{0xB36D805C602B81E6, 12305, 16, 437},  // KEY_FRAMEFORWARD
+	{0x42427555A6915D14, 15755, 28, 610},  // KEY_KBDINPUTASSIST_PREVGROUP
+	{0x56E7D3E3CAF54F6F, 15205, 21, 577},  // key_event.TASKMANAGER
+	{0x207E047C42FE7E58, 5550, 14, 175},  // key_event.MOVE
+	{0x72364553BB115DAF, 8983, 17, 316},  // button_event.MODE
+	{0, 0, 0, 0},
+	{0xDC7D98A7CED48962, 21874, 12, 25},  // ABS_DISTANCE
+	{0, 0, 0, 0},
+	{0x58D3340EAF2C7E94, 3651, 9, 112},  // KEY_MACRO
+	{0, 0, 0, 0},
+	{0x8463ECF84583E2C0, 8290, 8, 292},  // BTN_TOP2
+	{0x5D9142DBC73B71C6, 24219, 10, 1},  // REP_PERIOD
+	{0xF6D2D9CC3142EFB8, 8955, 18, 315},  // button_event.START
+	{0x05C0C9EAD1D03801, 12815, 10, 465},  // KEY_FN_ESC
+	{0, 0, 0, 0},
+	{0xAD06DA6FBBDD4CCA, 10277, 15, 369},  // key_event.TITLE
+	{0xCBE43D71BC0C5E48, 7907, 8, 272},  // BTN_LEFT
+	{0x1E8EC765D1263520, 1691, 11, 34},  // key_event.G
+	{0, 0, 0, 0},
+	{0xCE454F920B404943, 8265, 7, 291},  // BTN_TOP
+	{0x2F556930B0B6F2F3, 18257, 17, 684},  // key_event.MACRO29
+	{0xF7E142853CFCD268, 4467, 9, 141},  // KEY_SETUP
+	{0x7D0C3DB100E8FD1A, 4871, 13, 153},  // KEY_DIRECTION
+	{0x50031F8786DA3D1D, 3305, 9, 99},  // KEY_SYSRQ
+	{0xABCD21E3523BBD13, 10544, 12, 376},  // key_event.PC
+	{0x35011C9B07BBFD6D, 13257, 8, 482},  // KEY_FN_F
+	{0x0883676863CF2A3D, 21444, 12, 6},  // ABS_THROTTLE
+	{0x3F636DCE12EF9FD4, 22074, 12, 46},  // ABS_RESERVED
+	{0x615952F10BF1CCF8, 5781, 7, 183},  // KEY_F13
+	{0x93D7F3B7B040472C, 11628, 16, 418},  // key_event.ZOOMIN
+	{0xB7EF9640DAC8143F, 8317, 10, 293},  // BTN_PINKIE
+	{0x90CBC0C133092F51, 2319, 6, 60},  // KEY_F2
+	{0x6E6A5F142A1CE063, 5891, 7, 188},  // KEY_F18
+	{0xAB8980896430A246, 4639, 8, 147},  // KEY_XFER
+	{0, 0, 0, 0},
+	{0xACA99EACC1C97360, 2326, 12, 60},  // key_event.F2
+	{0xF28ACA1DCC4C27C0, 1347, 11, 18},  // key_event.E
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x6440B96CD2BC0356, 548, 14, 17},  // event_type.LED
+	{0x9F034346B1FEFB1B, 10599, 7, 379},  // KEY_VCR
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x91C73EFF6525EAC6, 8184, 20, 288},  // button_event.TRIGGER
+	{0, 0, 0, 0},
+	{0xB48993CACE067C2F, 23986, 9, 5},  // LED_SLEEP
+	{0xC5B09776D0B97874, 1467, 5, 25},  // KEY_P
+	{0x0A013C31B5AD2542, 139, 18, 3},  // INPUT_PROP_SEMI_MT
+	{0, 0, 0, 0},
+	{0xC9ED7ED38FEC9C5A, 9872, 14, 354},  // key_event.GOTO
+	{0x644E500701ED1586, 6254, 14, 207},  // key_event.PLAY
+	{0, 0, 0, 0},
+	{0x3E5FA69C844125D6, 1263, 19, 14},  // key_event.BACKSPACE
+	{0x80A1F5C0B9AF0F98, 7863, 14, 265},  // button_event.9
+	{0x7954422F8AE8AF21, 1763, 11, 38},  // key_event.L
+	{0xBE1EDA91FF84E237, 19188, 27, 711},  // button_event.TRIGGER_HAPPY8
+	{0x51B6C294CD6A86E9, 17897, 17, 672},  // key_event.MACRO17
+	{0xF7D612EEEDE68F2C, 4530, 16, 143},  // key_event.WAKEUP
+	{0x7C2DAD95E3DF425B, 6045, 10, 200},  // KEY_PLAYCD
+	{0x65142562ED39AC15, 24574, 21, 80},  // force_feedback.RUMBLE
+	{0xBFCA7D65778BB102, 5877, 13, 187},  // key_event.F17
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x346253E181035E99, 12879, 15, 467},  // key_event.FN_F2
+	{0x7A5EF921A9479C33, 5743, 13, 181},  // key_event.NEW
+	{0x10CBB169F433537D, 2359, 6, 62},  // KEY_F4
+	{0, 0, 0, 0},
+	{0x17377638DE6E544B, 181, 23, 4},  // INPUT_PROP_TOPBUTTONPAD
+	{0x0447480811414408, 9426, 26, 328},  // button_event.TOOL_QUINTTAP
+	{0, 0, 0, 0},
+	{0x816E25F47C606153, 6285, 21, 208},  // key_event.FASTFORWARD
+	{0xE7CF257DF7F2E9C2, 1431, 5, 23},  // KEY_I
+	{0xE16C66F47FDF812E, 3005, 12, 90},  // KEY_KATAKANA
+	{0x73B93B2D87594F02, 24978, 7, 90},  // FF_SINE
+	{0xA254AF285F41B4F3, 2693, 13, 76},  // key_event.KP5
+	{0x6B3BB86578F1C308, 23060, 17, 5},  // switch_event.DOCK
+	{0x7E47E4BC60A5110E, 17647, 10, 664},  // KEY_MACRO9
+	{0x3B9DEDF938333B60, 23944, 17, 3},  // led_event.COMPOSE
+	{0x67675E828AAEB719, 499, 6, 4},  // EV_MSC
+	{0, 0, 0, 0},
+	{0xE8D7742CD04E05F4, 7737, 14, 259},  // button_event.3
+	{0xF556A9563E5335AB, 5965, 13, 191},  // key_event.F21
+	{0, 0, 0, 0},
+	{0x53ED12CBA264D98E, 24986, 19, 90},  // force_feedback.SINE
+	{0x99BD5D9C1D063870, 24494, 29, 1},  // force_feedback_status.PLAYING
+	{0xCD42F288CFC88CAE, 5389, 15, 169},  // key_event.PHONE
+	{0x5CFE3AA4770BBD74, 16602, 14, 631},  // key_event.DATA
+	{0x6B54F512A46382E2, 607, 5, 21},  // EV_FF
+	{0x3240B90F61E04346, 5921, 13, 189},  // key_event.F19
+	{0x7493539B0AE9F125, 24075, 14, 8},  // led_event.MISC
+	{0x01A6214AD1AE1637, 22706, 23, 60},  // absolute_axis.MT_TOOL_X
+	{0x7E6B35C374970942, 14329, 19, 530},  // KEY_TOUCHPAD_TOGGLE
+	{0x7F15B70609274716, 627, 6, 22},  // EV_PWR
+	{0x86DC3136E7531491, 16167, 14, 621},  // KEY_NUMERIC_12
+	{0x528D8363D9BA71AD, 5636, 20, 178},  // key_event.SCROLLDOWN
+	{0x6EA6A38DC429A914, 14689, 16, 539},  // KEY_ATTENDANT_ON
+	{0xA8FB8515CB238B00, 19075, 18, 709},  // BTN_TRIGGER_HAPPY6
+	{0xD368294F8B72505D, 4885, 19, 153},  // key_event.DIRECTION
+	{0x7F32353531DC14DF, 10630, 14, 380},  // key_event.VCR2
+	{0, 0, 0, 0},
+	{0xA00B665CF84AB7BA, 14375, 15, 531},  // KEY_TOUCHPAD_ON
+	{0x47E4BC5EF3689E06, 8092, 17, 278},  // button_event.BACK
+	{0, 0, 0, 0},
+	{0xF45DC8A5708F310D, 1071, 5, 5},  // KEY_4
+	{0xFF2CE411DAA51A03, 14908, 22, 545},  // button_event.DPAD_DOWN
+	{0xB71B7117B348AC26, 11431, 15, 411},  // key_event.BREAK
+	{0, 0, 0, 0},
+	{0x033C5CE57B44F1B4, 15819, 28, 611},  // KEY_KBDINPUTASSIST_NEXTGROUP
+	{0x29F322979C624C32, 1041, 11, 3},  // key_event.2
+	{0x654250CE8544BF3C, 10045, 11, 361},  // KEY_ARCHIVE
+	{0xBEEA50451939F45E, 9486, 9, 330},  // BTN_TOUCH
+	{0xC426CC055D7B01CE, 18328, 28, 688},  // key_event.MACRO_RECORD_START
+	{0x0ED5CC7E5114210A, 6499, 8, 216},  // KEY_CHAT
+	{0, 0, 0, 0},
+	{0xA6B836D130353289, 10735, 9, 385},  // KEY_RADIO
+	{0xF8AF0CF88C631FCF, 22430, 17, 54},  // ABS_MT_POSITION_Y
+	{0x774CA2EAE4FB7A23, 2501, 11, 69},  // KEY_NUMLOCK
+	{0x0DB9930F6393396D, 6367, 6, 211},  // KEY_HP
+	{0x209BFCC5503887A6, 25166, 27, 93},  // force_feedback.WAVEFORM_MAX
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xDC0DD800E2280194, 4173, 9, 129},  // KEY_AGAIN
+	{0xB1F831E2B09B6E27, 5131, 17, 161},  // key_event.EJECTCD
+	{0x8955A020767727BE, 6189, 11, 205},  // KEY_SUSPEND
+	{0x97240508B9E784DD, 8404, 9, 296},  // BTN_BASE3
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xCD41B3F0FE3FD4AA, 19528, 28, 718},  // button_event.TRIGGER_HAPPY15
+	{0x691BBFB7CB7220AD, 20361, 28, 735},  // button_event.TRIGGER_HAPPY32
+	{0, 0, 0, 0},
+	{0x6E34E35437FA3959, 17071, 22, 642},  // KEY_SINGLE_RANGE_RADAR
+	{0, 0, 0, 0},
+	{0x47DC15B3C9E3EF6C, 10891, 13, 391},  // key_event.MP3
+	{0x0E413D44D1EAFE5A, 20165, 28, 731},  // button_event.TRIGGER_HAPPY28
+	{0x25D901B1AC7EB1D5, 6473, 9, 215},  // KEY_EMAIL
+	{0x938070940E7FF9FE, 4259, 15, 132},  // key_event.FRONT
+	{0xD3149DC00A590C06, 21851, 22, 24},  // absolute_axis.PRESSURE
+	{0, 0, 0, 0},
+	{0x3BF939B6EF3556C2, 3118, 26, 93},  // key_event.KATAKANAHIRAGANA
+	{0x9C6D4029CBFA6A40, 13797, 13, 515},  // KEY_NUMERIC_3
+	{0, 0, 0, 0},
+	{0x2D5E603CA5173C97, 18005, 11, 676},  // KEY_MACRO21
+	{0xA35E815FA4280DDA, 3491, 9, 106},  // KEY_RIGHT
+	{0xFB88E49076C048A2, 10135, 13, 364},  // KEY_FAVORITES
+	{0xB0643AB36941C256, 16389, 15, 625},  // KEY_STOP_RECORD
+	{0, 0, 0, 0},
+	{0xB169524A937836EB, 24446, 29, 0},  // force_feedback_status.STOPPED
+	{0, 0, 0, 0},
+	{0xBE9479F71708A95C, 7857, 5, 265},  // BTN_9
+	{0, 0, 0, 0},
+	{0x5F6835D6C18A0B85, 10915, 15, 392},  // key_event.AUDIO
+	{0, 0, 0, 0},
+	{0x50C220008D5798C0, 2426, 12, 65},  // key_event.F7
+	{0, 0, 0, 0},
+	{0x6BD498CB9F94970A, 23496, 15, 15},  // SW_PEN_INSERTED
+	{0xC90AE044467D96A1, 24564, 9, 80},  // FF_RUMBLE
+	{0x5E483EE5916C644E, 16750, 30, 634},  // key_event.SELECTIVE_SCREENSHOT
+	{0x39BABAADF92389CE, 13009, 15, 472},  // key_event.FN_F7
+	{0xC6DAF8E649128491, 18813, 26, 704},  // button_event.TRIGGER_HAPPY
+	{0x6CBCC952580D3DC7, 11971, 19, 428},  // key_event.VOICEMAIL
+	{0, 0, 0, 0},
+	{0xFA6DA19F2FB2CDF3, 18711, 17, 699},  // KEY_KBD_LCD_MENU4
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xD88D98D76CC6DA56, 11540, 14, 415},  // key_event.TWEN
+	{0x3824015E31D9C5A7, 13185, 8, 479},  // KEY_FN_2
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x30FA49CCC581A992, 13025, 9, 473},  // KEY_FN_F8
+	{0, 0, 0, 0},
+	{0xC18769E09BCDFBB0, 4648, 14, 147},  // key_event.XFER
+	{0, 0, 0, 0},
+	{0x85162E3A405165C0, 17747, 17, 667},  // key_event.MACRO12
+	{0x777CC055A0D9B8F7, 2479, 7, 68},  // KEY_F10
+	{0x78E2159AAC3D6174, 1395, 5, 21},  // KEY_Y
+	{0, 0, 0, 0},
+	{0xDB3D8D44CA84023E, 19557, 19, 719},  // BTN_TRIGGER_HAPPY16
+	{0xA82F618349416C67, 10335, 15, 371},  // key_event.ANGLE
+	{0xCBBA7A047D88F044, 9385, 22, 327},  // button_event.TOOL_LENS
+	{0, 0, 0, 0},
+	{0x47F147F5ADD7D6D8, 23148, 33, 7},  // switch_event.JACK_PHYSICAL_INSERT
+	{0x35BAD7A59DFF7713, 6523, 10, 217},  // KEY_SEARCH
+	{0x1B1887AC3063CD8D, 24632, 11, 82},  // FF_CONSTANT
+	{0, 0, 0, 0},
+	{0x81BDF98E63004655, 4969, 13, 156},  // KEY_BOOKMARKS
+	{0x159F437B7FE8F86F, 20802, 25, 113},  // key_event.MIN_INTERESTING
+	{0x77AE66FD3B637D57, 22014, 10, 32},  // ABS_VOLUME
+	{0xFFFD281E122178DE, 10667, 8, 382},  // KEY_SAT2
+	{0x1ED2C2120367AFBA, 14117, 13, 524},  // KEY_NUMERIC_A
+	{0, 0, 0, 0},
+	{0x6B7CE2034FE08E6F, 10117, 17, 363},  // key_event.CHANNEL
+	{0x2A9B9DEF41E6E06D, 13105, 10, 476},  // KEY_FN_F11
+	{0xC7948ED0F1967B1D, 12219, 10, 434},  // KEY_DOLLAR
+	{0xD40AC7BB442D436F, 4381, 13, 137},  // key_event.CUT
+	{0xE73232C90C04F2CC, 9759, 22, 336},  // button_event.GEAR_DOWN
+	{0xA0E03FCABD44071F, 14151, 13, 525},  // KEY_NUMERIC_B
+	{0x91EBBDADCDD45397, 25304, 6, 127},  // FF_MAX
+	{0xFA1D13FD1CA740A5, 21748, 9, 21},  // ABS_HAT2Y
+	{0x653D1F69521ADAC0, 6113, 15, 202},  // key_event.PROG3
+	{0x789BCA8EBE7BF692, 14219, 13, 527},  // KEY_NUMERIC_D
+	{0xB3A86F68A93BD7C6, 8433, 9, 297},  // BTN_BASE4
+	{0xD23384AC9ABFC716, 18887, 18, 705},  // BTN_TRIGGER_HAPPY2
+	{0, 0, 0, 0},
+	{0xBEB6BBB231FB4630, 21457, 22, 6},  // absolute_axis.THROTTLE
+	{0x938A6EFCBC1BE3B5, 23555, 26, 16},  // switch_event.MACHINE_COVER
+	{0xB1646DC184D6BF7C, 18687, 23, 698},  // key_event.KBD_LCD_MENU3
+	{0x9C79B6A69652EA7D, 3018, 18, 90},  // key_event.KATAKANA
+	{0x7EAACACDA4A9F6C2, 9032, 10, 318},  // BTN_THUMBR
+	{0xFB9D3695DD9E8793, 17535, 10, 660},  // KEY_MACRO5
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x63FF4E825703EBC2, 24127, 18, 10},  // led_event.CHARGING
+	{0xEE04AF7A01930DCC, 9645, 27, 334},  // button_event.TOOL_TRIPLETAP
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x30C8F2577AD92973, 13777, 19, 514},  // key_event.NUMERIC_2
+	{0x6474FDA33DE7E01C, 12931, 15, 469},  // key_event.FN_F4
+	{0x93F748A58D531275, 1945, 11, 44},  // key_event.Z
+	{0x8757F608FC52817A, 24099, 14, 9},  // led_event.MAIL
+	{0x3946142C20E56C09, 22122, 21, 47},  // absolute_axis.MT_SLOT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x8EC783A75CD8FBB4, 24154, 13, 15},  // led_event.MAX
+	{0x4479955086299A07, 17490, 16, 658},  // key_event.MACRO3
+	{0xF161EBCDDB929067, 22055, 18, 40},  // absolute_axis.MISC
+	{0xFAF5167054456DE1, 18185, 11, 682},  // KEY_MACRO27
+	{0x8D9863B954B034E2, 17765, 11, 668},  // KEY_MACRO13
+	{0x8E64BB582F9C19A8, 1473, 11, 25},  // key_event.P
+	{0x0E614F99846831AE, 1401, 11, 21},  // key_event.Y
+	{0xE3099910A8245FA8, 20214, 28, 732},  // button_event.TRIGGER_HAPPY29
+	{0x1CD90928982C200A, 21379, 16, 3},  // absolute_axis.RX
+	{0xA26EBDEE5FC61D85, 8472, 18, 298},  // button_event.BASE5
+	{0x3E083FC67E076D85, 25074, 9, 93},  // FF_CUSTOM
+	{0x711453D9214DB645, 6229, 15, 206},  // key_event.CLOSE
+	{0x9A245553B5D948D3, 2386, 12, 63},  // key_event.F5
+	{0x860D93407EEC9C3E, 22884, 19, 2},  // SW_HEADPHONE_INSERT
+	{0, 0, 0, 0},
+	{0x3144660A87857A09, 6508, 14, 216},  // key_event.CHAT
+	{0x8D0083318537FD1B, 6704, 16, 223},  // key_event.CANCEL
+	{0, 0, 0, 0},
+	{0x9AEC42773518B4F0, 8590, 18, 304},  // button_event.SOUTH
+	{0x91B837D41A54E527, 9598, 27, 333},  // button_event.TOOL_DOUBLETAP
+	{0xDA064A124C509A3C, 3331, 12, 100},  // KEY_RIGHTALT
+	{0xCD673B3393417122, 12029, 13, 430},  // KEY_MESSENGER
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x11F421DCA2D16E18, 2306, 12, 59},  // key_event.F1
+	{0x7BEDC0D833B0E1DB, 4323, 9, 135},  // KEY_PASTE
+	{0xADA9C6C806F89776, 392, 18, 32},  // input_property.CNT
+	{0x26055CA80789885A, 14666, 22, 538},  // key_event.CAMERA_RIGHT
+	{0x446B3F7A84C041C0, 12973, 9, 471},  // KEY_FN_F6
+	{0xA8AC45FDB97437D9, 4234, 14, 131},  // key_event.UNDO
+	{0x9CCFC623395373E6, 10149, 19, 364},  // key_event.FAVORITES
+	{0x069C18DD3D590449, 778, 28, 1},  // synchronization_event.CONFIG
+	{0xCFD41D6B95D37BE9, 2845, 9, 83},  // KEY_KPDOT
+	{0, 0, 0, 0},
+	{0x8432044F8C830B9B, 16131, 14, 620},  // KEY_NUMERIC_11
+	{0x198CD3DF051E8F44, 10971, 19, 394},  // key_event.DIRECTORY
+	{0x57B1C16BE455C708, 11421, 9, 411},  // KEY_BREAK
+	{0x382D447CE07CFA75, 5499, 17, 173},  // key_event.REFRESH
+	{0xF5EFB6A1998E7B6A, 24830, 13, 80},  // FF_EFFECT_MIN
+	{0x2FA6D322B3415A54, 7423, 25, 244},  // key_event.BRIGHTNESS_AUTO
+	{0x1DF05227A074ED7C, 3927, 17, 121},  // key_event.KPCOMMA
+	{0xCAA19CA223ECAD5A, 11293, 6, 406},  // KEY_AB
+	{0x1D5BB0F376FF0DC6, 4373, 7, 137},  // KEY_CUT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x109BC5F2572A9ECD, 14413, 16, 532},  // KEY_TOUCHPAD_OFF
+	{0x5D72B61104324332, 12853, 15, 466},  // key_event.FN_F1
+	{0x98F89A03F31A7BAA, 3241, 13, 97},  // KEY_RIGHTCTRL
+	{0xCE2D9DAAA894D0D9, 4443, 8, 140},  // KEY_CALC
+	{0x99F55BFD2819B950, 3737, 12, 115},  // KEY_VOLUMEUP
+	{0x4D9732B614ADF7BB, 22240, 18, 50},  // ABS_MT_WIDTH_MAJOR
+	{0xC1BBDFA311FCCB83, 25277, 26, 96},  // force_feedback.MAX_EFFECTS
+	{0xE03A415AF019355F, 25194, 7, 96},  // FF_GAIN
+	{0, 0, 0, 0},
+	{0xDF9AB309EEC506EE, 5979, 7, 192},  // KEY_F22
+	{0, 0, 0, 0},
+	{0x50D6BBE17EBBC89B, 15671, 29, 608},  // key_event.KBDINPUTASSIST_PREV
+	{0xE97821D94737E683, 21021, 20, 6},  // relative_axis.HWHEEL
+	{0xB73CF3AA22EF3C8C, 1845, 9, 41},  // KEY_GRAVE
+	{0xED3EA256087B8FB9, 24012, 11, 6},  // LED_SUSPEND
+	{0xFA2578CE03C18A65, 21262, 17, 15},  // relative_axis.MAX
+	{0xA2B7AEA635819A1C, 2831, 13, 82},  // key_event.KP0
+	{0xC53BC5AA94B8758C, 8348, 8, 294},  // BTN_BASE
+	{0x121A11FC826E860E, 2890, 24, 85},  // key_event.ZENKAKUHANKAKU
+	{0xA1AA6F9FEA13798E, 7355, 20, 243},  // KEY_BRIGHTNESS_CYCLE
+	{0xFD978BE5773449A5, 18197, 17, 682},  // key_event.MACRO27
+	{0xF7B4E764E061ACFA, 3419, 6, 103},  // KEY_UP
+	{0x4ECFB061379DF165, 10509, 10, 375},  // KEY_SCREEN
+	{0x0B4C367DC28B062F, 18840, 18, 704},  // BTN_TRIGGER_HAPPY1
+	{0, 0, 0, 0},
+	{0x51019E6C461A38C5, 18934, 18, 706},  // BTN_TRIGGER_HAPPY3
+	{0, 0, 0, 0},
+	{0x98029F1197917745, 1223, 9, 13},  // KEY_EQUAL
+	{0x854729AA2DC7AFAB, 6441, 12, 214},  // KEY_QUESTION
+	{0, 0, 0, 0},
+	{0x7D2EE0D092BBB999, 9673, 16, 335},  // BTN_TOOL_QUADTAP
+	{0x2DA29C40101FFE04, 9090, 12, 320},  // BTN_TOOL_PEN
+	{0, 0, 0, 0},
+	{0xA1C2CF08F0D1BAB7, 6997, 8, 231},  // KEY_SEND
+	{0xB11A26CD2DB28679, 24768, 10, 86},  // FF_INERTIA
+	{0x0DE53E956019BE9E, 9246, 17, 324},  // BTN_TOOL_AIRBRUSH
+	{0, 0, 0, 0},
+	{0x38D1EDF18E559BC0, 20116, 28, 730},  // button_event.TRIGGER_HAPPY27
+	{0, 0, 0, 0},
+	{0x248893A0512953AA, 4066, 18, 125},  // key_event.LEFTMETA
+	{0x4B914598509A4E26, 8776, 5, 308},  // BTN_Y
+	{0x2839DF15B6A50DA1, 13831, 13, 516},  // KEY_NUMERIC_4
+	{0x96FD945810BF953E, 1167, 11, 10},  // key_event.9
+	{0, 0, 0, 0},
+	{0x490AEDAA0EF369CB, 24200, 18, 0},  // repeat_event.DELAY
+	{0xDC6117B134B43B83, 1437, 11, 23},  // key_event.I
+	{0x4E47EAD86BFDF60B, 10577, 7, 378},  // KEY_TV2
+	{0x4ABFDF96FF00853D, 3750, 18, 115},  // key_event.VOLUMEUP
+	{0x2EEDCF3283CEEED5, 20962, 6, 4},  // REL_RY
+	{0x95B18051FFF315DC, 4791, 14, 152},  // KEY_SCREENLOCK
+	{0xE1809AD9399D9ED9, 690, 14, 31},  // event_type.MAX
+	{0x6C3F9ED810B5F26B, 9166, 14, 322},  // BTN_TOOL_BRUSH
+	{0x7F650724E83326B6, 17094, 28, 642},  // key_event.SINGLE_RANGE_RADAR
+	{0, 0, 0, 0},
+	{0x184B45E9D6FF0BCA, 8818, 6, 310},  // BTN_TL
+	{0x9B66B38782930FA7, 11156, 14, 401},  // key_event.BLUE
+	{0x69418E4AF8D75843, 17619, 10, 663},  // KEY_MACRO8
+	{0x9BB420001E6EB594, 19141, 27, 710},  // button_event.TRIGGER_HAPPY7
+	{0x118E87B5EAF11E09, 995, 7, 1},  // KEY_ESC
+	{0xB910BF323335B10F, 8215, 18, 289},  // button_event.THUMB
+	{0xC49E13E9A6F3EA9A, 16667, 25, 633},  // KEY_PRIVACY_SCREEN_TOGGLE
+	{0x2284DB585E431196, 8110, 8, 279},  // BTN_TASK
+	{0x7D9B19192193B0CF, 2715, 13, 77},  // key_event.KP6
+	{0xE5B717F33DC7BEBB, 13763, 13, 514},  // KEY_NUMERIC_2
+	{0xF5887B1D8EA1B36D, 15369, 16, 582},  // KEY_VOICECOMMAND
+	{0xD5FB4D8D82B25722, 12043, 19, 430},  // key_event.MESSENGER
+	{0xED20A7DABF1BFC66, 18305, 22, 688},  // KEY_MACRO_RECORD_START
+	{0xCEAA99EDF58D9196, 6129, 9, 203},  // KEY_PROG4
+	{0x03C89ABBE8CC2185, 11689, 19, 420},  // key_event.ZOOMRESET
+	{0x4137B81028054690, 16781, 16, 635},  // KEY_NEXT_ELEMENT
+	{0, 0, 0, 0},
+	{0x87D04148C17ED59E, 15848, 34, 611},  // key_event.KBDINPUTASSIST_NEXTGROUP
+	{0x3FCDABBFA233466A, 12648, 22, 446},  // key_event.HANGUP_PHONE
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x5CE6758833589152, 13077, 10, 475},  // KEY_FN_F10
+	{0x3FA1736C6C3C8F92, 3501, 15, 106},  // key_event.RIGHT
+	{0, 0, 0, 0},
+	{0x4138CC7E69B9377B, 11337, 11, 408},  // KEY_RESTART
+	{0xBE2083E8C5FE80F9, 7403, 19, 244},  // KEY_BRIGHTNESS_AUTO
+	{0xC46E3F8F417701BF, 22768, 7, 63},  // ABS_MAX
+	{0x04D8E86FD611BD30, 3287, 17, 98},  // key_event.KPSLASH
+	{0x3DEE5E4269123341, 5427, 10, 171},  // KEY_CONFIG
+	{0x19B1D28DD23D690F, 289, 24, 6},  // INPUT_PROP_ACCELEROMETER
+	{0xB8B91AAEC0E59B98, 13913, 19, 518},  // key_event.NUMERIC_6
+	{0, 0, 0, 0},
+	{0x330A02E0FE804FD7, 7376, 26, 243},  // key_event.BRIGHTNESS_CYCLE
+	{0xF2950E8B6B3B1916, 16182, 20, 621},  // key_event.NUMERIC_12
+	{0x600B1572EA2D41D8, 15189, 15, 577},  // KEY_TASKMANAGER
+	{0xE6C03994B561BB4F, 23606, 6, 17},  // SW_CNT
+	{0x889B95CD1A78094B, 24870, 13, 87},  // FF_EFFECT_MAX
+	{0, 0, 0, 0},
+	{0xBC47F335F3367630, 22844, 14, 1},  // SW_TABLET_MODE
+	{0xF952077CE1F9389D, 1377, 5, 20},  // KEY_T
+	{0xA3C966D4D93155F3, 4053, 12, 125},  // KEY_LEFTMETA
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x75C0C92FB3783F07, 20606, 28, 740},  // button_event.TRIGGER_HAPPY37
+	{0, 0, 0, 0},
+	{0x9C4E4D81743D53AF, 23052, 7, 5},  // SW_DOCK
+	{0x31D02249E5E058D3, 5071, 17, 159},  // key_event.FORWARD
+	{0xCE8C6371401C0C3F, 22288, 18, 51},  // ABS_MT_WIDTH_MINOR
+	{0xCFCAC280F143CAC0, 8520, 8, 303},  // BTN_DEAD
+	{0xB4897F2ED5BDD48D, 1329, 11, 17},  // key_event.W
+	{0, 0, 0, 0},
+	{0x1B7EC296C629B0B6, 6341, 9, 210},  // KEY_PRINT
+	{0xA6112AFFA1915680, 7047, 15, 233},  // KEY_FORWARDMAIL
+	{0x51BA6B609805B410, 16217, 19, 618},  // key_event.ROOT_MENU
+	{0xFA25C0F268D6945A, 16517, 15, 629},  // KEY_FASTREVERSE
+	{0xBEE1AAF639CA173D, 13967, 13, 520},  // KEY_NUMERIC_8
+	{0xB2F29F535F68747B, 2941, 7, 87},  // KEY_F11
+	{0x07F7F1A28A0C2B02, 21350, 5, 2},  // ABS_Z
+	{0xEB1A74ACC8D3C03E, 22144, 18, 48},  // ABS_MT_TOUCH_MAJOR
+	{0xB56A789BB787186C, 5899, 13, 188},  // key_event.F18
+	{0x4689186A2CDBBA3C, 13565, 12, 503},  // KEY_BRL_DOT7
+	{0xA8C9C4F8538A2A9B, 30, 22, 0},  // input_property.POINTER
+	{0, 0, 0, 0},
+	{0x5C7A6CDF5894857D, 24230, 19, 1},  // repeat_event.PERIOD
+	{0xDAE78DB6DE760654, 12905, 15, 468},  // key_event.FN_F3
+	{0, 0, 0, 0},
+	{0xB1EA5F8119282D4A, 10325, 9, 371},  // KEY_ANGLE
+	{0x9EAC7AE4C7EC7D84, 24090, 8, 9},  // LED_MAIL
+	{0x02786E2E9B910B2B, 19430, 28, 716},  // button_event.TRIGGER_HAPPY13
+	{0xB9240A178C3C2771, 3889, 9, 120},  // KEY_SCALE
+	{0xFAE93E08C3D2589E, 23021, 30, 4},  // switch_event.MICROPHONE_INSERT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xEDE6162EA8016822, 1455, 11, 24},  // key_event.O
+	{0x8934C2E8FC11A513, 24746, 21, 85},  // force_feedback.DAMPER
+	{0xEA1037D3E3223B5B, 10585, 13, 378},  // key_event.TV2
+	{0xFD1A589C9C5A1011, 6921, 16, 229},  // KEY_KBDILLUMDOWN
+	{0x9C1B88B9541919F4, 15043, 22, 561},  // KEY_ROTATE_LOCK_TOGGLE
+	{0x71D24837640D386C, 462, 14, 2},  // event_type.REL
+	{0xF34E94B61DFB1B18, 15149, 16, 576},  // KEY_BUTTONCONFIG
+	{0x89ABF8DE3CD00CBF, 1721, 5, 36},  // KEY_J
+	{0, 0, 0, 0},
+	{0x38E13F41E65F99A5, 3779, 15, 116},  // key_event.POWER
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xE245FC012BC021DD, 10213, 7, 367},  // KEY_MHP
+	{0, 0, 0, 0},
+	{0x3088546BA962811B, 21989, 24, 28},  // absolute_axis.TOOL_WIDTH
+	{0xE45BD3D883277698, 9897, 15, 355},  // key_event.CLEAR
+	{0xCB03658D91EE68A6, 7974, 19, 274},  // button_event.MIDDLE
+	{0xE4BBADF970D46D3D, 2546, 20, 70},  // key_event.SCROLLLOCK
+	{0x9F76C26DF1D843F5, 17235, 27, 645},  // key_event.TRADITIONAL_SONAR
+	{0x3E18E48D50A2231A, 16533, 21, 629},  // key_event.FASTREVERSE
+	{0, 0, 0, 0},
+	{0x80989C7D5DCE1F2D, 12230, 16, 434},  // key_event.DOLLAR
+	{0x591B760039C377F5, 24668, 9, 83},  // FF_SPRING
+	{0x8B3E7871C7F9FA85, 807, 13, 2},  // SYN_MT_REPORT
+	{0x8E9DD1021C9AFA8F, 21921, 20, 26},  // absolute_axis.TILT_X
+	{0xE8A07699DAEC448D, 2459, 6, 67},  // KEY_F9
+	{0xB383D9ECE4EE04E0, 1709, 11, 35},  // key_event.H
+	{0, 0, 0, 0},
+	{0x379452D0CB349348, 11836, 24, 424},  // key_event.GRAPHICSEDITOR
+	{0x98227416C740CEB6, 2339, 6, 61},  // KEY_F3
+	{0xC7EF26E878F4A915, 4158, 14, 128},  // key_event.STOP
+	{0xB88AEBFE81C4A7EE, 13729, 13, 513},  // KEY_NUMERIC_1
+	{0x114422AC55DE22FD, 11313, 8, 407},  // KEY_NEXT
+	{0, 0, 0, 0},
+	{0xB2593A7B07E2F2B7, 7542, 14, 246},  // key_event.WWAN
+	{0xBBBF756951BD5351, 5166, 22, 162},  // key_event.EJECTCLOSECD
+	{0x405CA381CCBE0189, 2589, 7, 72},  // KEY_KP8
+	{0x6DB8E102E1885A03, 19332, 28, 714},  // button_event.TRIGGER_HAPPY11
+	{0, 0, 0, 0},
+	{0x10CDADA6335703F1, 8609, 8, 305},  // BTN_EAST
+	{0x2A7CD358A01169ED, 7888, 18, 272},  // button_event.MOUSE
+	{0x758BA9C24C2C7A3F, 5757, 8, 182},  // KEY_REDO
+	{0x7CAC1923282FDC77, 9526, 19, 331},  // button_event.STYLUS
+	{0xED95ADF40D44FEFB, 2190, 20, 55},  // key_event.KPASTERISK
+	{0xCD66AF899B17772A, 12802, 12, 464},  // key_event.FN
+	{0, 0, 0, 0},
+	{0xD74C6469EACFAA7E, 4209, 15, 130},  // key_event.PROPS
+	{0x8EE62C4735994B02, 17795, 11, 669},  // KEY_MACRO14
+	{0x77E8D43C87B78870, 7716, 14, 258},  // button_event.2
+	{0xB9DDAE81FD7BDEA9, 15331, 15, 581},  // KEY_SCREENSAVER
+	{0xFB32458C867D586B, 24283, 16, 2},  // repeat_event.CNT
+	{0xE81D441E866356F9, 5255, 16, 165},  // KEY_PREVIOUSSONG
+	{0x02C7CE4FB99021E1, 20858, 13, 768},  // key_event.CNT
+	{0x4CAE68C9CBBD7F65, 6637, 8, 221},  // KEY_SHOP
+	{0, 0, 0, 0},
+	{0x497261A35159A95C, 12385, 16, 439},  // KEY_MEDIA_REPEAT
+	{0xCF0E20DB56492C87, 10351, 15, 372},  // KEY_FULL_SCREEN
+	{0xDA016161B241BB77, 1143, 5, 9},  // KEY_8
+	{0xE44255D6D08D7B06, 2154, 20, 54},  // key_event.RIGHTSHIFT
+	{0xDD3347CABF3ECF3E, 10075, 11, 362},  // KEY_PROGRAM
+	{0, 0, 0, 0},
+	{0x10B2C08A62897A7D, 12744, 18, 450},  // key_event.INS_LINE
+	{0x9C3F6D2041CEC6F5, 1534, 20, 27},  // key_event.RIGHTBRACE
+	{0xF02089C8B7F8C295, 22802, 17, 64},  // absolute_axis.CNT
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x59B8792830897F49, 13865, 13, 517},  // KEY_NUMERIC_5
+	{0x392FCAC52BBF3E6C, 21334, 15, 1},  // absolute_axis.Y
+	{0, 0, 0, 0},
+	{0xA6E2352870AD358C, 7668, 5, 256},  // BTN_0
+	{0, 0, 0, 0},
+	{0x5AA73D7C3B5BBE4E, 8636, 9, 307},  // BTN_NORTH
+	{0x0AD8F3A77F971671, 11322, 14, 407},  // key_event.NEXT
+	{0, 0, 0, 0},
+	{0x001FB93E59ECD588, 1809, 14, 40},  // KEY_APOSTROPHE
+	{0, 0, 0, 0},
+	{0x9DD290E814C36564, 17047, 23, 641},  // key_event.FISHING_CHART
+	{0, 0, 0, 0},
+	{0x7350B8B4C58978A8, 10761, 9, 386},  // KEY_TUNER
+	{0x9E4E9C0C667E92C2, 2047, 5, 50},  // KEY_M
+	{0x2A6312F62CDC9BD5, 17957, 17, 674},  // key_event.MACRO19
+	{0xE8F3B9B108B8AC93, 18077, 17, 678},  // key_event.MACRO23
+	{0x218C9767741BDA8C, 18645, 23, 697},  // key_event.KBD_LCD_MENU2
+	{0, 0, 0, 0},
+	{0xF4F1FD79761C5A9D, 23538, 16, 16},  // SW_MACHINE_COVER
+	{0x88AFACD173788104, 3634, 16, 111},  // key_event.DELETE
+	{0xEE4D8E7ECC42C28A, 433, 6, 1},  // EV_KEY
+	{0xB6BCD2F281CC5248, 23996, 15, 5},  // led_event.SLEEP
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0xF646ABAF2FCFC111, 3275, 11, 98},  // KEY_KPSLASH
+	{0, 0, 0, 0},
+	{0xD78ADC71A9E327EA, 10537, 6, 376},  // KEY_PC
+	{0x575483F10D1F35E9, 4333, 15, 135},  // key_event.PASTE
+	{0x218BA5FD4E1C25D0, 15578, 24, 592},  // key_event.BRIGHTNESS_MIN
+	{0, 0, 0, 0},
+	{0xEA4E69DAE76689C4, 24412, 15, 8},  // sound_event.CNT
+	{0xD358F4F433681AB2, 22476, 16, 55},  // ABS_MT_TOOL_TYPE
+	{0x3E1E6CBAD8607931, 21100, 8, 9},  // REL_MISC
+	{0, 0, 0, 0},
+	{0xB8C287EC8F434C81, 2366, 12, 62},  // key_event.F4
+	{0, 0, 0, 0},
+	{0x2034754AC260C711, 17591, 10, 662},  // KEY_MACRO7
+	{0, 0, 0, 0},
+	{0xABDE131CF51737AF, 13373, 12, 497},  // KEY_BRL_DOT1
+	{0x2631490E21B3A479, 23372, 14, 12},  // SW_ROTATE_LOCK
+	{0x7A4807F7380DFB42, 22608, 15, 58},  // ABS_MT_PRESSURE
+	{0xD5414B832AB081A4, 903, 25, 15},  // synchronization_event.MAX
+	{0xBF92D62D5F10D7F5, 5847, 7, 186},  // KEY_F16
+	{0x3A4B099D53F48E49, 12191, 10, 433},  // KEY_LOGOFF
+	{0xAFDD899D6A8BB7EA, 8719, 14, 305},  // button_event.B
+	{0xF95FE1F694984A31, 24810, 19, 87},  // force_feedback.RAMP
+	{0x392DD9A2FE624248, 14075, 17, 523},  // KEY_NUMERIC_POUND
+	{0, 0, 0, 0},
+	{0x5FA69CCF98116BA4, 17397, 25, 649},  // key_event.BRIGHTNESS_MENU
+	{0x0C3331F7E8A16D2F, 25122, 27, 88},  // force_feedback.WAVEFORM_MIN
+	{0x819C00C0686B1D69, 8803, 14, 309},  // button_event.Z
+	{0x048CFE0001EEE38C, 24146, 7, 15},  // LED_MAX
+	{0xC2E7DFD29E02366C, 11861, 16, 425},  // KEY_PRESENTATION
+	{0x3614AE645A1E7DCD, 2029, 5, 49},  // KEY_N
+	{0xCD37F3B1899E4C3A, 9716, 9, 336},  // BTN_WHEEL
+	{0x1450FAA3D94FBB1F, 6961, 14, 230},  // KEY_KBDILLUMUP
+	{0x8196BB73C0033329, 22794, 7, 64},  // ABS_CNT
+	{0xA1676244D48B632F, 18906, 27, 705},  // button_event.TRIGGER_HAPPY2
+	{0x21194EF8914A36DE, 12608, 22, 445},  // key_event.PICKUP_PHONE
+	{0x3767ADFF0B6F307A, 5766, 14, 182},  // key_event.REDO
+	{0xE308594E8A250174, 22192, 18, 49},  // ABS_MT_TOUCH_MINOR
+	{0x08CEEE8AD5022A8F, 24884, 25, 87},  // force_feedback.EFFECT_MAX
+	{0, 0, 0, 0},
+	{0x7E15899FE0CFB4B3, 3376, 18, 101},  // key_event.LINEFEED
+	{0, 0, 0, 0},
+	{0x9D252453D248A87A, 2075, 15, 51},  // key_event.COMMA
+	{0x8EF6B748CD774DCE, 12425, 16, 440},  // KEY_10CHANNELSUP
+	{0x62C957DECEFD85DC, 563, 6, 18},  // EV_SND
+	{0x39AE01130D755E03, 15423, 19, 583},  // key_event.ASSISTANT
+	{0xBF1A5100929A5FE1, 22163, 28, 48},  // absolute_axis.MT_TOUCH_MAJOR
+	{0x3FE36771ED749F44, 10905, 9, 392},  // KEY_AUDIO
+	{0x6819761021A9F8D9, 11762, 16, 422},  // key_event.EDITOR
+	{0x29D6FA10912E57A7, 1107, 5, 7},  // KEY_6
+	{0xED1DE2BC61CCA22A, 1233, 15, 13},  // key_event.EQUAL
+	{0x837302706C08DC3C, 8618, 17, 305},  // button_event.EAST
+	{0, 0, 0, 0},
+	{0xF23F2BC037C5B286, 14819, 17, 542},  // KEY_LIGHTS_TOGGLE
+	{0x848206BDE0620657, 7641, 8, 256},  // BTN_MISC
+	{0x20FF5440C710084D, 21226, 27, 12},  // relative_axis.HWHEEL_HI_RES
+	{0x0C08AD0D1878BB58, 12247, 8, 435},  // KEY_EURO
+	{0x21E53AC174674316, 821, 31, 2},  // synchronization_event.MT_REPORT
+	{0x896F660E6AC03545, 22650, 15, 59},  // ABS_MT_DISTANCE
+	{0x48C30B9289C865AA, 6201, 17, 205},  // key_event.SUSPEND
+	{0x6C44C19775E8C5DF, 20922, 15, 2},  // relative_axis.Z
+	{0x00CF5F0C1AD3A680, 2123, 15, 53},  // key_event.SLASH
+	{0, 0, 0, 0},
+	{0xA50FFA842AD5B376, 1113, 11, 7},  // key_event.6
+	{0xEE05E2D5DA4D81DA, 14706, 22, 539},  // key_event.ATTENDANT_ON
+	{0x007E4A591EFF8359, 15529, 11, 586},  // KEY_DICTATE
+	{0x0CFCDE99BC726D9E, 2299, 6, 59},  // KEY_F1
+	{0x821CB6B7DA6B1A95, 8137, 12, 288},  // BTN_JOYSTICK
+	{0x128D284F2AA575E9, 1197, 9, 12},  // KEY_MINUS
+	{0x5A83288CCF37F8F8, 13266, 14, 482},  // key_event.FN_F
+	{0xCAA19E9DB219A5EE, 19949, 19, 727},  // BTN_TRIGGER_HAPPY24
+	{0xC77657B141A913AA, 17777, 17, 668},  // key_event.MACRO13
+	{0x4DF6ED58F4DA817A, 8031, 18, 276},  // button_event.EXTRA
+	{0x8B24C56C1CBA4FD1, 4404, 14, 138},  // key_event.HELP
+	{0, 0, 0, 0},
+	{0x5DE4FF5A33157CED, 727, 10, 0},  // SYN_REPORT
+	{0x01E7327BD181D02D, 5855, 13, 186},  // key_event.F16
+	{0x66E868A65D9C633A, 9745, 13, 336},  // BTN_GEAR_DOWN
+	{0xD5289E74F148AC2A, 10883, 7, 391},  // KEY_MP3
+	{0, 0, 0, 0},
+	{0xE3B8D6C074DD53BD, 4806, 20, 152},  // key_event.SCREENLOCK
+	{0, 0, 0, 0},
+	{0x73293874F9210CA4, 7449, 19, 244},  // KEY_BRIGHTNESS_ZERO
+	{0x3C945ED85A007795, 7298, 20, 241},  // key_event.VIDEO_NEXT
+	{0x3C32562D131A835B, 13218, 14, 480},  // key_event.FN_D
+	{0x4D0DD6D32469936F, 11221, 21, 403},  // key_event.CHANNELDOWN
+	{0x9458F405141EC45B, 2241, 9, 57},  // KEY_SPACE
+	{0x839FE1CE00B8C7D7, 24066, 8, 8},  // LED_MISC
+	{0x1C7AB39D3EBAF799, 2663, 7, 75},  // KEY_KP4
+	{0xF3625E4AEB2F16E1, 12561, 29, 444},  // key_event.NOTIFICATION_CENTER
+	{0xEEF4291B93344EB2, 506, 14, 4},  // event_type.MSC
+	{0x11C44C727EF15B16, 18227, 17, 683},  // key_event.MACRO28
+	{0x4AB47994172B229D, 13709, 19, 512},  // key_event.NUMERIC_0
+	{0x5CD2EB2F86B8F172, 19312, 19, 714},  // BTN_TRIGGER_HAPPY11
+	{0xAEE6489D60898D62, 16489, 10, 628},  // KEY_UNMUTE
+	{0x8F6C82FE6A4D8E36, 17602, 16, 662},  // key_event.MACRO7
+	{0, 0, 0, 0},
+	{0x9E8270F912487923, 9496, 18, 330},  // button_event.TOUCH
+	{0, 0, 0, 0},
+	{0xE78ACB3383560AF9, 25038, 11, 92},  // FF_SAW_DOWN
+	{0x9F86FC39F3E35AB8, 2091, 7, 52},  // KEY_DOT
+	{0, 0, 0, 0},
+	{0x769F36CF21D9C2BF, 7319, 14, 242},  // KEY_VIDEO_PREV
+	{0xACCC32184AC84E30, 20684, 19, 742},  // BTN_TRIGGER_HAPPY39
+	{0x3CB0BB8E3F45C2D2, 17945, 11, 674},  // KEY_MACRO19
+	{0xD30EABE089607DBD, 6611, 9, 220},  // KEY_SPORT
+	{0x05F2D463A3662B19, 24114, 12, 10},  // LED_CHARGING
+	{0x204EA624FB9C0ED0, 7334, 20, 242},  // key_event.VIDEO_PREV
+	{0x00803B49B67D8F87, 8021, 9, 276},  // BTN_EXTRA
+	{0, 0, 0, 0},
+	{0xB9D43B1FD52BF6A3, 20263, 28, 733},  // button_event.TRIGGER_HAPPY30
+	{0x67BB63AE7D7B4EFD, 11269, 8, 405},  // KEY_LAST
+	{0x4107CFC19D239036, 23771, 13, 5},  // MSC_TIMESTAMP
+	{0xBFFACA6A4D575F51, 6693, 10, 223},  // KEY_CANCEL
+	{0xA5D634D94641653F, 22904, 29, 2},  // switch_event.HEADPHONE_INSERT
+	{0xCB03DF4D079A483D, 10105, 11, 363},  // KEY_CHANNEL
+	{0xB1254D53CA5D42ED, 6056, 16, 200},  // key_event.PLAYCD
+	{0x6932E8406690EE2C, 15483, 19, 584},  // KEY_KBD_LAYOUT_NEXT
+	{0xE78918EC3B41D951, 19704, 19, 722},  // BTN_TRIGGER_HAPPY19
+	{0x57071EDBC19195EA, 5811, 13, 184},  // key_event.F14
+	{0x4731A0FE0601ADF8, 5789, 13, 183},  // key_event.F13
+	{0x91B2473E5E7BAC78, 13088, 16, 475},  // key_event.FN_F10
+	{0x698BE510071161A4, 4349, 8, 136},  // KEY_FIND
+	{0, 0, 0, 0},
+	{0x6D37BA8658DC9EC1, 2685, 7, 76},  // KEY_KP5
+	{0x8AA47C689C63230E, 1359, 5, 19},  // KEY_R
+	{0, 0, 0, 0},
+	{0xB65C10F4CBD24E7B, 3211, 11, 96},  // KEY_KPENTER
+	{0x2B7E0C13AF345469, 13314, 14, 484},  // key_event.FN_B
+	{0xAB24F1E1DEDD7EB8, 22307, 28, 51},  // absolute_axis.MT_WIDTH_MINOR
+	{0xAC8B47F5BF90A738, 16347, 17, 624},  // KEY_NEXT_FAVORITE
+	{0x25E71650AF273DB5, 21480, 10, 7},  // ABS_RUDDER
+	{0x02094032833C2999, 5413, 13, 170},  // key_event.ISO
+	{0xE792A6FD575E98B8, 20557, 28, 739},  // button_event.TRIGGER_HAPPY36
+	{0, 0, 0, 0},
+	{0x5FE400E280A43A8E, 16555, 15, 630},  // KEY_SLOWREVERSE
+	{0x15701F85124BF2A9, 5825, 7, 185},  // KEY_F15
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x7064D0BACDC7C175, 2346, 12, 61},  // key_event.F3
+	{0x7C12F6060C423ED0, 6321, 19, 209},  // key_event.BASSBOOST
+	{0x14F79645AAF3A78E, 2446, 12, 66},  // key_event.F8
+	{0, 0, 0, 0},
+	{0x2B002DC9D03613CB, 10177, 13, 365},  // key_event.EPG
+	{0x4D1B8CEF2216E504, 16146, 20, 620},  // key_event.NUMERIC_11
+	{0xE36EB3756B77284E, 14093, 23, 523},  // key_event.NUMERIC_POUND
+	{0xFB13C7593DC4F9E6, 15909, 31, 612},  // key_event.KBDINPUTASSIST_ACCEPT
+	{0x7FE380FBB9890D6B, 10293, 12, 370},  // KEY_SUBTITLE
+	{0x7669061C7D15B2A0, 18215, 11, 683},  // KEY_MACRO28
+	{0xF69BF1F5A9DB8A58, 10413, 8, 373},  // KEY_MODE
+	{0x0FEEBC6DFCE46215, 9291, 15, 325},  // BTN_TOOL_FINGER
+	{0x7E0EEC3E4C0C6D27, 13675, 19, 506},  // key_event.BRL_DOT10
+	{0x319627F787FA2FF9, 4452, 14, 140},  // key_event.CALC
+	{0x3E11048C28E8C226, 1649, 5, 32},  // KEY_D
+	{0, 0, 0, 0},
+	{0xEAB2F49A43F3010D, 484, 14, 3},  // event_type.ABS
+	{0x2A11EEFD4D8F1A18, 12484, 24, 441},  // key_event.10CHANNELSDOWN
+	{0xB17E5C2DB39A2EE7, 10815, 8, 388},  // KEY_TEXT
+	{0xE2EEC3D667883BD5, 1207, 15, 12},  // key_event.MINUS
+	{0xEAD3C11E60E2D6D7, 5221, 13, 164},  // KEY_PLAYPAUSE
+	{0x8F82C20B4F66A58F, 11555, 14, 416},  // KEY_VIDEOPHONE
+	{0x0D7C494A56D028F2, 8491, 9, 299},  // BTN_BASE6
+	{0x56DC3F441A0B9107, 12957, 15, 470},  // key_event.FN_F5
+	{0x3D7131F82325BEFC, 1089, 5, 6},  // KEY_5
+	{0xE0B1712660CD904C, 2379, 6, 63},  // KEY_F5
+	{0x08CD1B8888377B0E, 2406, 12, 64},  // key_event.F6
+	{0x455922D7CC24D1F1, 3315, 15, 99},  // key_event.SYSRQ
+	{0x5F4538AAD0D90CD4, 20850, 7, 768},  // KEY_CNT
+	{0xC2C9CD52D36B7C17, 5589, 12, 177},  // KEY_SCROLLUP
+	{0x4310592D443B9D46, 21403, 16, 4},  // absolute_axis.RY
+	{0x6E71B0883F45C896, 16725, 24, 634},  // KEY_SELECTIVE_SCREENSHOT
+	{0x911D61FFD060AE45, 18519, 23, 692},  // key_event.MACRO_PRESET2
+	{0xD16A59ED773274C9, 22624, 25, 58},  // absolute_axis.MT_PRESSURE
+	{0x29076BDCE18E57A2, 585, 6, 20},  // EV_REP
+	{0x1490EB032863E63D, 1981, 11, 46},  // key_event.C
+	{0x854372595342037A, 8050, 11, 277},  // BTN_FORWARD
+	{0x9399FAB2EFE48E07, 4119, 11, 127},  // KEY_COMPOSE
+	{0x7CFD957F3D2A3ED7, 17009, 19, 640},  // key_event.NAV_CHART
+	{0, 0, 0, 0},
+	{0x638C0B52C5311623, 1673, 11, 33},  // key_event.F
+	{0x592999097E26FC7C, 10267, 9, 369},  // KEY_TITLE
+	{0x86CB7329DFA63719, 4199, 9, 130},  // KEY_PROPS
+	{0x39B9C584B0A4A90F, 12713, 17, 449},  // key_event.DEL_EOS
+	{0xAECC16141E3A8DDA, 23659, 12, 1},  // MSC_PULSELED
+	{0xCC54254F40229046, 15503, 25, 584},  // key_event.KBD_LAYOUT_NEXT
+	{0xE3D674E3D68A25E7, 22744, 23, 61},  // absolute_axis.MT_TOOL_Y
+	{0x02771EB42D13BFC1, 2823, 7, 82},  // KEY_KP0
+	{0, 0, 0, 0},
+	{0x302A76E0D0B16B83, 7557, 9, 246},  // KEY_WIMAX
+	{0xC37BB1E8D6B583B2, 7878, 9, 272},  // BTN_MOUSE
+	{0x0B140949155DD8A2, 8119, 17, 279},  // button_event.TASK
+	{0x76601EE9909D2F10, 929, 7, 16},  // SYN_CNT
+	{0x1BA3B617E54409DF, 24363, 16, 2},  // sound_event.TONE
+	{0x923318F17B22DFF7, 2963, 7, 88},  // KEY_F12
+	{0x0B193370844E8098, 13469, 12, 500},  // KEY_BRL_DOT4
+	{0, 0, 0, 0},
+	{0x4477E911EC0995EC, 16475, 13, 627},  // key_event.VOD
+	{0, 0, 0, 0},
+	{0x617B1CA5EDD500F7, 5405, 7, 170},  // KEY_ISO
+	{0xD50A9D955CBA9027, 20894, 5, 1},  // REL_Y
+	{0xECC21A6172DDB911, 18953, 27, 706},  // button_event.TRIGGER_HAPPY3
+	{0x079D2DDD89EDD713, 20986, 6, 5},  // REL_RZ
+	{0x2CD29164F7BC105C, 1059, 11, 4},  // key_event.3
+	{0, 0, 0, 0},
+	{0x936B651544471336, 2399, 6, 64},  // KEY_F6
+	{0, 0, 0, 0},
+	{0x6909114E2110C5F2, 11675, 13, 420},  // KEY_ZOOMRESET
+	{0xFCE743BFF59506BC, 12465, 18, 441},  // KEY_10CHANNELSDOWN
+	{0xF0FBFF73EAEEC180, 20753, 28, 743},  // button_event.TRIGGER_HAPPY40
+	{0, 0, 0, 0},
+	{0x07E3CE7E85BD7DB3, 10691, 6, 383},  // KEY_CD
+	{0, 0, 0, 0},
+	{0xE0B9068F32DF1A09, 11052, 18, 397},  // key_event.CALENDAR
+	{0xCAEDF4E81A2291AB, 21788, 19, 22},  // absolute_axis.HAT3X
+	{0xC337B3E55EEB87BE, 23182, 18, 8},  // SW_VIDEOOUT_INSERT
+	{0xA5CDC6669468D89E, 23962, 8, 4},  // LED_KANA
+	{0xA149DE145448FC6C, 7689, 5, 257},  // BTN_1
+	{0x747F195375105808, 22692, 13, 60},  // ABS_MT_TOOL_X
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x1A06EC3765487104, 7511, 21, 245},  // key_event.DISPLAY_OFF
+	{0, 0, 0, 0},
+	{0x2D8BC018D26A2FCC, 16444, 22, 626},  // key_event.PAUSE_RECORD
+	{0xFA95B00D8B3AA231, 24910, 9, 88},  // FF_SQUARE
+	{0x50845AF4358F0B56, 21042, 8, 7},  // REL_DIAL
+	{0x71147431ACBCE1F0, 14349, 25, 530},  // key_event.TOUCHPAD_TOGGLE
+	{0x4BFFBE4DEE65E5B4, 22934, 13, 3},  // SW_RFKILL_ALL
+	{0, 0, 0, 0},
+	{0xBB2AFAA0444A48A5, 2671, 13, 75},  // key_event.KP4
+	{0xFCC788B8C7AA56C1, 17735, 11, 667},  // KEY_MACRO12
+	{0x19C1068294B26926, 6896, 24, 228},  // key_event.KBDILLUMTOGGLE
+	{0x58BFA837AADE4BFE, 18729, 23, 699},  // key_event.KBD_LCD_MENU4
+	{0x171F6BD08605B13C, 1581, 12, 29},  // KEY_LEFTCTRL
+	{0x8187C6E0E74ACC6A, 20635, 19, 741},  // BTN_TRIGGER_HAPPY38
+	{0x5FA6D77DFC16DD7B, 11591, 9, 417},  // KEY_GAMES
+	{0xB21D6D1BE56317F4, 205, 27, 4},  // input_property.TOPBUTTONPAD
+	{0x68066E15006D6C08, 25236, 25, 97},  // force_feedback.AUTOCENTER
+	{0, 0, 0, 0},
+	{0x87499B368CC1AC56, 7842, 14, 264},  // button_event.8
+	{0, 0, 0, 0},
+	{0xFFCCBC4039A68763, 14001, 13, 521},  // KEY_NUMERIC_9
+	{0x78B85F1BB377D9F4, 24388, 15, 7},  // sound_event.MAX
+	{0xFB5013E62F1C3295, 14270, 22, 528},  // key_event.CAMERA_FOCUS
+	{0x22730ECABA24EE11, 22110, 11, 47},  // ABS_MT_SLOT
+	{0x21E5480298498F9C, 12701, 11, 449},  // KEY_DEL_EOS
+	{0, 0, 0, 0},
+	{0x7B6AA057197B8E8F, 10422, 14, 373},  // key_event.MODE
+	{0x56649A9AD00D5D44, 7611, 11, 248},  // KEY_MICMUTE
+	{0xCA47D3B2C7E0491B, 9546, 11, 332},  // BTN_STYLUS2
+	{0xDAB414A4F75422A3, 25222, 13, 97},  // FF_AUTOCENTER
+	{0x625ED3657086FFF6, 9371, 13, 327},  // BTN_TOOL_LENS
+	{0x3E16899CB03B774C, 14233, 19, 527},  // key_event.NUMERIC_D
+	{0x700777C0F770D7D4, 21778, 9, 22},  // ABS_HAT3X
+	{0, 0, 0, 0},
+	{0xDA7BE4A1E0ADFD41, 3539, 8, 108},  // KEY_DOWN
+	{0, 0, 0, 0},
+	{0xB930D36CD6CBCF17, 16329, 17, 623},  // key_event.3D_MODE
+	{0xFA03A54D6CFDA16D, 10745, 15, 385},  // key_event.RADIO
+	{0x538275642853C892, 6593, 17, 219},  // key_event.FINANCE
+	{0x022F455E3AC83A92, 7031, 15, 232},  // key_event.REPLY
+	{0xAF0AC350B3A603EC, 22776, 17, 63},  // absolute_axis.MAX
+	{0x0A9C614EAE38E933, 9063, 8, 320},  // BTN_DIGI
+	{0, 0, 0, 0},
+	{0x37FC670A55BA4923, 662, 20, 23},  // event_type.FF_STATUS
+	{0xCF48D5B4FD8BCAE5, 93, 20, 2},  // INPUT_PROP_BUTTONPAD
+	{0x4F6629FFB040DEA3, 2809, 13, 81},  // key_event.KP3
+	{0xFBD1F98A0AA93C00, 16031, 14, 615},  // KEY_RIGHT_DOWN
+	{0xA4D66464A894E99F, 23723, 7, 3},  // MSC_RAW
+	{0x00876FCDB6059FAC, 11071, 7, 398},  // KEY_RED
+	{0x3EBC4C00A398E6BF, 12362, 22, 438},  // key_event.CONTEXT_MENU
+	{0x4662AD3168DCE99A, 18459, 17, 691},  // KEY_MACRO_PRESET1
+	{0x367AAF25D4A2A3CE, 683, 6, 31},  // EV_MAX
+	{0x270512A933B1E1EE, 7815, 5, 263},  // BTN_7
+	{0, 0, 0, 0},
+	{0xAD5EB77C2ADCC24A, 8245, 19, 290},  // button_event.THUMB2
+	{0x2FB47A3F82F7FE6B, 9012, 19, 317},  // button_event.THUMBL
+	{0xDF8EA6018C9256A9, 5541, 8, 175},  // KEY_MOVE
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0, 0, 0, 0},
+	{0x7C3E8A713DA14F8E, 21010, 10, 6},  // REL_HWHEEL
+	{0xDF2DE0ECE0DE339D, 12947, 9, 470},  // KEY_FN_F5
+	{0x2FA7E90216B687D3, 15022, 20, 560},  // key_event.ALS_TOGGLE
+};
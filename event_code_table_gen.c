@@ -0,0 +1,229 @@
+#include <stdio.h>
+#include <linux/input.h>
+#include <linux/input-event-codes.h>
+#include "event_code_names.h"
+
+// Writes event_code_table.h: the builtin constants in a perfect hash table with one displacement per bucket of about this many names
+#define BUCKET_LENGTH 4
+#define MAX_SEEDS 64
+
+typedef TYPED_HASH_TABLE(size_t) NameIndex;
+
+typedef struct {
+	const char *name;
+	long long value;
+	uint64_t pre_hash;
+	uint64_t hash;
+} Constant;
+
+static Constant *constants = NULL;
+static size_t constant_count = 0, constant_capacity = 0;
+static NameIndex name_index;
+
+// A repeated name keeps its first position and takes the last value, like inserting into a ConstantRegistry
+static bool
+add_constant(const char * name, long long value)
+{
+	HashTableKey key = hash_table_key_from_cstr(name);
+	HashTableIndex existing = hash_table_find(&name_index, key);
+	if (existing >= 0) {
+		constants[name_index.value_array[existing]].value = value;
+		return true;
+	}
+	if (constant_count == constant_capacity) {
+		size_t capacity = constant_capacity * 2 + 16;
+		Constant *new_constants = T_REALLOC(constants, capacity, Constant);
+		if (!new_constants) {
+			return false;
+		}
+		constants = new_constants;
+		constant_capacity = capacity;
+	}
+	constants[constant_count] = (Constant) {
+		.name = name,
+		.value = value,
+		.pre_hash = key.pre_hash,
+		.hash = 0,
+	};
+	if (hash_table_insert(&name_index, key, &constant_count) < 0) {
+		return false;
+	}
+	++constant_count;
+	return true;
+}
+
+static bool
+collect_constants()
+{
+	bool success = add_constant("false", 0) && add_constant("true", 1);
+
+#define DECLARE_EVENT_CODE(enum_name, prefix_name, unqualified_name) { \
+	const long long value = prefix_name##_##unqualified_name; \
+	success = success && add_constant(#prefix_name "_" #unqualified_name, value); \
+	success = success && add_constant(#enum_name "." #unqualified_name, value); \
+}
+
+#include "event_code_names.cc"
+
+#undef DECLARE_EVENT_CODE
+	return success;
+}
+
+// Buckets are placed from the largest one, each takes the first displacement that moves all its names to free slots
+static bool
+place(uint64_t seed, size_t slot_count, size_t bucket_count, uint16_t * displacements, ssize_t * slots)
+{
+	size_t *bucket_starts = T_ALLOC(bucket_count + 1, size_t);
+	size_t *bucket_cursors = T_ALLOC(bucket_count, size_t);
+	size_t *order = T_ALLOC(constant_count, size_t);
+	size_t *buckets_by_length = T_ALLOC(bucket_count, size_t);
+	size_t *positions = T_ALLOC(constant_count, size_t);
+	bool success = false;
+	if (!bucket_starts || !bucket_cursors || !order || !buckets_by_length || !positions) {
+		goto end;
+	}
+
+	for (size_t i = 0; i < constant_count; ++i) {
+		constants[i].hash = builtin_constant_mix(constants[i].pre_hash, seed);
+		++bucket_starts[builtin_constant_bucket(constants[i].hash, bucket_count) + 1];
+	}
+	size_t max_length = 0;
+	for (size_t b = 0; b < bucket_count; ++b) {
+		if (bucket_starts[b + 1] > max_length) {
+			max_length = bucket_starts[b + 1];
+		}
+		bucket_starts[b + 1] += bucket_starts[b];
+		bucket_cursors[b] = bucket_starts[b];
+	}
+	for (size_t i = 0; i < constant_count; ++i) {
+		order[bucket_cursors[builtin_constant_bucket(constants[i].hash, bucket_count)]++] = i;
+	}
+	size_t sorted = 0;
+	for (size_t length = max_length; length > 0; --length) {
+		for (size_t b = 0; b < bucket_count; ++b) {
+			if (bucket_starts[b + 1] - bucket_starts[b] == length) {
+				buckets_by_length[sorted++] = b;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < slot_count; ++i) {
+		slots[i] = -1;
+	}
+	for (size_t k = 0; k < sorted; ++k) {
+		size_t b = buckets_by_length[k];
+		size_t start = bucket_starts[b], end = bucket_starts[b + 1];
+		bool placed = false;
+		for (uint32_t displacement = 0; displacement <= UINT16_MAX && !placed; ++displacement) {
+			placed = true;
+			for (size_t j = start; j < end && placed; ++j) {
+				positions[j] = builtin_constant_slot(constants[order[j]].hash, displacement, slot_count - 1);
+				placed = slots[positions[j]] < 0;
+				for (size_t l = start; l < j && placed; ++l) {
+					placed = positions[l] != positions[j];
+				}
+			}
+			if (placed) {
+				displacements[b] = displacement;
+			}
+		}
+		if (!placed) {
+			goto end;
+		}
+		for (size_t j = start; j < end; ++j) {
+			slots[positions[j]] = order[j];
+		}
+	}
+	success = true;
+
+end:
+	free(bucket_starts);
+	free(bucket_cursors);
+	free(order);
+	free(buckets_by_length);
+	free(positions);
+	return success;
+}
+
+static bool
+emit(uint64_t seed, size_t slot_count, size_t bucket_count, const uint16_t * displacements, const ssize_t * slots)
+{
+	size_t *offsets = T_ALLOC(constant_count, size_t);
+	if (!offsets) {
+		return false;
+	}
+	for (size_t i = 0, offset = 0; i < constant_count; ++i) {
+		offsets[i] = offset;
+		offset += strlen(constants[i].name) + 1;
+	}
+
+	printf("// Generated by event_code_table_gen from event_code_names.cc\n\n");
+	printf("#define BUILTIN_CONSTANT_SEED 0x%016llX\n", (unsigned long long) seed);
+	printf("#define BUILTIN_CONSTANT_SLOT_MASK %zu\n", slot_count - 1);
+	printf("#define BUILTIN_CONSTANT_BUCKET_COUNT %zu\n\n", bucket_count);
+
+	printf("static const char builtin_constant_names[] =");
+	for (size_t i = 0; i < constant_count; ++i) {
+		printf("\n\t\"%s\\0\"", constants[i].name);
+	}
+	printf(";\n\n");
+
+	printf("static const uint16_t builtin_constant_displacements[%zu] = {", bucket_count);
+	for (size_t b = 0; b < bucket_count; ++b) {
+		printf("%s%u,", b % 16 ? " " : "\n\t", displacements[b]);
+	}
+	printf("\n};\n\n");
+
+	printf("static const BuiltinConstant builtin_constants[%zu] = {\n", slot_count);
+	for (size_t i = 0; i < slot_count; ++i) {
+		if (slots[i] < 0) {
+			printf("\t{0, 0, 0, 0},\n");
+			continue;
+		}
+		const Constant *constant = &constants[slots[i]];
+		printf("\t{0x%016llX, %zu, %zu, %lld},  // %s\n", (unsigned long long) constant->pre_hash, offsets[slots[i]], strlen(constant->name), constant->value, constant->name);
+	}
+	printf("};\n");
+	free(offsets);
+	return true;
+}
+
+int
+main()
+{
+	hash_table_init(&name_index, NULL);
+	if (!collect_constants()) {
+		fprintf(stderr, "Failed to collect the builtin constants\n");
+		return 1;
+	}
+
+	size_t slot_count = 1;
+	while (slot_count < constant_count + constant_count / 8) {
+		slot_count <<= 1;
+	}
+	size_t bucket_count = (constant_count + BUCKET_LENGTH - 1) / BUCKET_LENGTH;
+	uint16_t *displacements = T_ALLOC(bucket_count, uint16_t);
+	ssize_t *slots = T_ALLOC(slot_count, ssize_t);
+	if (!displacements || !slots) {
+		return 1;
+	}
+	uint64_t seed = 0;
+	bool placed = false;
+	for (size_t attempt = 0; attempt < MAX_SEEDS && !placed; ++attempt) {
+		seed = builtin_constant_mix(attempt, 0x2D358DCCAA6C78A5);
+		placed = place(seed, slot_count, bucket_count, displacements, slots);
+	}
+	if (!placed) {
+		fprintf(stderr, "No perfect hash found for %zu builtin constants\n", constant_count);
+		return 1;
+	}
+	if (!emit(seed, slot_count, bucket_count, displacements, slots)) {
+		return 1;
+	}
+
+	free(displacements);
+	free(slots);
+	free(constants);
+	hash_table_deinit(&name_index);
+	return 0;
+}
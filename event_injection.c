@@ -0,0 +1,100 @@
+#include <sys/eventfd.h>
+#include <unistd.h>
+#include "event_injection.h"
+
+// Vyukov's intrusive queue: producers swap themselves in as the tail and then link the previous one, the consumer walks from the head, which is the stub node when the queue is drained
+static struct {
+	_Atomic(EventInjection*) tail;
+	EventInjection *head;
+	EventInjection stub;
+	atomic_bool wake_pending;
+	int wake_fd;
+} queue = {
+	.tail = &queue.stub,
+	.head = &queue.stub,
+	.stub = {.next = NULL},
+	.wake_pending = false,
+	.wake_fd = -1,
+};
+
+static void
+link_tail(EventInjection * injection)
+{
+	atomic_store_explicit(&injection->next, NULL, memory_order_relaxed);
+	EventInjection *prev = atomic_exchange_explicit(&queue.tail, injection, memory_order_acq_rel);
+	atomic_store_explicit(&prev->next, injection, memory_order_release);
+}
+
+void
+event_injection_push(EventInjection * injection)
+{
+	link_tail(injection);
+	// Only the first push after a drain signals
+	if (!atomic_exchange(&queue.wake_pending, true) && queue.wake_fd >= 0) {
+		uint64_t one = 1;
+		ssize_t status = write(queue.wake_fd, &one, sizeof(one));
+		(void) status;  // Cannot overflow with one write per drain
+	}
+}
+
+// Returns NULL when empty or when the next producer has not linked its node yet, that producer signals again
+static EventInjection *
+pop()
+{
+	EventInjection *head = queue.head;
+	EventInjection *next = atomic_load_explicit(&head->next, memory_order_acquire);
+	if (head == &queue.stub) {
+		if (!next) {
+			return NULL;
+		}
+		queue.head = head = next;
+		next = atomic_load_explicit(&head->next, memory_order_acquire);
+	}
+	if (next) {
+		queue.head = next;
+		return head;
+	}
+	if (atomic_load_explicit(&queue.tail, memory_order_acquire) != head) {
+		return NULL;
+	}
+	// The last node can only be taken once another one follows it
+	link_tail(&queue.stub);
+	next = atomic_load_explicit(&head->next, memory_order_acquire);
+	if (next) {
+		queue.head = next;
+		return head;
+	}
+	return NULL;
+}
+
+size_t
+event_injection_drain()
+{
+	// Reset before clearing the flag, so a push that finds it clear signals after this read
+	if (queue.wake_fd >= 0) {
+		uint64_t count;
+		ssize_t status = read(queue.wake_fd, &count, sizeof(count));
+		(void) status;  // Fails with EAGAIN if not signalled
+	}
+	atomic_store(&queue.wake_pending, false);
+	size_t delivered = 0;
+	EventInjection *injection;
+	while ((injection = pop())) {
+		// event_create inserts by time, so the injections are merged into the timeline
+		EventNode *event = event_create(&injection->data);
+		injection->deliver(injection, event);
+		++delivered;
+	}
+	return delivered;
+}
+
+int
+event_injection_wake_fd()
+{
+	return queue.wake_fd;
+}
+
+MODULE_CONSTRUCTOR(init)
+{
+	queue.wake_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+}
@@ -0,0 +1,23 @@
+#ifndef EVENT_INJECTION_H_
+#define EVENT_INJECTION_H_
+
+#include <stdatomic.h>
+#include "events.h"
+
+typedef struct event_injection EventInjection;
+
+// Intrusive node of the injection queue, owned by the producer until delivered
+struct event_injection {
+	_Atomic(EventInjection*) next;
+	EventData data;  // Copied into the created event
+	void (*deliver)(EventInjection * self, EventNode * event);  // Called on the processing thread with the created event or NULL if it could not be allocated, may release self
+};
+
+// Lock-free, may be called from any thread or signal handler, the event is created by the next event_injection_drain
+void event_injection_push(EventInjection * injection);
+// Only called by the processing thread, creates the events of the pushed injections in time order among the existing ones. Returns the number of delivered injections
+size_t event_injection_drain();
+// Becomes readable after a push until the next drain, -1 if unavailable
+int event_injection_wake_fd();
+
+#endif /* end of include guard: EVENT_INJECTION_H_ */
@@ -1,17 +1,165 @@
+#include <errno.h>
+#include <inttypes.h>
 #include <limits.h>
+#include <string.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 #include "event_predicate.h"
+#include "event_predicate_kernels.h"
+#include "event_predicate_native.h"
+#include "event_predicate_set.h"
+
+typedef enum {
+	FOLD_PENDING,
+	FOLD_IN_PROGRESS,
+	FOLD_VARIABLE,
+	FOLD_DISABLED,
+	FOLD_ACCEPTED,
+	FOLD_REJECTED,
+} EventPredicateFoldState;
+
+typedef enum {
+	EVPROG_CONST,  // result = insn.result
+	EVPROG_RANGE,  // result = insn.min_value <= fields[insn.field] <= insn.max_value
+	EVPROG_MODIFIER,  // result = event has modifier insn.min_value
+	EVPROG_MODIFIER_MASK,  // result = event modifiers match the mask of the insn.handle predicate
+	EVPROG_SET,  // result = fields[insn.field] is in the value set of the insn.handle predicate
+	EVPROG_NOT,  // Inverts the result unless disabled
+	EVPROG_NOT_IF_INVERTED,  // Inverts the result unless disabled if the insn.handle predicate is inverted
+	EVPROG_SKIP_IF_DISABLED,  // result = disabled, jump to insn.target if the insn.handle predicate is disabled
+	EVPROG_JUMP_IF,  // Jump to insn.target if result == insn.result
+	EVPROG_APPLY,  // result = event_predicate_apply(insn.handle), used for predicates shared by several parents to reuse the cached result
+} EventPredicateOpcode;
+
+typedef struct {
+	uint8_t opcode;
+	uint8_t field;
+	int8_t result;
+	EventPredicateHandle handle;
+	uint32_t target;
+	int64_t min_value, max_value;
+} EventPredicateInstruction;
+
+#define EVPRED_PROGRAM_NO_TARGET UINT32_MAX
+#define EVPRED_PROGRAM_MAX_LENGTH EVPRED_PROGRAM_NO_TARGET  // Jump targets are 32-bit
+#define EVPRED_FIELD_COUNT 5
+#define EVPRED_PROFILE_SAMPLE_PERIOD 16  // Power of two
+
+typedef struct {
+	size_t depth;  // Nesting of the aggregates below, at most EVPRED_MAX_DEPTH
+	bool is_mutable;
+	bool has_mutable_descendant;  // Set by folding, also for a descendant in a reference cycle
+	EventPredicateFoldState fold_state;
+	EventPredicateFoldState body_state;  // Fold state before applying the own flags
+	bool has_folded_body;
+	EventPredicate folded_body;  // Used instead of the definition type and data, folded_body.inverted is applied on top of the definition flags
+	EventPredicateInstruction *program;  // NULL if not compiled, the tree is walked then
+	size_t program_length;
+	EventPredicateNativeFunction native;  // The program translated to machine code, NULL if not loaded
+	size_t reference_count;  // Number of aggregates using this predicate, counted by event_predicate_compile_all
+	uint64_t cached_key_id;  // Result cache, valid if equal to the current cache key id and flags generation
+	uint64_t cached_flags_generation;
+	EventPredicateResult cached_result;
+	EventPredicateValueSet value_set;  // Lookup table of the set predicates, empty for the other types
+	EventPredicateProfile profile;
+	uint64_t visit_mark;  // Last flag change that reached this predicate
+	EventPredicateDependent **dependents;
+	size_t dependents_length;
+	size_t dependents_capacity;
+} EventPredicateAnnotation;
+
+// Fields of the last evaluated event, the cached results are valid only for an event with the same fields
+typedef struct {
+	uint64_t id;
+	EventCode code;
+	int64_t payload;
+	size_t input_index;
+	size_t modifiers_length;
+	size_t modifiers_capacity;
+	uint8_t *modifier_bits;
+} EventPredicateCacheKey;
 
 typedef struct {
 	size_t capacity;
 	size_t length;
 	EventPredicate *values;
+	EventPredicateAnnotation *annotations;
 } EventPredicateList;
 
 static EventPredicateList predicates = {
 	.length = 0,
 	.capacity = 0,
 	.values = NULL,
+	.annotations = NULL,
+};
+
+static EventPredicateCacheKey cache_key = {
+	.id = 0,
+	.modifiers_length = 0,
+	.modifiers_capacity = 0,
+	.modifier_bits = NULL,
+};
+static uint64_t flags_generation = 1;  // Changed whenever a result may change for the same event
+static uint64_t visit_generation = 0;
+
+// Reverse edges of the folded bodies, the aggregates that have to be invalidated when the flags of a predicate change
+static struct {
+	size_t length;  // Number of predicates covered, 0 if out of date
+	size_t *offsets;  // The parents of predicate i are handles[offsets[i]] to handles[offsets[i + 1]]
+	EventPredicateHandle *handles;
+	EventPredicateHandle *stack;  // Scratch space of event_predicate_flags_changed
+} parents = {
+	.length = 0,
+	.offsets = NULL,
+	.handles = NULL,
+	.stack = NULL,
 };
+static bool profiling = false;
+
+static bool
+event_predicate_cache_key_matches(const EventNode * event)
+{
+	const EventData *data = &event->data;
+	return cache_key.id
+		&& cache_key.code.ns == data->code.ns
+		&& cache_key.code.major == data->code.major
+		&& cache_key.code.minor == data->code.minor
+		&& cache_key.payload == data->payload
+		&& cache_key.input_index == event->input_index
+		&& cache_key.modifiers_length == data->modifiers.byte_length
+		&& (!cache_key.modifiers_length || memcmp(cache_key.modifier_bits, data->modifiers.bits, cache_key.modifiers_length) == 0);
+}
+
+// Returns the cache key id for the event, 0 if the results cannot be cached
+static uint64_t
+event_predicate_cache_key_update(const EventNode * event)
+{
+	if (event_predicate_cache_key_matches(event)) {
+		return cache_key.id;
+	}
+	const EventData *data = &event->data;
+	size_t modifiers_length = data->modifiers.byte_length;
+	if (modifiers_length > cache_key.modifiers_capacity) {
+		uint8_t *bits = T_REALLOC(cache_key.modifier_bits, modifiers_length, uint8_t);
+		if (!bits) {
+			cache_key.id = 0;
+			return 0;
+		}
+		cache_key.modifier_bits = bits;
+		cache_key.modifiers_capacity = modifiers_length;
+	}
+	static uint64_t last_id = 0;
+	cache_key.id = ++last_id;
+	cache_key.code = data->code;
+	cache_key.payload = data->payload;
+	cache_key.input_index = event->input_index;
+	cache_key.modifiers_length = modifiers_length;
+	if (modifiers_length) {
+		memcpy(cache_key.modifier_bits, data->modifiers.bits, modifiers_length);
+	}
+	return cache_key.id;
+}
 
 static bool
 event_predicate_list_extend(EventPredicateList * lst)
@@ -30,29 +178,80 @@ event_predicate_list_extend(EventPredicateList * lst)
 	}
 	lst->values = new_values;
 
+	EventPredicateAnnotation *new_annotations;
+	if (lst->annotations) {
+		new_annotations = T_REALLOC(lst->annotations, capacity, EventPredicateAnnotation);
+	} else {
+		new_annotations = T_ALLOC(capacity, EventPredicateAnnotation);
+	}
+	if (!new_annotations) {
+		return false;
+	}
+	lst->annotations = new_annotations;
+
 	lst->capacity = capacity;
 	return true;
 }
 
 static void
-event_predicate_list_clear(EventPredicateList * lst)
+event_predicate_annotation_clear_body(EventPredicateAnnotation * annotation)
 {
-	if (lst->values) {
-		for (size_t i = 0; i < lst->length; ++i) {
-			EventPredicateType type = lst->values[i].type;
-			if (type == EVPRED_CONJUNCTION || type == EVPRED_DISJUNCTION) {
-				if (lst->values[i].aggregate_data.handles) {
-					free(lst->values[i].aggregate_data.handles);
-				}
-			}
+	if (!annotation->has_folded_body) {
+		return;
+	}
+	EventPredicateType type = annotation->folded_body.type;
+	if (type == EVPRED_CONJUNCTION || type == EVPRED_DISJUNCTION) {
+		if (annotation->folded_body.aggregate_data.handles) {
+			free(annotation->folded_body.aggregate_data.handles);
+		}
+	}
+	annotation->has_folded_body = false;
+}
+
+static void
+event_predicate_list_release(EventPredicateList * lst, size_t i)
+{
+	EventPredicateType type = lst->values[i].type;
+	if (type == EVPRED_CONJUNCTION || type == EVPRED_DISJUNCTION) {
+		if (lst->values[i].aggregate_data.handles) {
+			free(lst->values[i].aggregate_data.handles);
 		}
-		free(lst->values);
-		lst->values = NULL;
 	}
+	if (type == EVPRED_CODE_SET || type == EVPRED_PAYLOAD_SET) {
+		free(lst->values[i].set_data.values);
+	}
+	if (type == EVPRED_MODIFIER_MASK) {
+		modifier_set_destruct(&lst->values[i].modifier_mask_data.required);
+		modifier_set_destruct(&lst->values[i].modifier_mask_data.forbidden);
+		modifier_set_destruct(&lst->values[i].modifier_mask_data.any);
+	}
+	event_predicate_annotation_clear_body(&lst->annotations[i]);
+	free(lst->annotations[i].program);
+	free(lst->annotations[i].dependents);
+	event_predicate_value_set_destroy(&lst->annotations[i].value_set);
+}
+
+static void
+event_predicate_list_clear(EventPredicateList * lst)
+{
+	for (size_t i = 0; i < lst->length; ++i) {
+		event_predicate_list_release(lst, i);
+	}
+	free(lst->values);
+	lst->values = NULL;
+	free(lst->annotations);
+	lst->annotations = NULL;
 	lst->capacity = 0;
 	lst->length = 0;
 }
 
+static int
+compare_values(const void * lhs, const void * rhs)
+{
+	int64_t a = *(const int64_t*) lhs, b = *(const int64_t*) rhs;
+	return (a > b) - (a < b);
+}
+
 EventPredicateHandle
 event_predicate_register(EventPredicate predicate)
 {
@@ -60,11 +259,72 @@ event_predicate_register(EventPredicate predicate)
 	if (i >= INT32_MAX) {
 		return -1;
 	}
+	// The arguments are registered before, so the predicates cannot form a cycle
+	size_t depth = 0;
+	if ((predicate.type == EVPRED_CONJUNCTION || predicate.type == EVPRED_DISJUNCTION) && predicate.aggregate_data.handles) {
+		for (size_t j = 0; j < predicate.aggregate_data.length; ++j) {
+			EventPredicateHandle child = predicate.aggregate_data.handles[j];
+			if (child < 0) {
+				continue;
+			}
+			if ((size_t) child >= i) {
+				errno = EINVAL;
+				return -1;
+			}
+			if (depth <= predicates.annotations[child].depth) {
+				depth = predicates.annotations[child].depth + 1;
+			}
+		}
+	}
+	if (depth > EVPRED_MAX_DEPTH) {
+		errno = ELOOP;
+		return -1;
+	}
 	while (i >= predicates.capacity) {
-		event_predicate_list_extend(&predicates);
+		if (!event_predicate_list_extend(&predicates)) {
+			return -1;
+		}
+	}
+	bool is_set = predicate.type == EVPRED_CODE_SET || predicate.type == EVPRED_PAYLOAD_SET;
+	if (is_set) {
+		int64_t *values = predicate.set_data.values;
+		size_t length = 0;
+		if (values) {
+			qsort(values, predicate.set_data.length, sizeof(int64_t), &compare_values);
+			for (size_t j = 0; j < predicate.set_data.length; ++j) {
+				if (!length || values[length - 1] != values[j]) {
+					values[length++] = values[j];
+				}
+			}
+		}
+		predicate.set_data.length = length;
 	}
 	predicates.values[i] = predicate;
+	predicates.annotations[i] = (EventPredicateAnnotation) {
+		.depth = depth,
+		.is_mutable = false,
+		.has_mutable_descendant = false,
+		.fold_state = FOLD_PENDING,
+		.body_state = FOLD_PENDING,
+		.has_folded_body = false,
+		.program = NULL,
+		.program_length = 0,
+		.native = NULL,
+		.reference_count = 0,
+		.cached_key_id = 0,
+		.cached_flags_generation = 0,
+		.cached_result = EVPREDRES_DISABLED,
+		.profile = {
+			.evaluations = 0,
+		},
+		.visit_mark = 0,
+		.dependents = NULL,
+		.dependents_length = 0,
+		.dependents_capacity = 0,
+	};
+	event_predicate_value_set_build(&predicates.annotations[i].value_set, is_set ? predicate.set_data.values : NULL, is_set ? predicate.set_data.length : 0);
 	predicates.length = i + 1;
+	parents.length = 0;  // The new predicate may reference the old ones
 	return (EventPredicateHandle) i;
 }
 
@@ -92,16 +352,130 @@ event_predicate_get(EventPredicateHandle handle)
 	}
 }
 
-EventPredicateResult
-event_predicate_apply(EventPredicateHandle handle, EventNode * event)
+EventPredicate
+event_predicate_get_folded(EventPredicateHandle handle)
 {
-	EventPredicate *ptr = event_predicate_get_ptr(handle);
-	if (!ptr) {
-		return EVPREDRES_DISABLED;
+	EventPredicate result = event_predicate_get(handle);
+	if (result.type == EVPRED_INVALID || !predicates.annotations[handle].has_folded_body) {
+		return result;
 	}
-	if (!ptr->enabled) {
+	const EventPredicate *body = &predicates.annotations[handle].folded_body;
+	bool inverted = result.inverted != body->inverted;
+	bool enabled = result.enabled;
+	result = *body;
+	result.enabled = enabled;
+	result.inverted = inverted;
+	return result;
+}
+
+bool
+event_predicate_is_mutable(EventPredicateHandle handle)
+{
+	if (!event_predicate_get_ptr(handle)) {
+		return false;
+	}
+	return predicates.annotations[handle].is_mutable;
+}
+
+static EventPredicateResult
+event_predicate_run(const EventPredicateInstruction * program, size_t length, EventNode * event)
+{
+	// Same order as the range predicate types
+	const int64_t fields[] = {
+		event->data.code.ns,
+		event->data.code.major,
+		event->data.code.minor,
+		event->data.payload,
+		event->input_index,
+	};
+	EventPredicateResult result = EVPREDRES_DISABLED;
+	size_t pc = 0;
+	while (pc < length) {
+		const EventPredicateInstruction *insn = &program[pc++];
+		switch ((EventPredicateOpcode) insn->opcode) {
+		case EVPROG_CONST:
+			result = insn->result;
+			break;
+		case EVPROG_RANGE:
+			{
+				int64_t actual = fields[insn->field];
+				result = insn->min_value <= actual && actual <= insn->max_value ? EVPREDRES_ACCEPTED : EVPREDRES_REJECTED;
+			}
+			break;
+		case EVPROG_MODIFIER:
+			result = modifier_set_has(event->data.modifiers, insn->min_value) ? EVPREDRES_ACCEPTED : EVPREDRES_REJECTED;
+			break;
+		case EVPROG_MODIFIER_MASK:
+			{
+				const EventPredicate *mask = &predicates.values[insn->handle];
+				result = modifier_set_matches_mask(event->data.modifiers, mask->modifier_mask_data.required, mask->modifier_mask_data.forbidden, mask->modifier_mask_data.any) ? EVPREDRES_ACCEPTED : EVPREDRES_REJECTED;
+			}
+			break;
+		case EVPROG_SET:
+			result = event_predicate_value_set_contains(&predicates.annotations[insn->handle].value_set, fields[insn->field]) ? EVPREDRES_ACCEPTED : EVPREDRES_REJECTED;
+			break;
+		case EVPROG_NOT_IF_INVERTED:
+			if (!predicates.values[insn->handle].inverted) {
+				break;
+			}
+			// fallthrough
+		case EVPROG_NOT:
+			if (result != EVPREDRES_DISABLED) {
+				result = result == EVPREDRES_ACCEPTED ? EVPREDRES_REJECTED : EVPREDRES_ACCEPTED;
+			}
+			break;
+		case EVPROG_SKIP_IF_DISABLED:
+			if (!predicates.values[insn->handle].enabled) {
+				result = EVPREDRES_DISABLED;
+				pc = insn->target;
+			}
+			break;
+		case EVPROG_JUMP_IF:
+			if (result == insn->result) {
+				pc = insn->target;
+			}
+			break;
+		case EVPROG_APPLY:
+			// The argument is nested less deeply, so the programs run inside each other at most EVPRED_MAX_DEPTH times
+			result = event_predicate_apply(insn->handle, event);
+			break;
+		}
+	}
+	return result;
+}
+
+static EventPredicateResult
+event_predicate_evaluate(EventPredicateHandle handle, EventNode * event)
+{
+	EventPredicate *definition = &predicates.values[handle];
+	const EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+	if (annotation->native && event) {
+		const EventPredicateNativeEvent native_event = {
+			.fields = {
+				event->data.code.ns,
+				event->data.code.major,
+				event->data.code.minor,
+				event->data.payload,
+				event->input_index,
+			},
+			.modifier_bits = event->data.modifiers.bits,
+			.modifier_length = event->data.modifiers.byte_length,
+			.event = event,
+		};
+		return (EventPredicateResult) annotation->native(&native_event);
+	}
+	if (annotation->program && event) {
+		return event_predicate_run(annotation->program, annotation->program_length, event);
+	}
+	if (!definition->enabled) {
 		return EVPREDRES_DISABLED;
 	}
+	bool inverted = definition->inverted;
+	EventPredicate *ptr = definition;
+	if (predicates.annotations[handle].has_folded_body) {
+		ptr = &predicates.annotations[handle].folded_body;
+		inverted = inverted != ptr->inverted;
+	}
 	bool accepted = false;
 	switch (ptr->type) {
 	case EVPRED_INVALID:
@@ -146,7 +520,7 @@ event_predicate_apply(EventPredicateHandle handle, EventNode * event)
 			bool disjunction = ptr->type == EVPRED_DISJUNCTION;
 			accepted = !disjunction;
 			for (size_t i = 0; i < ptr->aggregate_data.length; ++i) {
-				EventPredicateResult child_result = event_predicate_apply(ptr->aggregate_data.handles[i], event);  // TODO protect from stack overflow
+				EventPredicateResult child_result = event_predicate_apply(ptr->aggregate_data.handles[i], event);  // Bounded by EVPRED_MAX_DEPTH
 				bool should_stop = false;
 				switch (child_result) {
 				case EVPREDRES_DISABLED:
@@ -176,36 +550,1394 @@ event_predicate_apply(EventPredicateHandle handle, EventNode * event)
 			accepted = modifier_set_has(event->data.modifiers, ptr->single_modifier);
 		}
 		break;
+	case EVPRED_MODIFIER_MASK:
+		if (!event) {
+			return EVPREDRES_DISABLED;
+		}
+		accepted = modifier_set_matches_mask(event->data.modifiers, ptr->modifier_mask_data.required, ptr->modifier_mask_data.forbidden, ptr->modifier_mask_data.any);
+		break;
+	case EVPRED_CODE_SET:
+	case EVPRED_PAYLOAD_SET:
+		if (!event) {
+			return EVPREDRES_DISABLED;
+		}
+		accepted = event_predicate_value_set_contains(&annotation->value_set, ptr->type == EVPRED_CODE_SET ? event->data.code.minor : event->data.payload);
+		break;
 	default:
 		return EVPREDRES_DISABLED;
 	}
-	if (ptr->inverted) {
+	if (inverted) {
 		accepted = !accepted;
 	}
 	return accepted ? EVPREDRES_ACCEPTED : EVPREDRES_REJECTED;
 }
 
+static inline uint64_t
+profile_timestamp()
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t) now.tv_sec * NANOSECONDS_IN_SECOND + now.tv_nsec;
+#endif
+}
+
+static void
+profile_count(EventPredicateProfile * profile, uint64_t accepted, uint64_t rejected, uint64_t disabled)
+{
+	profile->evaluations += accepted + rejected + disabled;
+	profile->accepted += accepted;
+	profile->rejected += rejected;
+	profile->disabled += disabled;
+}
+
+static EventPredicateResult
+event_predicate_apply_cached(EventPredicateHandle handle, EventNode * event)
+{
+	if (!event) {
+		return event_predicate_evaluate(handle, event);
+	}
+	uint64_t key_id = event_predicate_cache_key_update(event);
+	EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+	if (key_id && annotation->cached_key_id == key_id && annotation->cached_flags_generation == flags_generation) {
+		return annotation->cached_result;
+	}
+	EventPredicateResult result = event_predicate_evaluate(handle, event);
+	annotation->cached_key_id = key_id;
+	annotation->cached_flags_generation = flags_generation;
+	annotation->cached_result = result;
+	return result;
+}
+
+// Every EVPRED_PROFILE_SAMPLE_PERIOD-th evaluation is timed
+static EventPredicateResult
+event_predicate_apply_profiled(EventPredicateHandle handle, EventNode * event)
+{
+	bool sample = (predicates.annotations[handle].profile.evaluations & (EVPRED_PROFILE_SAMPLE_PERIOD - 1)) == 0;
+	uint64_t start = sample ? profile_timestamp() : 0;
+	EventPredicateResult result = event_predicate_apply_cached(handle, event);
+	EventPredicateProfile *profile = &predicates.annotations[handle].profile;
+	if (sample) {
+		profile->sampled_cycles += profile_timestamp() - start;
+		++profile->samples;
+	}
+	profile_count(profile, result == EVPREDRES_ACCEPTED, result == EVPREDRES_REJECTED, result == EVPREDRES_DISABLED);
+	return result;
+}
+
+EventPredicateResult
+event_predicate_apply(EventPredicateHandle handle, EventNode * event)
+{
+	if (!event_predicate_get_ptr(handle)) {
+		return EVPREDRES_DISABLED;
+	}
+	if (profiling) {
+		return event_predicate_apply_profiled(handle, event);
+	}
+	return event_predicate_apply_cached(handle, event);
+}
+
+// Lanes that took a jump, waiting for the program counter to reach the target
+typedef struct {
+	uint32_t target;
+	uint64_t lanes;
+} EventPredicateBatchJump;
+
+typedef struct {
+	size_t length;
+	EventPredicateBatchJump jumps[2 * EVPRED_MAX_DEPTH + 4];  // Nearest target last
+} EventPredicateBatchJumps;
+
+static bool
+batch_jumps_push(EventPredicateBatchJumps * pending, uint32_t target, uint64_t lanes)
+{
+	if (!lanes) {
+		return true;
+	}
+	size_t i = pending->length;
+	while (i > 0 && pending->jumps[i - 1].target <= target) {
+		if (pending->jumps[i - 1].target == target) {
+			pending->jumps[i - 1].lanes |= lanes;
+			return true;
+		}
+		--i;
+	}
+	if (pending->length >= lengthof(pending->jumps)) {
+		return false;
+	}
+	memmove(&pending->jumps[i + 1], &pending->jumps[i], (pending->length - i) * sizeof(EventPredicateBatchJump));
+	pending->jumps[i] = (EventPredicateBatchJump) {
+		.target = target,
+		.lanes = lanes,
+	};
+	++pending->length;
+	return true;
+}
+
+// Runs the program for up to EVPRED_BATCH_LANES events at once, a lane is accepted or disabled if the corresponding bit is set, rejected if neither is
+// Jumps only deactivate the lanes taking them, they are resumed at the target
+static bool
+event_predicate_run_batch(const EventPredicateInstruction * program, size_t length, EventNode ** events, size_t count, uint64_t * accepted_lanes, uint64_t * disabled_lanes)
+{
+	// Struct of arrays, same order as the range predicate types
+	int64_t columns[EVPRED_FIELD_COUNT][EVPRED_BATCH_LANES] __attribute__((aligned(32)));
+	for (size_t lane = 0; lane < EVPRED_BATCH_LANES; ++lane) {
+		if (lane < count) {
+			const EventNode *event = events[lane];
+			columns[0][lane] = event->data.code.ns;
+			columns[1][lane] = event->data.code.major;
+			columns[2][lane] = event->data.code.minor;
+			columns[3][lane] = event->data.payload;
+			columns[4][lane] = event->input_index;
+		} else {
+			for (size_t field = 0; field < EVPRED_FIELD_COUNT; ++field) {
+				columns[field][lane] = 0;
+			}
+		}
+	}
+
+	const uint64_t all = count >= EVPRED_BATCH_LANES ? UINT64_MAX : ((uint64_t) 1 << count) - 1;
+	uint64_t active = all, accepted = 0, disabled = all;
+	EventPredicateBatchJumps pending = {
+		.length = 0,
+	};
+	size_t pc = 0;
+	while (pc < length) {
+		while (pending.length && pending.jumps[pending.length - 1].target <= pc) {
+			active |= pending.jumps[--pending.length].lanes;
+		}
+		if (!active) {
+			if (!pending.length) {
+				break;
+			}
+			pc = pending.jumps[pending.length - 1].target;
+			continue;
+		}
+		const EventPredicateInstruction *insn = &program[pc++];
+		uint64_t result_accepted = 0, result_disabled = 0;
+		switch ((EventPredicateOpcode) insn->opcode) {
+		case EVPROG_CONST:
+			result_accepted = insn->result == EVPREDRES_ACCEPTED ? active : 0;
+			result_disabled = insn->result == EVPREDRES_DISABLED ? active : 0;
+			break;
+		case EVPROG_RANGE:
+			result_accepted = event_predicate_range_mask(columns[insn->field], insn->min_value, insn->max_value) & active;
+			break;
+		case EVPROG_MODIFIER:
+			for (uint64_t lanes = active; lanes; lanes &= lanes - 1) {
+				size_t lane = __builtin_ctzll(lanes);
+				if (modifier_set_has(events[lane]->data.modifiers, insn->min_value)) {
+					result_accepted |= (uint64_t) 1 << lane;
+				}
+			}
+			break;
+		case EVPROG_MODIFIER_MASK:
+			{
+				const EventPredicate *mask = &predicates.values[insn->handle];
+				for (uint64_t lanes = active; lanes; lanes &= lanes - 1) {
+					size_t lane = __builtin_ctzll(lanes);
+					if (modifier_set_matches_mask(events[lane]->data.modifiers, mask->modifier_mask_data.required, mask->modifier_mask_data.forbidden, mask->modifier_mask_data.any)) {
+						result_accepted |= (uint64_t) 1 << lane;
+					}
+				}
+			}
+			break;
+		case EVPROG_SET:
+			{
+				const EventPredicateValueSet *set = &predicates.annotations[insn->handle].value_set;
+				for (uint64_t lanes = active; lanes; lanes &= lanes - 1) {
+					size_t lane = __builtin_ctzll(lanes);
+					if (event_predicate_value_set_contains(set, columns[insn->field][lane])) {
+						result_accepted |= (uint64_t) 1 << lane;
+					}
+				}
+			}
+			break;
+		case EVPROG_NOT_IF_INVERTED:
+			if (!predicates.values[insn->handle].inverted) {
+				continue;
+			}
+			// fallthrough
+		case EVPROG_NOT:
+			accepted ^= active & ~disabled;
+			continue;
+		case EVPROG_SKIP_IF_DISABLED:
+			if (predicates.values[insn->handle].enabled) {
+				continue;
+			}
+			result_disabled = active;
+			if (!batch_jumps_push(&pending, insn->target, active)) {
+				return false;
+			}
+			active = 0;
+			break;
+		case EVPROG_JUMP_IF:
+			{
+				uint64_t taken = active;
+				switch (insn->result) {
+				case EVPREDRES_ACCEPTED:
+					taken &= accepted;
+					break;
+				case EVPREDRES_REJECTED:
+					taken &= ~accepted & ~disabled;
+					break;
+				default:
+					taken &= disabled;
+					break;
+				}
+				if (!batch_jumps_push(&pending, insn->target, taken)) {
+					return false;
+				}
+				active &= ~taken;
+			}
+			continue;
+		case EVPROG_APPLY:
+			for (uint64_t lanes = active; lanes; lanes &= lanes - 1) {
+				size_t lane = __builtin_ctzll(lanes);
+				switch (event_predicate_apply(insn->handle, events[lane])) {
+				case EVPREDRES_ACCEPTED:
+					result_accepted |= (uint64_t) 1 << lane;
+					break;
+				case EVPREDRES_DISABLED:
+					result_disabled |= (uint64_t) 1 << lane;
+					break;
+				default:
+					break;
+				}
+			}
+			break;
+		}
+		uint64_t written = active | result_disabled;
+		accepted = (accepted & ~written) | result_accepted;
+		disabled = (disabled & ~written) | result_disabled;
+	}
+	*accepted_lanes = accepted & ~disabled;
+	*disabled_lanes = disabled;
+	return true;
+}
+
+void
+event_predicate_apply_batch(EventPredicateHandle handle, EventNode ** events, size_t count, uint64_t * accepted)
+{
+	const EventPredicateAnnotation *annotation = event_predicate_get_ptr(handle) ? &predicates.annotations[handle] : NULL;
+	for (size_t start = 0; start < count; start += EVPRED_BATCH_LANES) {
+		size_t lanes = count - start < EVPRED_BATCH_LANES ? count - start : EVPRED_BATCH_LANES;
+		uint64_t *word = &accepted[start / EVPRED_BATCH_LANES];
+		uint64_t disabled;
+		uint64_t timestamp = profiling ? profile_timestamp() : 0;
+		if (annotation && annotation->program && event_predicate_run_batch(annotation->program, annotation->program_length, events + start, lanes, word, &disabled)) {
+			if (profiling) {
+				EventPredicateProfile *profile = &predicates.annotations[handle].profile;
+				profile->sampled_cycles += profile_timestamp() - timestamp;
+				profile->samples += lanes;
+				size_t accepted_count = __builtin_popcountll(*word), disabled_count = __builtin_popcountll(disabled);
+				profile_count(profile, accepted_count, lanes - accepted_count - disabled_count, disabled_count);
+			}
+			continue;
+		}
+		*word = 0;
+		for (size_t lane = 0; lane < lanes; ++lane) {
+			if (event_predicate_apply(handle, events[start + lane]) == EVPREDRES_ACCEPTED) {
+				*word |= (uint64_t) 1 << lane;
+			}
+		}
+	}
+}
+
+// Invalidates the cached results of the predicate and the aggregates using it and notifies their dependents, each one once
+static void
+event_predicate_flags_changed(EventPredicateHandle handle)
+{
+	if ((size_t) handle >= parents.length) {
+		// Not covered by the graph, every cached result is dropped instead
+		++flags_generation;
+		EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+		for (size_t i = 0; i < annotation->dependents_length; ++i) {
+			annotation->dependents[i]->flags_changed(annotation->dependents[i], handle);
+		}
+		return;
+	}
+	uint64_t mark = ++visit_generation;
+	size_t depth = 0;
+	parents.stack[depth++] = handle;
+	predicates.annotations[handle].visit_mark = mark;
+	while (depth) {
+		EventPredicateHandle current = parents.stack[--depth];
+		EventPredicateAnnotation *annotation = &predicates.annotations[current];
+		annotation->cached_key_id = 0;
+		for (size_t i = 0; i < annotation->dependents_length; ++i) {
+			annotation->dependents[i]->flags_changed(annotation->dependents[i], current);
+		}
+		for (size_t i = parents.offsets[current]; i < parents.offsets[current + 1]; ++i) {
+			EventPredicateHandle parent = parents.handles[i];
+			if (predicates.annotations[parent].visit_mark != mark) {
+				predicates.annotations[parent].visit_mark = mark;
+				parents.stack[depth++] = parent;
+			}
+		}
+	}
+}
+
 void
 event_predicate_set_enabled(EventPredicateHandle handle, bool enabled)
 {
 	EventPredicate *ptr = event_predicate_get_ptr(handle);
-	if (!ptr) {
+	if (!ptr || ptr->enabled == enabled) {
 		return;
 	}
 	ptr->enabled = enabled;
+	event_predicate_flags_changed(handle);
 }
 
 void event_predicate_set_inverted(EventPredicateHandle handle, bool inverted)
 {
 	EventPredicate *ptr = event_predicate_get_ptr(handle);
-	if (!ptr) {
+	if (!ptr || ptr->inverted == inverted) {
 		return;
 	}
 	ptr->inverted = inverted;
+	event_predicate_flags_changed(handle);
+}
+
+bool
+event_predicate_add_dependent(EventPredicateHandle handle, EventPredicateDependent * dependent)
+{
+	if (!event_predicate_get_ptr(handle)) {
+		return false;
+	}
+	EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+	if (annotation->dependents_length == annotation->dependents_capacity) {
+		size_t capacity = annotation->dependents_capacity * 2 + 2;
+		EventPredicateDependent **dependents = annotation->dependents ? T_REALLOC(annotation->dependents, capacity, EventPredicateDependent*) : T_ALLOC(capacity, EventPredicateDependent*);
+		if (!dependents) {
+			return false;
+		}
+		annotation->dependents = dependents;
+		annotation->dependents_capacity = capacity;
+	}
+	annotation->dependents[annotation->dependents_length++] = dependent;
+	return true;
+}
+
+void
+event_predicate_remove_dependent(EventPredicateHandle handle, EventPredicateDependent * dependent)
+{
+	if (!event_predicate_get_ptr(handle)) {
+		return;
+	}
+	EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+	for (size_t i = 0; i < annotation->dependents_length; ++i) {
+		if (annotation->dependents[i] == dependent) {
+			annotation->dependents[i] = annotation->dependents[--annotation->dependents_length];
+			return;
+		}
+	}
+}
+
+// Missing bytes are zero
+static bool
+modifier_sets_equal(const ModifierSet lhs, const ModifierSet rhs)
+{
+	size_t length = lhs.byte_length > rhs.byte_length ? lhs.byte_length : rhs.byte_length;
+	for (size_t i = 0; i < length; i += sizeof(uint64_t)) {
+		if (modifier_set_word(lhs, i) != modifier_set_word(rhs, i)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool
+event_predicate_equivalent(EventPredicateHandle lhs, EventPredicateHandle rhs, bool compare_flags)
+{
+	if (lhs == rhs) {
+		return true;
+	}
+	EventPredicate *lhs_ptr = event_predicate_get_ptr(lhs);
+	EventPredicate *rhs_ptr = event_predicate_get_ptr(rhs);
+	if (!lhs_ptr || !rhs_ptr) {
+		return false;
+	}
+	if (lhs_ptr->type != rhs_ptr->type) {
+		return false;
+	}
+	if (compare_flags) {
+		if (lhs_ptr->enabled != rhs_ptr->enabled || lhs_ptr->inverted != rhs_ptr->inverted) {
+			return false;
+		}
+	}
+	switch (lhs_ptr->type) {
+	case EVPRED_INVALID:
+	case EVPRED_ACCEPT:
+		return true;
+	case EVPRED_CODE_NS...EVPRED_INPUT_INDEX:
+		return lhs_ptr->range_data.min_value == rhs_ptr->range_data.min_value && lhs_ptr->range_data.max_value == rhs_ptr->range_data.max_value;
+	case EVPRED_CONJUNCTION:
+	case EVPRED_DISJUNCTION:
+		if (lhs_ptr->aggregate_data.length != rhs_ptr->aggregate_data.length) {
+			return false;
+		}
+		if (!lhs_ptr->aggregate_data.handles || !rhs_ptr->aggregate_data.handles) {
+			return lhs_ptr->aggregate_data.handles == rhs_ptr->aggregate_data.handles;
+		}
+		for (size_t i = 0; i < lhs_ptr->aggregate_data.length; ++i) {
+			if (!event_predicate_equivalent(lhs_ptr->aggregate_data.handles[i], rhs_ptr->aggregate_data.handles[i], compare_flags)) {
+				return false;
+			}
+		}
+		return true;
+	case EVPRED_MODIFIER:
+		return lhs_ptr->single_modifier == rhs_ptr->single_modifier;
+	case EVPRED_MODIFIER_MASK:
+		return modifier_sets_equal(lhs_ptr->modifier_mask_data.required, rhs_ptr->modifier_mask_data.required)
+			&& modifier_sets_equal(lhs_ptr->modifier_mask_data.forbidden, rhs_ptr->modifier_mask_data.forbidden)
+			&& modifier_sets_equal(lhs_ptr->modifier_mask_data.any, rhs_ptr->modifier_mask_data.any);
+	case EVPRED_CODE_SET:
+	case EVPRED_PAYLOAD_SET:
+		if (lhs_ptr->set_data.length != rhs_ptr->set_data.length) {
+			return false;
+		}
+		return !lhs_ptr->set_data.length || memcmp(lhs_ptr->set_data.values, rhs_ptr->set_data.values, lhs_ptr->set_data.length * sizeof(int64_t)) == 0;
+	default:
+		return false;
+	}
+}
+
+void
+event_predicate_replace_references(EventPredicateHandle old_handle, EventPredicateHandle new_handle, EventPredicateHandle since)
+{
+	if (since < 0) {
+		since = 0;
+	}
+	++flags_generation;
+	parents.length = 0;
+	for (size_t i = since; i < predicates.length; ++i) {
+		EventPredicate *ptr = &predicates.values[i];
+		if (ptr->type != EVPRED_CONJUNCTION && ptr->type != EVPRED_DISJUNCTION) {
+			continue;
+		}
+		if (!ptr->aggregate_data.handles) {
+			continue;
+		}
+		for (size_t j = 0; j < ptr->aggregate_data.length; ++j) {
+			if (ptr->aggregate_data.handles[j] == old_handle) {
+				ptr->aggregate_data.handles[j] = new_handle;
+			}
+		}
+	}
+}
+
+void
+event_predicate_mark_mutable(EventPredicateHandle handle)
+{
+	if (!event_predicate_get_ptr(handle)) {
+		return;
+	}
+	predicates.annotations[handle].is_mutable = true;
+}
+
+static bool
+event_predicate_is_plain_range(EventPredicateHandle handle)
+{
+	EventPredicate *ptr = event_predicate_get_ptr(handle);
+	if (!ptr || predicates.annotations[handle].is_mutable || !ptr->enabled || ptr->inverted) {
+		return false;
+	}
+	switch (ptr->type) {
+	case EVPRED_CODE_NS...EVPRED_INPUT_INDEX:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool
+event_predicate_range_contains(const EventPredicate * outer, const EventPredicate * inner)
+{
+	return outer->range_data.min_value <= inner->range_data.min_value && inner->range_data.max_value <= outer->range_data.max_value;
+}
+
+static bool
+handle_list_append(EventPredicateHandle ** handles, size_t * length, size_t * capacity, EventPredicateHandle handle)
+{
+	if (*length >= *capacity) {
+		size_t new_capacity = *capacity + (*capacity >> 1) + 1;
+		EventPredicateHandle *new_handles = *handles ? T_REALLOC(*handles, new_capacity, EventPredicateHandle) : T_ALLOC(new_capacity, EventPredicateHandle);
+		if (!new_handles) {
+			return false;
+		}
+		*handles = new_handles;
+		*capacity = new_capacity;
+	}
+	(*handles)[(*length)++] = handle;
+	return true;
+}
+
+static EventPredicateFoldState event_predicate_fold(EventPredicateHandle handle);
+
+// Equivalent definitions may still differ in the flags of their mutable parts later
+inline static bool
+event_predicate_depends_on_mutable(EventPredicateHandle handle)
+{
+	return predicates.annotations[handle].is_mutable || predicates.annotations[handle].has_mutable_descendant;
+}
+
+// Adds a non-constant child to the folded aggregate, returns FOLD_ACCEPTED or FOLD_REJECTED if the whole aggregate became constant
+static EventPredicateFoldState
+fold_aggregate_child(EventPredicateType type, EventPredicateHandle child, EventPredicateHandle ** kept, size_t * length, size_t * capacity)
+{
+	bool disjunction = type == EVPRED_DISJUNCTION;
+	EventPredicate *child_ptr = event_predicate_get_ptr(child);
+	EventPredicateAnnotation *child_annotation = &predicates.annotations[child];
+	const EventPredicate *child_body = child_annotation->has_folded_body ? &child_annotation->folded_body : child_ptr;
+
+	// Nested aggregate of the same kind
+	if (!child_annotation->is_mutable && child_annotation->fold_state != FOLD_IN_PROGRESS && child_ptr->enabled && child_ptr->inverted == child_body->inverted && child_body->type == type && child_body->aggregate_data.handles) {
+		for (size_t i = 0; i < child_body->aggregate_data.length; ++i) {
+			EventPredicateFoldState state = fold_aggregate_child(type, child_body->aggregate_data.handles[i], kept, length, capacity);
+			if (state != FOLD_VARIABLE) {
+				return state;
+			}
+		}
+		return FOLD_VARIABLE;
+	}
+
+	bool plain_range = event_predicate_is_plain_range(child);
+	for (size_t i = 0; i < *length; ++i) {
+		EventPredicateHandle other = (*kept)[i];
+		if (other == child) {
+			return FOLD_VARIABLE;
+		}
+		if (!event_predicate_depends_on_mutable(child) && !event_predicate_depends_on_mutable(other) && event_predicate_equivalent(other, child, true)) {
+			return FOLD_VARIABLE;
+		}
+		if (!plain_range || !event_predicate_is_plain_range(other)) {
+			continue;
+		}
+		EventPredicate *other_ptr = event_predicate_get_ptr(other);
+		if (other_ptr->type != child_ptr->type) {
+			continue;
+		}
+		if (disjunction) {
+			if (event_predicate_range_contains(other_ptr, child_ptr)) {
+				return FOLD_VARIABLE;
+			}
+			if (event_predicate_range_contains(child_ptr, other_ptr)) {
+				(*kept)[i] = child;
+				return FOLD_VARIABLE;
+			}
+		} else {
+			if (other_ptr->range_data.max_value < child_ptr->range_data.min_value || child_ptr->range_data.max_value < other_ptr->range_data.min_value) {
+				return FOLD_REJECTED;
+			}
+			if (event_predicate_range_contains(child_ptr, other_ptr)) {
+				return FOLD_VARIABLE;
+			}
+			if (event_predicate_range_contains(other_ptr, child_ptr)) {
+				(*kept)[i] = child;
+				return FOLD_VARIABLE;
+			}
+		}
+	}
+
+	handle_list_append(kept, length, capacity, child);
+	return FOLD_VARIABLE;
+}
+
+// Contradicting and trivial masks are constant, a single tested modifier becomes a modifier predicate
+static EventPredicateFoldState
+fold_modifier_mask(EventPredicateHandle handle)
+{
+	const EventPredicate *ptr = event_predicate_get_ptr(handle);
+	const ModifierSet required = ptr->modifier_mask_data.required;
+	const ModifierSet forbidden = ptr->modifier_mask_data.forbidden;
+	const ModifierSet any = ptr->modifier_mask_data.any;
+	size_t length = required.byte_length;
+	if (forbidden.byte_length > length) {
+		length = forbidden.byte_length;
+	}
+	if (any.byte_length > length) {
+		length = any.byte_length;
+	}
+	size_t tested_count = 0, forbidden_count = 0;
+	uint64_t any_bits = 0, allowed_any = 0;
+	for (size_t i = 0; i < length; i += sizeof(uint64_t)) {
+		uint64_t required_word = modifier_set_word(required, i);
+		uint64_t forbidden_word = modifier_set_word(forbidden, i);
+		uint64_t any_word = modifier_set_word(any, i);
+		if (required_word & forbidden_word) {
+			return FOLD_REJECTED;
+		}
+		any_bits |= any_word;
+		allowed_any |= any_word & ~forbidden_word;
+		tested_count += __builtin_popcountll(required_word | any_word);
+		forbidden_count += __builtin_popcountll(forbidden_word);
+	}
+	if (any_bits && !allowed_any) {
+		return FOLD_REJECTED;
+	}
+	if (!tested_count && !forbidden_count) {
+		return FOLD_ACCEPTED;
+	}
+	if (tested_count != 1 || forbidden_count) {
+		return FOLD_VARIABLE;
+	}
+	for (size_t i = 0; i < length; ++i) {
+		uint8_t byte = (i < required.byte_length ? required.bits[i] : 0) | (i < any.byte_length ? any.bits[i] : 0);
+		if (!byte) {
+			continue;
+		}
+		predicates.annotations[handle].folded_body = (EventPredicate) {
+			.type = EVPRED_MODIFIER,
+			.enabled = true,
+			.inverted = false,
+			.single_modifier = (Modifier) (i * 8 + __builtin_ctz(byte)),
+		};
+		predicates.annotations[handle].has_folded_body = true;
+		break;
+	}
+	return FOLD_VARIABLE;
+}
+
+// Result of the predicate body ignoring the flags, may set the folded body
+static EventPredicateFoldState
+event_predicate_fold_body(EventPredicateHandle handle)
+{
+	EventPredicate *ptr = event_predicate_get_ptr(handle);
+	switch (ptr->type) {
+	case EVPRED_INVALID:
+		return FOLD_DISABLED;
+	case EVPRED_ACCEPT:
+		return FOLD_ACCEPTED;
+	case EVPRED_CODE_NS...EVPRED_INPUT_INDEX:
+		if (ptr->range_data.min_value > ptr->range_data.max_value) {
+			return FOLD_REJECTED;
+		}
+		return FOLD_VARIABLE;
+	case EVPRED_CONJUNCTION:
+	case EVPRED_DISJUNCTION:
+		if (!ptr->aggregate_data.handles) {
+			return FOLD_DISABLED;
+		}
+		break;
+	case EVPRED_MODIFIER:
+		return FOLD_VARIABLE;
+	case EVPRED_MODIFIER_MASK:
+		return fold_modifier_mask(handle);
+	case EVPRED_CODE_SET:
+	case EVPRED_PAYLOAD_SET:
+		if (!ptr->set_data.length) {
+			return FOLD_REJECTED;
+		}
+		if (ptr->set_data.length == 1) {
+			predicates.annotations[handle].folded_body = (EventPredicate) {
+				.type = ptr->type == EVPRED_CODE_SET ? EVPRED_CODE_MINOR : EVPRED_PAYLOAD,
+				.enabled = true,
+				.inverted = false,
+				.range_data = {
+					.min_value = ptr->set_data.values[0],
+					.max_value = ptr->set_data.values[0],
+				},
+			};
+			predicates.annotations[handle].has_folded_body = true;
+		}
+		return FOLD_VARIABLE;
+	default:
+		return FOLD_DISABLED;
+	}
+
+	EventPredicateType type = ptr->type;
+	size_t length = ptr->aggregate_data.length;
+	bool disjunction = type == EVPRED_DISJUNCTION;
+	EventPredicateFoldState absorbing = disjunction ? FOLD_ACCEPTED : FOLD_REJECTED;
+	EventPredicateHandle *kept = NULL;
+	size_t kept_length = 0, kept_capacity = 0;
+	for (size_t i = 0; i < length; ++i) {
+		EventPredicateHandle child = event_predicate_get_ptr(handle)->aggregate_data.handles[i];
+		EventPredicateFoldState state = event_predicate_fold(child);
+		if (event_predicate_get_ptr(child) && (event_predicate_depends_on_mutable(child) || predicates.annotations[child].fold_state == FOLD_IN_PROGRESS)) {
+			predicates.annotations[handle].has_mutable_descendant = true;
+		}
+		if (state == FOLD_VARIABLE) {
+			state = fold_aggregate_child(type, child, &kept, &kept_length, &kept_capacity);
+		}
+		if (state == absorbing) {
+			free(kept);
+			return absorbing;
+		}
+	}
+	if (!kept_length) {
+		free(kept);
+		// Skipped children are neutral
+		return disjunction ? FOLD_REJECTED : FOLD_ACCEPTED;
+	}
+
+	EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+	annotation->folded_body = (EventPredicate) {
+		.type = type,
+		.enabled = true,
+		.inverted = false,
+		.aggregate_data = {
+			.length = kept_length,
+			.handles = kept,
+		},
+	};
+	annotation->has_folded_body = true;
+	return FOLD_VARIABLE;
+}
+
+static EventPredicateFoldState
+event_predicate_fold(EventPredicateHandle handle)
+{
+	EventPredicate *ptr = event_predicate_get_ptr(handle);
+	if (!ptr) {
+		return FOLD_DISABLED;
+	}
+	EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+	switch (annotation->fold_state) {
+	case FOLD_PENDING:
+		break;
+	case FOLD_IN_PROGRESS:
+		return FOLD_VARIABLE;  // Reference cycle
+	default:
+		return annotation->fold_state;
+	}
+	annotation->fold_state = FOLD_IN_PROGRESS;
+
+	EventPredicateFoldState body_state = event_predicate_fold_body(handle);
+	annotation->body_state = body_state;
+	if (body_state == FOLD_ACCEPTED || body_state == FOLD_REJECTED) {
+		if (ptr->type != EVPRED_ACCEPT) {
+			annotation->folded_body = (EventPredicate) {
+				.type = EVPRED_ACCEPT,
+				.enabled = true,
+				.inverted = body_state == FOLD_REJECTED,
+			};
+			annotation->has_folded_body = true;
+		}
+	}
+
+	EventPredicateFoldState state = body_state;
+	if (body_state != FOLD_DISABLED) {
+		if (annotation->is_mutable) {
+			state = FOLD_VARIABLE;
+		} else if (!ptr->enabled) {
+			state = FOLD_DISABLED;
+		} else if (ptr->inverted && body_state != FOLD_VARIABLE) {
+			state = body_state == FOLD_ACCEPTED ? FOLD_REJECTED : FOLD_ACCEPTED;
+		}
+	}
+	annotation->fold_state = state;
+	return state;
+}
+
+void
+event_predicate_fold_constants()
+{
+	++flags_generation;
+	parents.length = 0;
+	for (size_t i = 0; i < predicates.length; ++i) {
+		event_predicate_annotation_clear_body(&predicates.annotations[i]);
+		predicates.annotations[i].fold_state = FOLD_PENDING;
+		predicates.annotations[i].has_mutable_descendant = false;
+	}
+	for (size_t i = 0; i < predicates.length; ++i) {
+		event_predicate_fold(i);
+	}
+}
+
+bool
+event_predicate_constant_result(EventPredicateHandle handle, EventPredicateResult * result)
+{
+	if (!event_predicate_get_ptr(handle)) {
+		*result = EVPREDRES_DISABLED;
+		return true;
+	}
+	switch (predicates.annotations[handle].fold_state) {
+	case FOLD_DISABLED:
+		*result = EVPREDRES_DISABLED;
+		return true;
+	case FOLD_ACCEPTED:
+		*result = EVPREDRES_ACCEPTED;
+		return true;
+	case FOLD_REJECTED:
+		*result = EVPREDRES_REJECTED;
+		return true;
+	default:
+		return false;
+	}
+}
+
+bool
+event_predicate_current_result(EventPredicateHandle handle, EventPredicateResult * result)
+{
+	if (event_predicate_constant_result(handle, result)) {
+		return true;
+	}
+	const EventPredicate *ptr = &predicates.values[handle];
+	const EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+	if (!annotation->is_mutable) {
+		return false;
+	}
+	if (!ptr->enabled) {
+		*result = EVPREDRES_DISABLED;
+		return true;
+	}
+	switch (annotation->body_state) {
+	case FOLD_ACCEPTED:
+	case FOLD_REJECTED:
+		*result = (annotation->body_state == FOLD_ACCEPTED) != ptr->inverted ? EVPREDRES_ACCEPTED : EVPREDRES_REJECTED;
+		return true;
+	default:
+		return false;
+	}
+}
+
+typedef struct {
+	EventPredicateInstruction *code;
+	size_t length;
+	size_t capacity;
+	bool failed;
+} EventPredicateProgramBuilder;
+
+static size_t
+program_emit(EventPredicateProgramBuilder * builder, EventPredicateInstruction insn)
+{
+	if (builder->failed) {
+		return 0;
+	}
+	if (builder->length >= EVPRED_PROGRAM_MAX_LENGTH) {
+		builder->failed = true;
+		return 0;
+	}
+	if (builder->length >= builder->capacity) {
+		size_t capacity = builder->capacity + (builder->capacity >> 1) + 16;
+		EventPredicateInstruction *code = builder->code ? T_REALLOC(builder->code, capacity, EventPredicateInstruction) : T_ALLOC(capacity, EventPredicateInstruction);
+		if (!code) {
+			builder->failed = true;
+			return 0;
+		}
+		builder->code = code;
+		builder->capacity = capacity;
+	}
+	builder->code[builder->length] = insn;
+	return builder->length++;
+}
+
+// Jumps are chained through their targets until patched
+static void
+program_patch(EventPredicateProgramBuilder * builder, uint32_t chain)
+{
+	if (builder->failed) {
+		return;
+	}
+	while (chain != EVPRED_PROGRAM_NO_TARGET) {
+		uint32_t next = builder->code[chain].target;
+		builder->code[chain].target = builder->length;
+		chain = next;
+	}
+}
+
+static void
+program_emit_const(EventPredicateProgramBuilder * builder, EventPredicateResult result)
+{
+	program_emit(builder, (EventPredicateInstruction) {
+		.opcode = EVPROG_CONST,
+		.result = result,
+	});
+}
+
+static void
+event_predicate_compile(EventPredicateProgramBuilder * builder, EventPredicateHandle handle, size_t depth)
+{
+	if (builder->failed) {
+		return;
+	}
+	if (depth > EVPRED_MAX_DEPTH) {
+		builder->failed = true;
+		return;
+	}
+	EventPredicate *definition = event_predicate_get_ptr(handle);
+	if (!definition) {
+		program_emit_const(builder, EVPREDRES_DISABLED);
+		return;
+	}
+	EventPredicateResult constant;
+	if (event_predicate_constant_result(handle, &constant)) {
+		program_emit_const(builder, constant);
+		return;
+	}
+	const EventPredicateAnnotation *annotation = &predicates.annotations[handle];
+	bool is_mutable = annotation->is_mutable;
+	if (!is_mutable && !definition->enabled) {
+		program_emit_const(builder, EVPREDRES_DISABLED);
+		return;
+	}
+	if (depth > 0 && annotation->reference_count > 1) {
+		// Evaluated once per event through the result cache
+		program_emit(builder, (EventPredicateInstruction) {
+			.opcode = EVPROG_APPLY,
+			.handle = handle,
+		});
+		return;
+	}
+
+	uint32_t skip = EVPRED_PROGRAM_NO_TARGET;
+	if (is_mutable) {
+		skip = program_emit(builder, (EventPredicateInstruction) {
+			.opcode = EVPROG_SKIP_IF_DISABLED,
+			.handle = handle,
+			.target = EVPRED_PROGRAM_NO_TARGET,
+		});
+	}
+	const EventPredicate *body = annotation->has_folded_body ? &annotation->folded_body : definition;
+	bool static_inversion = (annotation->has_folded_body && body->inverted) != (!is_mutable && definition->inverted);
+
+	switch (body->type) {
+	case EVPRED_ACCEPT:
+		program_emit_const(builder, EVPREDRES_ACCEPTED);
+		break;
+	case EVPRED_CODE_NS...EVPRED_INPUT_INDEX:
+		program_emit(builder, (EventPredicateInstruction) {
+			.opcode = EVPROG_RANGE,
+			.field = body->type - EVPRED_CODE_NS,
+			.min_value = body->range_data.min_value,
+			.max_value = body->range_data.max_value,
+		});
+		break;
+	case EVPRED_MODIFIER:
+		program_emit(builder, (EventPredicateInstruction) {
+			.opcode = EVPROG_MODIFIER,
+			.min_value = body->single_modifier,
+		});
+		break;
+	case EVPRED_MODIFIER_MASK:
+		program_emit(builder, (EventPredicateInstruction) {
+			.opcode = EVPROG_MODIFIER_MASK,
+			.handle = handle,
+		});
+		break;
+	case EVPRED_CODE_SET:
+	case EVPRED_PAYLOAD_SET:
+		program_emit(builder, (EventPredicateInstruction) {
+			.opcode = EVPROG_SET,
+			.field = (body->type == EVPRED_CODE_SET ? EVPRED_CODE_MINOR : EVPRED_PAYLOAD) - EVPRED_CODE_NS,
+			.handle = handle,
+		});
+		break;
+	case EVPRED_CONJUNCTION:
+	case EVPRED_DISJUNCTION:
+		if (!body->aggregate_data.handles) {
+			program_emit_const(builder, EVPREDRES_DISABLED);
+			static_inversion = false;
+			break;
+		}
+		{
+			bool disjunction = body->type == EVPRED_DISJUNCTION;
+			uint32_t short_circuit = EVPRED_PROGRAM_NO_TARGET;
+			for (size_t i = 0; i < body->aggregate_data.length; ++i) {
+				event_predicate_compile(builder, body->aggregate_data.handles[i], depth + 1);
+				// Leaves the deciding result for the flags below
+				short_circuit = program_emit(builder, (EventPredicateInstruction) {
+					.opcode = EVPROG_JUMP_IF,
+					.result = disjunction ? EVPREDRES_ACCEPTED : EVPREDRES_REJECTED,
+					.target = short_circuit,
+				});
+			}
+			program_emit_const(builder, disjunction ? EVPREDRES_REJECTED : EVPREDRES_ACCEPTED);
+			program_patch(builder, short_circuit);
+		}
+		break;
+	default:
+		program_emit_const(builder, EVPREDRES_DISABLED);
+		static_inversion = false;
+		break;
+	}
+
+	if (static_inversion) {
+		program_emit(builder, (EventPredicateInstruction) {
+			.opcode = EVPROG_NOT,
+		});
+	}
+	if (is_mutable) {
+		program_emit(builder, (EventPredicateInstruction) {
+			.opcode = EVPROG_NOT_IF_INVERTED,
+			.handle = handle,
+		});
+	}
+	program_patch(builder, skip);
+}
+
+// Calls visit for every valid child of the folded bodies
+static void
+event_predicate_for_each_edge(void (*visit)(EventPredicateHandle parent, EventPredicateHandle child))
+{
+	for (size_t i = 0; i < predicates.length; ++i) {
+		const EventPredicateAnnotation *annotation = &predicates.annotations[i];
+		const EventPredicate *body = annotation->has_folded_body ? &annotation->folded_body : &predicates.values[i];
+		if ((body->type != EVPRED_CONJUNCTION && body->type != EVPRED_DISJUNCTION) || !body->aggregate_data.handles) {
+			continue;
+		}
+		for (size_t j = 0; j < body->aggregate_data.length; ++j) {
+			EventPredicateHandle child = body->aggregate_data.handles[j];
+			if (event_predicate_get_ptr(child)) {
+				visit(i, child);
+			}
+		}
+	}
+}
+
+static void
+count_reference(EventPredicateHandle parent, EventPredicateHandle child)
+{
+	(void) parent;
+	++predicates.annotations[child].reference_count;
+}
+
+static void
+store_parent(EventPredicateHandle parent, EventPredicateHandle child)
+{
+	parents.handles[--parents.offsets[child]] = parent;
+}
+
+static void
+event_predicate_build_parents()
+{
+	parents.length = 0;
+	free(parents.offsets);
+	free(parents.handles);
+	free(parents.stack);
+	size_t edge_count = 0;
+	for (size_t i = 0; i < predicates.length; ++i) {
+		edge_count += predicates.annotations[i].reference_count;
+	}
+	parents.offsets = T_ALLOC(predicates.length + 1, size_t);
+	parents.handles = T_ALLOC(edge_count + 1, EventPredicateHandle);
+	parents.stack = T_ALLOC(predicates.length + 1, EventPredicateHandle);
+	if (!parents.offsets || !parents.handles || !parents.stack) {
+		return;
+	}
+	// Each range is filled backwards from its end, so the offsets end up at the range starts
+	size_t end = 0;
+	for (size_t i = 0; i < predicates.length; ++i) {
+		end += predicates.annotations[i].reference_count;
+		parents.offsets[i] = end;
+	}
+	parents.offsets[predicates.length] = end;
+	event_predicate_for_each_edge(&store_parent);
+	parents.length = predicates.length;
+}
+
+void
+event_predicate_compile_all()
+{
+	for (size_t i = 0; i < predicates.length; ++i) {
+		predicates.annotations[i].reference_count = 0;
+	}
+	event_predicate_for_each_edge(&count_reference);
+	event_predicate_build_parents();
+	for (size_t i = 0; i < predicates.length; ++i) {
+		EventPredicateAnnotation *annotation = &predicates.annotations[i];
+		free(annotation->program);
+		annotation->program = NULL;
+		annotation->program_length = 0;
+		annotation->native = NULL;
+
+		EventPredicateProgramBuilder builder = {
+			.code = NULL,
+			.length = 0,
+			.capacity = 0,
+			.failed = false,
+		};
+		event_predicate_compile(&builder, i, 0);
+		if (builder.failed) {
+			free(builder.code);
+			continue;
+		}
+		annotation->program = builder.code;
+		annotation->program_length = builder.length;
+	}
+}
+
+static void
+emit_native_int64(FILE * out, int64_t value)
+{
+	if (value == INT64_MIN) {
+		fprintf(out, "INT64_MIN");
+	} else {
+		fprintf(out, "INT64_C(%" PRId64 ")", value);
+	}
+}
+
+// The modifier byte i of the event, missing bytes are zero
+static void
+emit_native_modifier_byte(FILE * out, size_t i)
+{
+	fprintf(out, "(e->modifier_length > %zu ? e->modifier_bits[%zu] : 0)", i, i);
+}
+
+static void
+emit_native_instruction(FILE * out, const EventPredicateInstruction * insn)
+{
+	switch ((EventPredicateOpcode) insn->opcode) {
+	case EVPROG_CONST:
+		fprintf(out, "\tr = %d;\n", insn->result);
+		break;
+	case EVPROG_RANGE:
+		fprintf(out, "\tr = e->fields[%u] >= ", insn->field);
+		emit_native_int64(out, insn->min_value);
+		fprintf(out, " && e->fields[%u] <= ", insn->field);
+		emit_native_int64(out, insn->max_value);
+		fprintf(out, ";\n");
+		break;
+	case EVPROG_MODIFIER:
+		{
+			size_t byte_index;
+			uint8_t mask;
+			modifier_index_and_mask(insn->min_value, &byte_index, &mask);
+			fprintf(out, "\tr = (");
+			emit_native_modifier_byte(out, byte_index);
+			fprintf(out, " & %u) != 0;\n", mask);
+		}
+		break;
+	case EVPROG_MODIFIER_MASK:
+		{
+			const EventPredicate *mask = &predicates.values[insn->handle];
+			const ModifierSet required = mask->modifier_mask_data.required, forbidden = mask->modifier_mask_data.forbidden, any = mask->modifier_mask_data.any;
+			fprintf(out, "\tr = 1");
+			for (size_t i = 0; i < required.byte_length; ++i) {
+				if (required.bits[i]) {
+					fprintf(out, " && (");
+					emit_native_modifier_byte(out, i);
+					fprintf(out, " & %u) == %u", required.bits[i], required.bits[i]);
+				}
+			}
+			for (size_t i = 0; i < forbidden.byte_length; ++i) {
+				if (forbidden.bits[i]) {
+					fprintf(out, " && !(");
+					emit_native_modifier_byte(out, i);
+					fprintf(out, " & %u)", forbidden.bits[i]);
+				}
+			}
+			const char *separator = " && (0";
+			for (size_t i = 0; i < any.byte_length; ++i) {
+				if (any.bits[i]) {
+					fprintf(out, "%s || (", separator);
+					emit_native_modifier_byte(out, i);
+					fprintf(out, " & %u)", any.bits[i]);
+					separator = "";
+				}
+			}
+			fprintf(out, "%s;\n", *separator ? "" : ")");
+		}
+		break;
+	case EVPROG_SET:
+		{
+			// The compiler picks a jump table or a binary search
+			const EventPredicate *set = &predicates.values[insn->handle];
+			fprintf(out, "\tswitch (e->fields[%u]) {\n", insn->field);
+			for (size_t i = 0; i < set->set_data.length; ++i) {
+				fprintf(out, "\tcase ");
+				emit_native_int64(out, set->set_data.values[i]);
+				fprintf(out, ":\n");
+			}
+			fprintf(out, "\t\tr = 1;\n\t\tbreak;\n\tdefault:\n\t\tr = 0;\n\t}\n");
+		}
+		break;
+	case EVPROG_NOT:
+		fprintf(out, "\tif (r >= 0) r = !r;\n");
+		break;
+	case EVPROG_NOT_IF_INVERTED:
+		fprintf(out, "\tif (r >= 0 && host->inverted(%" PRId32 ")) r = !r;\n", insn->handle);
+		break;
+	case EVPROG_SKIP_IF_DISABLED:
+		fprintf(out, "\tif (!host->enabled(%" PRId32 ")) { r = -1; goto l%" PRIu32 "; }\n", insn->handle, insn->target);
+		break;
+	case EVPROG_JUMP_IF:
+		fprintf(out, "\tif (r == %d) goto l%" PRIu32 ";\n", insn->result, insn->target);
+		break;
+	case EVPROG_APPLY:
+		fprintf(out, "\tr = host->apply(%" PRId32 ", e->event);\n", insn->handle);
+		break;
+	}
+}
+
+bool
+event_predicate_emit_native(FILE * out)
+{
+	fprintf(out,
+		"#include <stddef.h>\n"
+		"#include <stdint.h>\n"
+		"typedef struct { int64_t fields[5]; const uint8_t *modifier_bits; size_t modifier_length; void *event; } Event;\n"
+		"typedef struct { int (*apply)(int32_t, void *); _Bool (*enabled)(int32_t); _Bool (*inverted)(int32_t); } Host;\n"
+		"static const Host *host;\n"
+		"void evpred_native_init(const Host *h) { host = h; }\n"
+	);
+	for (size_t i = 0; i < predicates.length; ++i) {
+		const EventPredicateAnnotation *annotation = &predicates.annotations[i];
+		if (!annotation->program) {
+			continue;
+		}
+		fprintf(out, "static int p%zu(const Event *e) {\n\tint r = -1;\n", i);
+		for (size_t pc = 0; pc < annotation->program_length; ++pc) {
+			// Every instruction is labeled, jumps past the end go to the last label
+			fprintf(out, "l%zu:\n", pc);
+			const EventPredicateInstruction *insn = &annotation->program[pc];
+			EventPredicateInstruction copy = *insn;
+			if ((insn->opcode == EVPROG_SKIP_IF_DISABLED || insn->opcode == EVPROG_JUMP_IF) && copy.target > annotation->program_length) {
+				copy.target = annotation->program_length;
+			}
+			emit_native_instruction(out, &copy);
+		}
+		fprintf(out, "l%zu:\n\treturn r;\n}\n", annotation->program_length);
+	}
+	fprintf(out, "const size_t evpred_native_count = %zu;\nint (*const evpred_native_functions[])(const Event *) = {\n", predicates.length);
+	for (size_t i = 0; i < predicates.length; ++i) {
+		if (predicates.annotations[i].program) {
+			fprintf(out, "\tp%zu,\n", i);
+		} else {
+			fprintf(out, "\t0,\n");
+		}
+	}
+	fprintf(out, "\t0,\n};\n");
+	return !ferror(out);
+}
+
+void
+event_predicate_set_native(EventPredicateHandle handle, EventPredicateNativeFunction function)
+{
+	if (!event_predicate_get_ptr(handle) || !predicates.annotations[handle].program) {
+		return;
+	}
+	predicates.annotations[handle].native = function;
+}
+
+void
+event_predicate_set_profiling(bool enabled)
+{
+	if (enabled && !profiling) {
+		for (size_t i = 0; i < predicates.length; ++i) {
+			predicates.annotations[i].profile = (EventPredicateProfile) {
+				.evaluations = 0,
+			};
+		}
+	}
+	profiling = enabled;
+}
+
+bool
+event_predicate_get_profile(EventPredicateHandle handle, EventPredicateProfile * profile)
+{
+	if (!event_predicate_get_ptr(handle)) {
+		return false;
+	}
+	*profile = predicates.annotations[handle].profile;
+	return true;
+}
+
+EventPredicateHandle
+event_predicate_count()
+{
+	return (EventPredicateHandle) predicates.length;
+}
+
+void
+event_predicate_truncate(EventPredicateHandle count)
+{
+	if (count < 0) {
+		count = 0;
+	}
+	while (predicates.length > (size_t) count) {
+		event_predicate_list_release(&predicates, --predicates.length);
+	}
+	parents.length = 0;
+}
+
+bool
+event_predicate_compact(bool * used, EventPredicateHandle * renumbered)
+{
+	size_t count = predicates.length;
+	EventPredicateHandle *stack = T_ALLOC(count ? count : 1, EventPredicateHandle);
+	if (!stack) {
+		return false;
+	}
+	// Marks the descendants of the used predicates, a predicate is pushed only when it gets marked, so the stack cannot overflow
+	size_t depth = 0;
+	for (size_t i = 0; i < count; ++i) {
+		if (used[i]) {
+			stack[depth++] = i;
+		}
+	}
+	while (depth > 0) {
+		const EventPredicate *ptr = &predicates.values[stack[--depth]];
+		if ((ptr->type != EVPRED_CONJUNCTION && ptr->type != EVPRED_DISJUNCTION) || !ptr->aggregate_data.handles) {
+			continue;
+		}
+		for (size_t j = 0; j < ptr->aggregate_data.length; ++j) {
+			EventPredicateHandle child = ptr->aggregate_data.handles[j];
+			if (child >= 0 && (size_t) child < count && !used[child]) {
+				used[child] = true;
+				stack[depth++] = child;
+			}
+		}
+	}
+	free(stack);
+
+	size_t length = 0;
+	for (size_t i = 0; i < count; ++i) {
+		if (!used[i]) {
+			event_predicate_list_release(&predicates, i);
+			renumbered[i] = -1;
+			continue;
+		}
+		renumbered[i] = length;
+		predicates.values[length] = predicates.values[i];
+		predicates.annotations[length] = predicates.annotations[i];
+		++length;
+	}
+	predicates.length = length;
+	// The folded bodies and programs refer to the old handles, they are rebuilt by the next folding and compilation
+	for (size_t i = 0; i < length; ++i) {
+		EventPredicate *ptr = &predicates.values[i];
+		if ((ptr->type == EVPRED_CONJUNCTION || ptr->type == EVPRED_DISJUNCTION) && ptr->aggregate_data.handles) {
+			for (size_t j = 0; j < ptr->aggregate_data.length; ++j) {
+				EventPredicateHandle child = ptr->aggregate_data.handles[j];
+				ptr->aggregate_data.handles[j] = child >= 0 && (size_t) child < count ? renumbered[child] : -1;
+			}
+		}
+		EventPredicateAnnotation *annotation = &predicates.annotations[i];
+		event_predicate_annotation_clear_body(annotation);
+		annotation->fold_state = FOLD_PENDING;
+		free(annotation->program);
+		annotation->program = NULL;
+		annotation->program_length = 0;
+		annotation->native = NULL;
+		annotation->reference_count = 0;
+	}
+	++flags_generation;
+	parents.length = 0;
+	return true;
 }
 
 void
 event_predicate_reset()
 {
 	event_predicate_list_clear(&predicates);
+	free(cache_key.modifier_bits);
+	cache_key = (EventPredicateCacheKey) {
+		.id = 0,
+		.modifiers_length = 0,
+		.modifiers_capacity = 0,
+		.modifier_bits = NULL,
+	};
+	++flags_generation;
+	free(parents.offsets);
+	free(parents.handles);
+	free(parents.stack);
+	parents.length = 0;
+	parents.offsets = NULL;
+	parents.handles = NULL;
+	parents.stack = NULL;
 }
@@ -20,6 +20,10 @@ typedef enum {
 	EVPRED_DISJUNCTION,
 	// Modifier
 	EVPRED_MODIFIER,
+	EVPRED_MODIFIER_MASK,
+	// Set membership
+	EVPRED_CODE_SET,
+	EVPRED_PAYLOAD_SET,
 } EventPredicateType;
 
 typedef enum {
@@ -42,14 +46,75 @@ struct event_predicate {
 			EventPredicateHandle *handles;
 		} aggregate_data;
 		Modifier single_modifier;
+		struct {
+			ModifierSet required;
+			ModifierSet forbidden;
+			ModifierSet any;  // At least one is required unless empty
+		} modifier_mask_data;
+		struct {
+			size_t length;
+			int64_t *values;  // Sorted without duplicates by event_predicate_register
+		} set_data;
 	};
 };
 
+// Counted by event_predicate_apply and event_predicate_apply_batch, children inlined into a compiled program are not counted
+typedef struct {
+	uint64_t evaluations;
+	uint64_t accepted;
+	uint64_t rejected;
+	uint64_t disabled;
+	uint64_t samples;  // Evaluations covered by sampled_cycles
+	uint64_t sampled_cycles;  // Timestamp counter cycles (nanoseconds where not available) including the children
+} EventPredicateProfile;
+
+typedef struct event_predicate_dependent EventPredicateDependent;
+
+// Embedded into the structures precomputed from a predicate result, like router tables
+struct event_predicate_dependent {
+	// handle is the predicate the dependent was added to, called after the flags of it or of any predicate it uses have changed
+	void (*flags_changed)(EventPredicateDependent * self, EventPredicateHandle handle);
+};
+
+// Deepest nesting of aggregates, so that evaluating, folding and compiling a predicate recurses a bounded number of times
+#define EVPRED_MAX_DEPTH 256
+
+// Returns -1 on failure, errno is ELOOP if the aggregates would be nested deeper than EVPRED_MAX_DEPTH. The arguments of an aggregate must be registered before it
 EventPredicateHandle event_predicate_register(EventPredicate predicate);
 EventPredicate event_predicate_get(EventPredicateHandle handle);
+// Same as event_predicate_get, but with the body simplified by event_predicate_fold_constants, the aggregate handles must not be freed
+EventPredicate event_predicate_get_folded(EventPredicateHandle handle);
 EventPredicateResult event_predicate_apply(EventPredicateHandle handle, EventNode * event);
+// Sets bit i % 64 of accepted[i / 64] iff events[i] is accepted, the other bits of the last word are cleared. Evaluates a compiled predicate for many events at once
+void event_predicate_apply_batch(EventPredicateHandle handle, EventNode ** events, size_t count, uint64_t * accepted);
 void event_predicate_set_enabled(EventPredicateHandle handle, bool enabled);
 void event_predicate_set_inverted(EventPredicateHandle handle, bool inverted);
+// Flag changes invalidate only the predicates that depend on the changed one once compiled, and notify their dependents
+bool event_predicate_add_dependent(EventPredicateHandle handle, EventPredicateDependent * dependent);
+void event_predicate_remove_dependent(EventPredicateHandle handle, EventPredicateDependent * dependent);
+// Structural comparison, children are compared recursively, flags are ignored unless compare_flags is set
+bool event_predicate_equivalent(EventPredicateHandle lhs, EventPredicateHandle rhs, bool compare_flags);
+// Replaces references to old_handle by new_handle in the aggregates registered starting from handle since, new_handle must be equivalent to old_handle and registered before since
+void event_predicate_replace_references(EventPredicateHandle old_handle, EventPredicateHandle new_handle, EventPredicateHandle since);
+// Predicates whose flags can change after loading, must be marked before event_predicate_fold_constants
+void event_predicate_mark_mutable(EventPredicateHandle handle);
+bool event_predicate_is_mutable(EventPredicateHandle handle);
+// Simplifies the predicates for evaluation, the definitions seen by event_predicate_get are kept
+void event_predicate_fold_constants();
+// Returns true if the predicate result does not depend on the event, valid until the next registration
+bool event_predicate_constant_result(EventPredicateHandle handle, EventPredicateResult * result);
+// Same as event_predicate_constant_result, but also true for the mutable predicates whose result is decided by their current flags
+bool event_predicate_current_result(EventPredicateHandle handle, EventPredicateResult * result);
+// Translates the (folded) predicates into flat programs, a predicate keeps the tree evaluation only if its program could not be allocated
+void event_predicate_compile_all();
+// Profiling is off by default, enabling it resets the counters
+void event_predicate_set_profiling(bool enabled);
+bool event_predicate_get_profile(EventPredicateHandle handle, EventPredicateProfile * profile);
+EventPredicateHandle event_predicate_count();
+// Releases the predicates registered after the first count ones, which must not be referenced any more, like the ones of a configuration that failed to load
+void event_predicate_truncate(EventPredicateHandle count);
+// Releases the predicates that are neither marked in used (event_predicate_count() entries) nor referenced by a marked one, the rest are renumbered in order. Stores the new handles (-1 if released) in renumbered, the holders of handles have to apply it before the next evaluation. The predicates have to be folded and compiled again afterward
+bool event_predicate_compact(bool * used, EventPredicateHandle * renumbered);
 void event_predicate_reset();
 
 #endif /* end of include guard: PREDS_H_ */
@@ -0,0 +1,472 @@
+#include <stdlib.h>
+#include "event_predicate_index.h"
+
+// Same order as the range predicate types
+static const int64_t dimension_min[EVPRED_INDEX_DIMENSIONS] = {
+	0,
+	0,
+	0,
+	INT64_MIN,
+};
+
+static const int64_t dimension_max[EVPRED_INDEX_DIMENSIONS] = {
+	UINT32_MAX,
+	UINT16_MAX,
+	UINT16_MAX,
+	INT64_MAX,
+};
+
+typedef struct {
+	int64_t min_value[EVPRED_INDEX_DIMENSIONS];
+	int64_t max_value[EVPRED_INDEX_DIMENSIONS];
+	uint8_t restricted_dimensions;
+	bool never;
+	size_t first[EVPRED_INDEX_DIMENSIONS], last[EVPRED_INDEX_DIMENSIONS];  // Covered intervals
+} EventRangeBox;
+
+static bool
+is_indexable_range(EventPredicateHandle handle, const EventPredicate * predicate)
+{
+	if (event_predicate_is_mutable(handle) || !predicate->enabled || predicate->inverted) {
+		return false;
+	}
+	switch (predicate->type) {
+	case EVPRED_CODE_NS...EVPRED_PAYLOAD:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static bool
+is_indexable_set(EventPredicateHandle handle, const EventPredicate * predicate)
+{
+	if (event_predicate_is_mutable(handle) || !predicate->enabled || predicate->inverted) {
+		return false;
+	}
+	return (predicate->type == EVPRED_CODE_SET || predicate->type == EVPRED_PAYLOAD_SET) && predicate->set_data.length;
+}
+
+static void
+box_restrict(EventRangeBox * box, const EventPredicate * range)
+{
+	size_t d = range->type - EVPRED_CODE_NS;
+	if (range->range_data.min_value > box->min_value[d]) {
+		box->min_value[d] = range->range_data.min_value;
+	}
+	if (range->range_data.max_value < box->max_value[d]) {
+		box->max_value[d] = range->range_data.max_value;
+	}
+	box->restricted_dimensions |= 1 << d;
+}
+
+// Restricts the box to the smallest and the largest value, the membership is left to the residual
+static void
+box_restrict_set(EventRangeBox * box, const EventPredicate * set)
+{
+	EventPredicate bounds = {
+		.type = set->type == EVPRED_CODE_SET ? EVPRED_CODE_MINOR : EVPRED_PAYLOAD,
+		.range_data = {
+			.min_value = set->set_data.values[0],
+			.max_value = set->set_data.values[set->set_data.length - 1],
+		},
+	};
+	box_restrict(box, &bounds);
+}
+
+static bool
+residual_append(EventPredicateIndexResidual * residual, EventPredicateHandle handle, size_t capacity)
+{
+	if (!residual->handles && !(residual->handles = T_ALLOC(capacity, EventPredicateHandle))) {
+		return false;
+	}
+	residual->handles[residual->length++] = handle;
+	return true;
+}
+
+// Splits the predicate into ranges and the residual conjunction
+static bool
+split_predicate(EventPredicateHandle handle, EventRangeBox * box, EventPredicateIndexResidual * residual)
+{
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		box->min_value[d] = dimension_min[d];
+		box->max_value[d] = dimension_max[d];
+	}
+	box->never = false;
+	box->restricted_dimensions = 0;
+	*residual = (EventPredicateIndexResidual) {
+		.whole = false,
+		.length = 0,
+		.handles = NULL,
+		.checked_dimensions = 0,
+	};
+
+	EventPredicateResult constant;
+	if (event_predicate_constant_result(handle, &constant)) {
+		box->never = constant != EVPREDRES_ACCEPTED;
+		return true;
+	}
+	EventPredicate predicate = event_predicate_get_folded(handle);
+	if (is_indexable_range(handle, &predicate)) {
+		box_restrict(box, &predicate);
+	} else if (is_indexable_set(handle, &predicate)) {
+		box_restrict_set(box, &predicate);
+		if (!residual_append(residual, handle, 1)) {
+			return false;
+		}
+	} else if (predicate.type == EVPRED_CONJUNCTION && predicate.aggregate_data.handles && !predicate.inverted && predicate.enabled && !event_predicate_is_mutable(handle)) {
+		for (size_t i = 0; i < predicate.aggregate_data.length; ++i) {
+			EventPredicateHandle child = predicate.aggregate_data.handles[i];
+			EventPredicate child_predicate = event_predicate_get_folded(child);
+			if (is_indexable_range(child, &child_predicate)) {
+				box_restrict(box, &child_predicate);
+				continue;
+			}
+			if (is_indexable_set(child, &child_predicate)) {
+				box_restrict_set(box, &child_predicate);
+			}
+			if (!residual_append(residual, child, predicate.aggregate_data.length)) {
+				return false;
+			}
+		}
+	} else {
+		residual->whole = true;
+		if (!residual_append(residual, handle, 1)) {
+			return false;
+		}
+	}
+
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		if (box->min_value[d] > box->max_value[d]) {
+			box->never = true;
+		}
+	}
+	return true;
+}
+
+static int
+compare_boundaries(const void * lhs, const void * rhs)
+{
+	int64_t a = *(const int64_t*) lhs, b = *(const int64_t*) rhs;
+	return (a > b) - (a < b);
+}
+
+// Number of boundaries not greater than value
+static size_t
+find_interval(const int64_t * boundaries, size_t count, int64_t value)
+{
+	size_t lo = 0, hi = count;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (boundaries[mid] <= value) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo;
+}
+
+static bool
+collect_boundaries(EventPredicateIndex * index, const EventRangeBox * boxes, size_t d)
+{
+	int64_t *boundaries = T_ALLOC(2 * index->length, int64_t);
+	if (!boundaries) {
+		return false;
+	}
+	size_t count = 0;
+	for (size_t i = 0; i < index->length; ++i) {
+		if (boxes[i].never) {
+			continue;
+		}
+		if (boxes[i].min_value[d] > dimension_min[d]) {
+			boundaries[count++] = boxes[i].min_value[d];
+		}
+		if (boxes[i].max_value[d] < dimension_max[d]) {
+			boundaries[count++] = boxes[i].max_value[d] + 1;
+		}
+	}
+	qsort(boundaries, count, sizeof(int64_t), &compare_boundaries);
+	size_t unique = 0;
+	for (size_t i = 0; i < count; ++i) {
+		if (!unique || boundaries[unique - 1] != boundaries[i]) {
+			boundaries[unique++] = boundaries[i];
+		}
+	}
+	index->boundaries[d] = boundaries;
+	index->boundary_count[d] = unique;
+	return true;
+}
+
+// Estimates the table size if only the given dimensions are indexed
+static void
+index_size(const EventPredicateIndex * index, const EventRangeBox * boxes, uint8_t dimensions, double * cells, double * entries)
+{
+	*cells = 1;
+	*entries = 0;
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		if (dimensions & (1 << d)) {
+			*cells *= index->boundary_count[d] + 1;
+		}
+	}
+	for (size_t i = 0; i < index->length; ++i) {
+		if (boxes[i].never) {
+			continue;
+		}
+		double covered = 1;
+		for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+			if (dimensions & (1 << d)) {
+				covered *= boxes[i].last[d] - boxes[i].first[d] + 1;
+			}
+		}
+		*entries += covered;
+	}
+}
+
+// Leaves out the dimensions that would make the table too large, the most expensive first
+static uint8_t
+choose_dimensions(const EventPredicateIndex * index, const EventRangeBox * boxes)
+{
+	uint8_t dimensions = 0;
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		if (index->boundary_count[d]) {
+			dimensions |= 1 << d;
+		}
+	}
+	while (dimensions) {
+		double cells, entries;
+		index_size(index, boxes, dimensions, &cells, &entries);
+		if (cells <= EVPRED_INDEX_MAX_CELLS && entries <= EVPRED_INDEX_MAX_ENTRIES) {
+			break;
+		}
+		uint8_t best = 0;
+		double best_cost = -1;
+		for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+			if (!(dimensions & (1 << d))) {
+				continue;
+			}
+			uint8_t candidate = dimensions & ~(1 << d);
+			index_size(index, boxes, candidate, &cells, &entries);
+			double cost = cells > entries ? cells : entries;
+			if (best_cost < 0 || cost < best_cost) {
+				best = candidate;
+				best_cost = cost;
+			}
+		}
+		dimensions = best;
+	}
+	return dimensions;
+}
+
+static size_t
+cell_index(const EventPredicateIndex * index, const size_t * intervals)
+{
+	size_t cell = 0;
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		cell = cell * (index->boundary_count[d] + 1) + intervals[d];
+	}
+	return cell;
+}
+
+// Counts (or stores if fill is set) the entry in every cell covered by the box
+static void
+fill_cells(EventPredicateIndex * index, const EventRangeBox * box, uint32_t entry, size_t * cursors, bool fill)
+{
+	size_t intervals[EVPRED_INDEX_DIMENSIONS];
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		intervals[d] = box->first[d];
+	}
+	while (true) {
+		size_t cell = cell_index(index, intervals);
+		if (fill) {
+			index->entries[cursors[cell]++] = entry;
+		} else {
+			++cursors[cell];
+		}
+		size_t d = EVPRED_INDEX_DIMENSIONS;
+		while (d > 0 && intervals[d - 1] == box->last[d - 1]) {
+			--d;
+			intervals[d] = box->first[d];
+		}
+		if (d == 0) {
+			break;
+		}
+		++intervals[d - 1];
+	}
+}
+
+bool
+event_predicate_index_build(EventPredicateIndex * index, const EventPredicateHandle * handles, size_t length)
+{
+	*index = (EventPredicateIndex) {
+		.length = length,
+		.indexed_dimensions = 0,
+		.cell_offsets = NULL,
+		.entries = NULL,
+		.residuals = NULL,
+	};
+	if (!length || length > UINT32_MAX) {
+		return false;
+	}
+	size_t *cursors = NULL;
+	EventRangeBox *boxes = T_ALLOC(length, EventRangeBox);
+	index->residuals = T_ALLOC(length, EventPredicateIndexResidual);
+	if (!boxes || !index->residuals) {
+		goto fail;
+	}
+
+	uint8_t restricted = 0;
+	for (size_t i = 0; i < length; ++i) {
+		if (!split_predicate(handles[i], &boxes[i], &index->residuals[i])) {
+			goto fail;
+		}
+		restricted |= boxes[i].restricted_dimensions;
+	}
+	if (!restricted) {
+		goto fail;
+	}
+
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		if (!collect_boundaries(index, boxes, d)) {
+			goto fail;
+		}
+		for (size_t i = 0; i < length; ++i) {
+			boxes[i].first[d] = find_interval(index->boundaries[d], index->boundary_count[d], boxes[i].min_value[d]);
+			boxes[i].last[d] = find_interval(index->boundaries[d], index->boundary_count[d], boxes[i].max_value[d]);
+		}
+	}
+	uint8_t dimensions = choose_dimensions(index, boxes);
+	if (!dimensions) {
+		goto fail;
+	}
+	index->indexed_dimensions = dimensions;
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		if (dimensions & (1 << d)) {
+			continue;
+		}
+		free(index->boundaries[d]);
+		index->boundaries[d] = NULL;
+		index->boundary_count[d] = 0;
+		for (size_t i = 0; i < length; ++i) {
+			boxes[i].first[d] = boxes[i].last[d] = 0;
+			if (boxes[i].restricted_dimensions & (1 << d)) {
+				index->residuals[i].checked_dimensions |= 1 << d;
+				index->residuals[i].min_value[d] = boxes[i].min_value[d];
+				index->residuals[i].max_value[d] = boxes[i].max_value[d];
+			}
+		}
+	}
+
+	size_t cell_count = 1;
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		cell_count *= index->boundary_count[d] + 1;
+	}
+	index->cell_offsets = T_ALLOC(cell_count + 1, size_t);
+	cursors = T_ALLOC(cell_count, size_t);
+	if (!index->cell_offsets || !cursors) {
+		goto fail;
+	}
+	for (size_t i = 0; i < length; ++i) {
+		if (!boxes[i].never) {
+			fill_cells(index, &boxes[i], i, cursors, false);
+		}
+	}
+	size_t total = 0;
+	for (size_t cell = 0; cell < cell_count; ++cell) {
+		index->cell_offsets[cell] = total;
+		total += cursors[cell];
+		cursors[cell] = index->cell_offsets[cell];
+	}
+	index->cell_offsets[cell_count] = total;
+	index->entries = T_ALLOC(total ? total : 1, uint32_t);
+	if (!index->entries) {
+		goto fail;
+	}
+	for (size_t i = length; i-- > 0;) {
+		if (!boxes[i].never) {
+			fill_cells(index, &boxes[i], i, cursors, true);
+		}
+	}
+
+	free(cursors);
+	free(boxes);
+	return true;
+
+fail:
+	free(cursors);
+	free(boxes);
+	event_predicate_index_destroy(index);
+	return false;
+}
+
+void
+event_predicate_index_destroy(EventPredicateIndex * index)
+{
+	if (index->residuals) {
+		for (size_t i = 0; i < index->length; ++i) {
+			free(index->residuals[i].handles);
+		}
+		free(index->residuals);
+		index->residuals = NULL;
+	}
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		free(index->boundaries[d]);
+		index->boundaries[d] = NULL;
+		index->boundary_count[d] = 0;
+	}
+	free(index->cell_offsets);
+	index->cell_offsets = NULL;
+	free(index->entries);
+	index->entries = NULL;
+	index->length = 0;
+	index->indexed_dimensions = 0;
+}
+
+const uint32_t *
+event_predicate_index_candidates(const EventPredicateIndex * index, const EventNode * event, size_t * count)
+{
+	const int64_t fields[EVPRED_INDEX_DIMENSIONS] = {
+		event->data.code.ns,
+		event->data.code.major,
+		event->data.code.minor,
+		event->data.payload,
+	};
+	size_t intervals[EVPRED_INDEX_DIMENSIONS];
+	for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+		intervals[d] = find_interval(index->boundaries[d], index->boundary_count[d], fields[d]);
+	}
+	size_t cell = cell_index(index, intervals);
+	*count = index->cell_offsets[cell + 1] - index->cell_offsets[cell];
+	return &index->entries[index->cell_offsets[cell]];
+}
+
+bool
+event_predicate_index_accepts(const EventPredicateIndex * index, size_t i, EventNode * event)
+{
+	const EventPredicateIndexResidual *residual = &index->residuals[i];
+	if (residual->whole) {
+		return event_predicate_apply(residual->handles[0], event) == EVPREDRES_ACCEPTED;
+	}
+	if (residual->checked_dimensions) {
+		const int64_t fields[EVPRED_INDEX_DIMENSIONS] = {
+			event->data.code.ns,
+			event->data.code.major,
+			event->data.code.minor,
+			event->data.payload,
+		};
+		for (size_t d = 0; d < EVPRED_INDEX_DIMENSIONS; ++d) {
+			if (!(residual->checked_dimensions & (1 << d))) {
+				continue;
+			}
+			if (fields[d] < residual->min_value[d] || residual->max_value[d] < fields[d]) {
+				return false;
+			}
+		}
+	}
+	for (size_t j = 0; j < residual->length; ++j) {
+		if (event_predicate_apply(residual->handles[j], event) == EVPREDRES_REJECTED) {
+			return false;
+		}
+	}
+	return true;
+}
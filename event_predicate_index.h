@@ -0,0 +1,39 @@
+#ifndef EVENT_PREDICATE_INDEX_H_
+#define EVENT_PREDICATE_INDEX_H_
+
+#include "event_predicate.h"
+
+// Event code namespace, major, minor and payload
+#define EVPRED_INDEX_DIMENSIONS 4
+#define EVPRED_INDEX_MAX_CELLS (1 << 18)
+#define EVPRED_INDEX_MAX_ENTRIES (1 << 18)
+
+typedef struct {
+	bool whole;  // The predicate could not be split, the only handle is the predicate itself, it must accept the event
+	size_t length;
+	EventPredicateHandle *handles;  // Conjunction arguments besides the ranges, none of them may reject the event
+	uint8_t checked_dimensions;  // Ranges along the dimensions left out of the index, checked for each candidate
+	int64_t min_value[EVPRED_INDEX_DIMENSIONS];
+	int64_t max_value[EVPRED_INDEX_DIMENSIONS];
+} EventPredicateIndexResidual;
+
+// Maps each combination of event code and payload to the predicates whose ranges contain it
+typedef struct {
+	size_t length;
+	uint8_t indexed_dimensions;
+	size_t boundary_count[EVPRED_INDEX_DIMENSIONS];
+	int64_t *boundaries[EVPRED_INDEX_DIMENSIONS];  // Sorted starts of the intervals along each dimension, except the first one
+	size_t *cell_offsets;  // Entries of each cell, cell_offsets[cell] to cell_offsets[cell + 1]
+	uint32_t *entries;  // Predicate indices in descending order within a cell
+	EventPredicateIndexResidual *residuals;
+} EventPredicateIndex;
+
+// Returns false if no predicate has indexable ranges or the index would be too large, the predicates must be folded
+bool event_predicate_index_build(EventPredicateIndex * index, const EventPredicateHandle * handles, size_t length);
+void event_predicate_index_destroy(EventPredicateIndex * index);
+// Indices of the predicates that may accept the event, in descending order
+const uint32_t * event_predicate_index_candidates(const EventPredicateIndex * index, const EventNode * event, size_t * count);
+// Checks the rest of the candidate predicate i
+bool event_predicate_index_accepts(const EventPredicateIndex * index, size_t i, EventNode * event);
+
+#endif /* end of include guard: EVENT_PREDICATE_INDEX_H_ */
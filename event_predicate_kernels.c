@@ -0,0 +1,85 @@
+#include "event_predicate_kernels.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define HAVE_X86_KERNELS
+#endif
+
+static uint64_t
+range_mask_scalar(const int64_t * column, int64_t min_value, int64_t max_value)
+{
+	uint64_t mask = 0;
+	for (size_t i = 0; i < EVPRED_BATCH_LANES; ++i) {
+		mask |= (uint64_t) (min_value <= column[i] && column[i] <= max_value) << i;
+	}
+	return mask;
+}
+
+#ifdef HAVE_X86_KERNELS
+// SSE2 has no 64-bit comparison, the high halves are compared signed and the low ones unsigned
+__attribute__((target("sse2"))) static inline __m128i
+sse2_cmpgt_epi64(__m128i lhs, __m128i rhs)
+{
+	const __m128i low_sign = _mm_set_epi32(0, INT32_MIN, 0, INT32_MIN);
+	__m128i greater = _mm_cmpgt_epi32(_mm_xor_si128(lhs, low_sign), _mm_xor_si128(rhs, low_sign));
+	__m128i equal = _mm_cmpeq_epi32(lhs, rhs);
+	// Only the high half of each lane is meaningful
+	return _mm_or_si128(greater, _mm_and_si128(equal, _mm_slli_epi64(greater, 32)));
+}
+
+__attribute__((target("sse2"))) static uint64_t
+range_mask_sse2(const int64_t * column, int64_t min_value, int64_t max_value)
+{
+	const __m128i min_vector = _mm_set1_epi64x(min_value);
+	const __m128i max_vector = _mm_set1_epi64x(max_value);
+	uint64_t mask = 0;
+	for (size_t i = 0; i < EVPRED_BATCH_LANES; i += 2) {
+		__m128i values = _mm_load_si128((const __m128i*) (column + i));
+		__m128i outside = _mm_or_si128(sse2_cmpgt_epi64(min_vector, values), sse2_cmpgt_epi64(values, max_vector));
+		mask |= (uint64_t) (~_mm_movemask_pd(_mm_castsi128_pd(outside)) & 3) << i;
+	}
+	return mask;
+}
+
+__attribute__((target("avx2"))) static uint64_t
+range_mask_avx2(const int64_t * column, int64_t min_value, int64_t max_value)
+{
+	const __m256i min_vector = _mm256_set1_epi64x(min_value);
+	const __m256i max_vector = _mm256_set1_epi64x(max_value);
+	uint64_t mask = 0;
+	for (size_t i = 0; i < EVPRED_BATCH_LANES; i += 4) {
+		__m256i values = _mm256_load_si256((const __m256i*) (column + i));
+		__m256i outside = _mm256_or_si256(_mm256_cmpgt_epi64(min_vector, values), _mm256_cmpgt_epi64(values, max_vector));
+		mask |= (uint64_t) (~_mm256_movemask_pd(_mm256_castsi256_pd(outside)) & 15) << i;
+	}
+	return mask;
+}
+#endif
+
+EventPredicateRangeMask event_predicate_range_mask = &range_mask_scalar;
+
+static EventPredicateKernel supported[3] = {
+	{.name = "scalar", .range_mask = &range_mask_scalar},
+};
+static size_t supported_length = 1;
+
+size_t
+event_predicate_supported_kernels(const EventPredicateKernel ** kernels)
+{
+	*kernels = supported;
+	return supported_length;
+}
+
+MODULE_CONSTRUCTOR(init)
+{
+#ifdef HAVE_X86_KERNELS
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("sse2")) {
+		supported[supported_length++] = (EventPredicateKernel) {.name = "sse2", .range_mask = &range_mask_sse2};
+	}
+	if (__builtin_cpu_supports("avx2")) {
+		supported[supported_length++] = (EventPredicateKernel) {.name = "avx2", .range_mask = &range_mask_avx2};
+	}
+#endif
+	event_predicate_range_mask = supported[supported_length - 1].range_mask;
+}
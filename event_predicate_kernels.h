@@ -0,0 +1,23 @@
+#ifndef EVENT_PREDICATE_KERNELS_H_
+#define EVENT_PREDICATE_KERNELS_H_
+
+#include "defs.h"
+
+// Events evaluated together, one bit per lane in the masks
+#define EVPRED_BATCH_LANES 64
+
+// Bit i is set iff min_value <= column[i] <= max_value, the column has EVPRED_BATCH_LANES values aligned to 32 bytes
+typedef uint64_t (*EventPredicateRangeMask)(const int64_t * column, int64_t min_value, int64_t max_value);
+
+typedef struct {
+	const char *name;
+	EventPredicateRangeMask range_mask;
+} EventPredicateKernel;
+
+// Selected at startup, may be replaced by any of the supported kernels
+extern EventPredicateRangeMask event_predicate_range_mask;
+
+// Kernels the processor supports, the selected one last
+size_t event_predicate_supported_kernels(const EventPredicateKernel ** kernels);
+
+#endif /* end of include guard: EVENT_PREDICATE_KERNELS_H_ */
@@ -0,0 +1,279 @@
+#define _GNU_SOURCE  // posix_spawn_file_actions_addfchdir_np
+#include <dlfcn.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <signal.h>
+#include <spawn.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "event_predicate_native.h"
+#include "hash_table.h"
+
+extern char **environ;
+
+static void *library = NULL;
+
+static int
+host_apply(EventPredicateHandle handle, EventNode * event)
+{
+	return event_predicate_apply(handle, event);
+}
+
+static bool
+host_enabled(EventPredicateHandle handle)
+{
+	return event_predicate_get(handle).enabled;
+}
+
+static bool
+host_inverted(EventPredicateHandle handle)
+{
+	return event_predicate_get(handle).inverted;
+}
+
+static const EventPredicateNativeHost host = {
+	.apply = &host_apply,
+	.enabled = &host_enabled,
+	.inverted = &host_inverted,
+};
+
+// The build running in the background, at most one at a time
+static struct {
+	pid_t pid;  // -1 if none
+	int directory_fd;
+	bool current;  // Built from the predicates registered now, cleared by the next load
+	const char *next_directory;  // Loaded once the stale build finishes, NULL if none
+	char name[32];
+	char source_name[64];
+	char temporary_name[64];
+} build = {
+	.pid = -1,
+	.directory_fd = -1,
+	.current = false,
+	.next_directory = NULL,
+};
+
+// Runs in the cache directory, the paths are relative to it, returns -1 if the compiler could not be started
+static pid_t
+start_compiler(int directory_fd, const char * source_name, const char * library_name)
+{
+	const char *compiler = getenv("CC");
+	if (!compiler || !*compiler) {
+		compiler = "cc";
+	}
+	char *const argv[] = {(char*) compiler, "-O2", "-shared", "-fPIC", "-o", (char*) library_name, (char*) source_name, NULL};
+	posix_spawn_file_actions_t actions;
+	if (posix_spawn_file_actions_init(&actions) != 0) {
+		return -1;
+	}
+	posix_spawnattr_t attributes;
+	if (posix_spawnattr_init(&attributes) != 0) {
+		posix_spawn_file_actions_destroy(&actions);
+		return -1;
+	}
+	// The caller may block signals it only handles while waiting for I/O
+	sigset_t no_signals;
+	sigemptyset(&no_signals);
+	pid_t pid;
+	bool spawned = posix_spawnattr_setflags(&attributes, POSIX_SPAWN_SETSIGMASK) == 0 && posix_spawnattr_setsigmask(&attributes, &no_signals) == 0
+		&& posix_spawn_file_actions_addfchdir_np(&actions, directory_fd) == 0 && posix_spawnp(&pid, compiler, &actions, &attributes, argv, environ) == 0;
+	posix_spawnattr_destroy(&attributes);
+	posix_spawn_file_actions_destroy(&actions);
+	return spawned ? pid : -1;
+}
+
+// Writes the source next to the library and starts the compiler, finish_build renames the built library into place, so concurrent instances never load a partial file
+static bool
+start_build(int directory_fd, const char * name, const char * source, size_t source_length)
+{
+	snprintf(build.name, sizeof(build.name), "%s", name);
+	snprintf(build.source_name, sizeof(build.source_name), "%s-%ld.c", name, (long) getpid());
+	snprintf(build.temporary_name, sizeof(build.temporary_name), "%s-%ld.so", name, (long) getpid());
+	int fd = openat(directory_fd, build.source_name, O_WRONLY | O_CREAT | O_TRUNC | O_NOFOLLOW | O_CLOEXEC, 0600);
+	if (fd < 0) {
+		return false;
+	}
+	bool written = write(fd, source, source_length) == (ssize_t) source_length;
+	close(fd);
+	pid_t pid = written ? start_compiler(directory_fd, build.source_name, build.temporary_name) : -1;
+	if (pid < 0) {
+		unlinkat(directory_fd, build.source_name, 0);
+		return false;
+	}
+	build.pid = pid;
+	build.directory_fd = directory_fd;
+	build.current = true;
+	build.next_directory = NULL;
+	return true;
+}
+
+// Cleans up after the exited compiler, returns false if the library was not built
+static bool
+finish_build(bool compiled)
+{
+	bool success = compiled && fchmodat(build.directory_fd, build.temporary_name, 0700, 0) == 0 && renameat(build.directory_fd, build.temporary_name, build.directory_fd, build.name) == 0;
+	if (!success) {
+		unlinkat(build.directory_fd, build.temporary_name, 0);
+	}
+	unlinkat(build.directory_fd, build.source_name, 0);
+	build.pid = -1;
+	return success;
+}
+
+// The process usually has access to the input devices, so only files that nobody else could have written are loaded
+static bool
+is_trusted(int fd, mode_t type)
+{
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		return false;
+	}
+	return (st.st_mode & S_IFMT) == type && st.st_uid == geteuid() && !(st.st_mode & (S_IWGRP | S_IWOTH));
+}
+
+// Returns a descriptor of the cached library if it is trusted, -1 otherwise, errno is ENOENT if it does not exist
+static int
+open_library(int directory_fd, const char * name)
+{
+	int fd = openat(directory_fd, name, O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
+	if (fd < 0) {
+		return -1;
+	}
+	if (!is_trusted(fd, S_IFREG)) {
+		fprintf(stderr, "Refusing to load \"%s\", which is not a regular file owned by the current user and not writable by others\n", name);
+		close(fd);
+		errno = EPERM;
+		return -1;
+	}
+	return fd;
+}
+
+// Takes the library descriptor
+static bool
+load_library(int library_fd)
+{
+	char path[32];
+	snprintf(path, sizeof(path), "/proc/self/fd/%d", library_fd);
+	void *handle = dlopen(path, RTLD_NOW | RTLD_LOCAL);
+	close(library_fd);
+	if (!handle) {
+		return false;
+	}
+	void (*init)(const EventPredicateNativeHost *) = (void (*)(const EventPredicateNativeHost *)) dlsym(handle, "evpred_native_init");
+	const size_t *count = dlsym(handle, "evpred_native_count");
+	EventPredicateNativeFunction *functions = dlsym(handle, "evpred_native_functions");
+	if (!init || !count || !functions || *count != (size_t) event_predicate_count()) {
+		dlclose(handle);
+		return false;
+	}
+	init(&host);
+	for (size_t i = 0; i < *count; ++i) {
+		event_predicate_set_native(i, functions[i]);
+	}
+	library = handle;
+	return true;
+}
+
+EventPredicateNativeStatus
+event_predicate_native_load(const char * cache_directory)
+{
+	event_predicate_native_unload();
+	if (build.pid >= 0) {
+		build.current = false;
+		build.next_directory = cache_directory;
+		return EVPRED_NATIVE_BUILDING;
+	}
+
+	char *source = NULL;
+	size_t source_length = 0;
+	FILE *stream = open_memstream(&source, &source_length);
+	if (!stream) {
+		return EVPRED_NATIVE_FAILED;
+	}
+	bool emitted = event_predicate_emit_native(stream);
+	if (fclose(stream) != 0 || !emitted) {
+		free(source);
+		return EVPRED_NATIVE_FAILED;
+	}
+
+	// The source covers everything the functions depend on, so its hash identifies the configuration
+	uint64_t hash = hash_table_key_from_bytes(source, source_length).pre_hash;
+	char name[32];
+	snprintf(name, sizeof(name), "predicates-%016" PRIx64 ".so", hash);
+	EventPredicateNativeStatus status = EVPRED_NATIVE_FAILED;
+	int directory_fd = -1, library_fd = -1;
+	if (mkdir(cache_directory, 0700) != 0 && errno != EEXIST) {
+		goto done;
+	}
+	directory_fd = open(cache_directory, O_RDONLY | O_DIRECTORY | O_CLOEXEC);
+	if (directory_fd < 0) {
+		goto done;
+	}
+	if (!is_trusted(directory_fd, S_IFDIR)) {
+		fprintf(stderr, "Refusing to use \"%s\", which is not owned by the current user or is writable by others\n", cache_directory);
+		goto done;
+	}
+
+	// Everything else goes through the checked descriptors, so replacing the directory or the library after the checks has no effect
+	library_fd = open_library(directory_fd, name);
+	if (library_fd >= 0) {
+		status = load_library(library_fd) ? EVPRED_NATIVE_LOADED : EVPRED_NATIVE_FAILED;
+	} else if (errno == ENOENT && start_build(directory_fd, name, source, source_length)) {
+		status = EVPRED_NATIVE_BUILDING;
+		directory_fd = -1;  // Kept by the build
+	}
+
+done:
+	if (directory_fd >= 0) {
+		close(directory_fd);
+	}
+	free(source);
+	return status;
+}
+
+EventPredicateNativeStatus
+event_predicate_native_poll()
+{
+	if (build.pid < 0) {
+		return library ? EVPRED_NATIVE_LOADED : EVPRED_NATIVE_FAILED;
+	}
+	int status;
+	pid_t exited;
+	while ((exited = waitpid(build.pid, &status, WNOHANG)) < 0 && errno == EINTR) {
+	}
+	if (exited == 0) {
+		return EVPRED_NATIVE_BUILDING;
+	}
+	bool built = finish_build(exited > 0 && WIFEXITED(status) && WEXITSTATUS(status) == 0);
+	EventPredicateNativeStatus result = EVPRED_NATIVE_FAILED;
+	if (build.current && built) {
+		int library_fd = open_library(build.directory_fd, build.name);
+		if (library_fd >= 0 && load_library(library_fd)) {
+			result = EVPRED_NATIVE_LOADED;
+		}
+	}
+	close(build.directory_fd);
+	build.directory_fd = -1;
+	// The predicates changed while building, the finished library is only cached
+	if (!build.current && build.next_directory) {
+		return event_predicate_native_load(build.next_directory);
+	}
+	return result;
+}
+
+void
+event_predicate_native_unload()
+{
+	if (!library) {
+		return;
+	}
+	EventPredicateHandle count = event_predicate_count();
+	for (EventPredicateHandle i = 0; i < count; ++i) {
+		event_predicate_set_native(i, NULL);
+	}
+	dlclose(library);
+	library = NULL;
+}
@@ -0,0 +1,42 @@
+#ifndef EVENT_PREDICATE_NATIVE_H_
+#define EVENT_PREDICATE_NATIVE_H_
+
+#include <stdio.h>
+#include "event_predicate.h"
+
+// Arguments of the generated functions, the generated source repeats these definitions
+typedef struct {
+	int64_t fields[5];  // Same order as the range predicate types
+	const uint8_t *modifier_bits;
+	size_t modifier_length;
+	EventNode *event;
+} EventPredicateNativeEvent;
+
+// Called by the generated code for the flags of the mutable predicates and the shared children
+typedef struct {
+	int (*apply)(EventPredicateHandle handle, EventNode * event);
+	bool (*enabled)(EventPredicateHandle handle);
+	bool (*inverted)(EventPredicateHandle handle);
+} EventPredicateNativeHost;
+
+// Returns an EventPredicateResult
+typedef int (*EventPredicateNativeFunction)(const EventPredicateNativeEvent * event);
+
+typedef enum {
+	EVPRED_NATIVE_FAILED,  // The predicates are interpreted
+	EVPRED_NATIVE_LOADED,
+	EVPRED_NATIVE_BUILDING,  // Interpreted until event_predicate_native_poll loads the built library
+} EventPredicateNativeStatus;
+
+// Translates the compiled predicates to C and loads the shared object cached in cache_directory under the hash of the source, or starts building it with $CC (cc by default) in a child process. The directory and the cached object must be owned by the effective user and not writable by the group or others. Must be called after event_predicate_compile_all, which drops the loaded functions
+EventPredicateNativeStatus event_predicate_native_load(const char * cache_directory);
+// Called after a child process exited (SIGCHLD), loads the library once its build finished. A build started before the last event_predicate_native_load is only cached, and the build for the current predicates is started then
+EventPredicateNativeStatus event_predicate_native_poll();
+void event_predicate_native_unload();
+
+// Implemented by event_predicate.c
+// Writes a translation unit defining evpred_native_init, evpred_native_count and evpred_native_functions, the function of predicate i or NULL if it has no program
+bool event_predicate_emit_native(FILE * out);
+void event_predicate_set_native(EventPredicateHandle handle, EventPredicateNativeFunction function);
+
+#endif /* end of include guard: EVENT_PREDICATE_NATIVE_H_ */
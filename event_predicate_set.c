@@ -0,0 +1,206 @@
+#include <string.h>
+#include "event_predicate_set.h"
+
+#define VALUE_SET_BITMAP_MIN_BITS 1024  // Smaller spans always use a bitmap
+#define VALUE_SET_BITMAP_BITS_PER_VALUE 32
+#define VALUE_SET_HASH_ATTEMPTS 64
+
+// Odd multipliers from splitmix64
+static uint64_t
+next_multiplier(uint64_t * state)
+{
+	uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+	return (z ^ (z >> 31)) | 1;
+}
+
+// Smallest power of two not less than count and 2, returns the shift selecting that many slots from a 64-bit product
+static uint8_t
+table_shift(size_t count, size_t * size)
+{
+	uint8_t shift = 63;
+	*size = 2;
+	while (*size < count) {
+		*size <<= 1;
+		--shift;
+	}
+	return shift;
+}
+
+static bool
+build_bitmap(EventPredicateValueSet * set, const int64_t * values, size_t length)
+{
+	uint64_t span = (uint64_t) values[length - 1] - (uint64_t) values[0] + 1;
+	if (!span || (span > VALUE_SET_BITMAP_MIN_BITS && span / length > VALUE_SET_BITMAP_BITS_PER_VALUE)) {
+		return false;
+	}
+	uint64_t *bitmap = T_ALLOC(span / 64 + 1, uint64_t);
+	if (!bitmap) {
+		return false;
+	}
+	for (size_t i = 0; i < length; ++i) {
+		uint64_t offset = (uint64_t) values[i] - (uint64_t) values[0];
+		bitmap[offset >> 6] |= (uint64_t) 1 << (offset & 63);
+	}
+	set->kind = VALUE_SET_BITMAP;
+	set->base = values[0];
+	set->span = span;
+	set->bitmap = bitmap;
+	return true;
+}
+
+// Two-level perfect hash: the values are split into buckets, each one gets a collision-free table of about the squared size
+static bool
+build_hash(EventPredicateValueSet * set, const int64_t * values, size_t length)
+{
+	if (length > UINT32_MAX / 16) {
+		return false;
+	}
+	size_t bucket_count;
+	uint8_t shift = table_shift(length, &bucket_count);
+	size_t *starts = T_ALLOC(bucket_count + 1, size_t);
+	size_t *cursors = T_ALLOC(bucket_count, size_t);
+	uint32_t *order = T_ALLOC(length, uint32_t);
+	EventPredicateValueBucket *buckets = T_ALLOC(bucket_count, EventPredicateValueBucket);
+	int64_t *slots = NULL;
+	if (!starts || !cursors || !order || !buckets) {
+		goto fail;
+	}
+
+	// A first level multiplier keeping the total size linear
+	uint64_t state = length;
+	uint64_t multiplier = 0;
+	size_t slot_count = 0;
+	bool found = false;
+	for (size_t attempt = 0; attempt < VALUE_SET_HASH_ATTEMPTS && !found; ++attempt) {
+		multiplier = next_multiplier(&state);
+		memset(starts, 0, (bucket_count + 1) * sizeof(size_t));
+		for (size_t i = 0; i < length; ++i) {
+			++starts[((uint64_t) values[i] * multiplier >> shift) + 1];
+		}
+		slot_count = 0;
+		for (size_t b = 0; b < bucket_count; ++b) {
+			size_t count = starts[b + 1];
+			if (count) {
+				size_t size;
+				table_shift(count * count, &size);
+				slot_count += size;
+			}
+		}
+		found = slot_count <= 8 * bucket_count;
+	}
+	if (!found) {
+		goto fail;
+	}
+	for (size_t b = 0; b < bucket_count; ++b) {
+		starts[b + 1] += starts[b];
+		cursors[b] = starts[b];
+	}
+	for (size_t i = 0; i < length; ++i) {
+		order[cursors[(uint64_t) values[i] * multiplier >> shift]++] = i;
+	}
+
+	if (!(slots = T_ALLOC(slot_count, int64_t))) {
+		goto fail;
+	}
+	for (size_t i = 0; i < slot_count; ++i) {
+		slots[i] = values[0];
+	}
+	size_t offset = 0;
+	for (size_t b = 0; b < bucket_count; ++b) {
+		size_t start = starts[b], end = starts[b + 1];
+		if (start == end) {
+			// Any slot holds one of the values
+			buckets[b] = (EventPredicateValueBucket) {
+				.multiplier = 0,
+				.offset = 0,
+				.shift = 63,
+			};
+			continue;
+		}
+		size_t size;
+		uint8_t bucket_shift = table_shift((end - start) * (end - start), &size);
+		uint64_t bucket_multiplier = 0;
+		bool placed = false;
+		for (size_t attempt = 0; attempt < VALUE_SET_HASH_ATTEMPTS && !placed; ++attempt) {
+			bucket_multiplier = next_multiplier(&state);
+			placed = true;
+			for (size_t j = start + 1; j < end && placed; ++j) {
+				uint64_t slot = (uint64_t) values[order[j]] * bucket_multiplier >> bucket_shift;
+				for (size_t k = start; k < j; ++k) {
+					if (((uint64_t) values[order[k]] * bucket_multiplier >> bucket_shift) == slot) {
+						placed = false;
+						break;
+					}
+				}
+			}
+		}
+		if (!placed) {
+			goto fail;
+		}
+		for (size_t j = start; j < end; ++j) {
+			slots[offset + ((uint64_t) values[order[j]] * bucket_multiplier >> bucket_shift)] = values[order[j]];
+		}
+		buckets[b] = (EventPredicateValueBucket) {
+			.multiplier = bucket_multiplier,
+			.offset = offset,
+			.shift = bucket_shift,
+		};
+		offset += size;
+	}
+
+	free(starts);
+	free(cursors);
+	free(order);
+	set->kind = VALUE_SET_HASH;
+	set->multiplier = multiplier;
+	set->shift = shift;
+	set->buckets = buckets;
+	set->slots = slots;
+	return true;
+
+fail:
+	free(starts);
+	free(cursors);
+	free(order);
+	free(buckets);
+	free(slots);
+	return false;
+}
+
+void
+event_predicate_value_set_build(EventPredicateValueSet * set, const int64_t * values, size_t length)
+{
+	*set = (EventPredicateValueSet) {
+		.kind = VALUE_SET_SORTED,
+		.length = length,
+		.values = values,
+		.bitmap = NULL,
+		.buckets = NULL,
+		.slots = NULL,
+	};
+	if (!length) {
+		return;
+	}
+	if (build_bitmap(set, values, length)) {
+		return;
+	}
+	build_hash(set, values, length);
+}
+
+void
+event_predicate_value_set_destroy(EventPredicateValueSet * set)
+{
+	free(set->bitmap);
+	free(set->buckets);
+	free(set->slots);
+	*set = (EventPredicateValueSet) {
+		.kind = VALUE_SET_SORTED,
+		.length = 0,
+		.values = NULL,
+		.bitmap = NULL,
+		.buckets = NULL,
+		.slots = NULL,
+	};
+}
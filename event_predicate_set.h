@@ -0,0 +1,66 @@
+#ifndef EVENT_PREDICATE_SET_H_
+#define EVENT_PREDICATE_SET_H_
+
+#include "defs.h"
+
+typedef enum {
+	VALUE_SET_SORTED,  // Binary search over the values
+	VALUE_SET_BITMAP,
+	VALUE_SET_HASH,
+} EventPredicateValueSetKind;
+
+// Second level of the perfect hash, the slot of a value is offset + (value * multiplier >> shift)
+typedef struct {
+	uint64_t multiplier;
+	uint32_t offset;
+	uint8_t shift;
+} EventPredicateValueBucket;
+
+// Membership lookup table for sorted values without duplicates
+typedef struct {
+	EventPredicateValueSetKind kind;
+	size_t length;
+	const int64_t *values;  // Not owned
+	int64_t base;  // Value of bit 0
+	uint64_t span;  // Number of bits
+	uint64_t *bitmap;
+	uint64_t multiplier;  // The bucket of a value is value * multiplier >> shift
+	uint8_t shift;
+	EventPredicateValueBucket *buckets;
+	int64_t *slots;  // Every slot holds one of the values, so a matching slot means membership
+} EventPredicateValueSet;
+
+// Chooses a bitmap for dense values and a perfect hash for sparse ones, the values must outlive the set
+void event_predicate_value_set_build(EventPredicateValueSet * set, const int64_t * values, size_t length);
+void event_predicate_value_set_destroy(EventPredicateValueSet * set);
+
+__attribute__((unused)) inline static bool
+event_predicate_value_set_contains(const EventPredicateValueSet * set, int64_t value)
+{
+	switch (set->kind) {
+	case VALUE_SET_BITMAP:
+		{
+			uint64_t offset = (uint64_t) value - (uint64_t) set->base;
+			return offset < set->span && (set->bitmap[offset >> 6] >> (offset & 63) & 1);
+		}
+	case VALUE_SET_HASH:
+		{
+			const EventPredicateValueBucket *bucket = &set->buckets[(uint64_t) value * set->multiplier >> set->shift];
+			return set->slots[bucket->offset + ((uint64_t) value * bucket->multiplier >> bucket->shift)] == value;
+		}
+	case VALUE_SET_SORTED:
+		break;
+	}
+	size_t lo = 0, hi = set->length;
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+		if (set->values[mid] < value) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	return lo < set->length && set->values[lo] == value;
+}
+
+#endif /* end of include guard: EVENT_PREDICATE_SET_H_ */
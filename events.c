@@ -21,6 +21,10 @@ event_replicate(EventNode * source, size_t count)
 		}
 		replica->position = NULL;
 		replica->input_index = 0;
+		replica->queue = (EventQueueLink) {
+			.prev = NULL,
+			.next = NULL,
+		};
 		replica->data = event_data_copy(source->data);
 		replica->prev = source;
 		replica->next = source->next;
@@ -49,7 +53,7 @@ event_create(const EventData * content)
 		if (absolute_time_cmp(self_time, other_time) >= 0) {
 			break;
 		}
-		list_pos = &other->next->prev;
+		list_pos = &other->prev;
 	}
 	EventNode * prev = *list_pos;
 	if (!prev) {
@@ -67,6 +71,7 @@ void
 event_destroy(EventNode * self)
 {
 	modifier_set_destruct(&self->data.modifiers);
+	event_queue_remove(self);
 	self->next->prev = self->prev;
 	self->prev->next = self->next;
 	self->prev = NULL;
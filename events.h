@@ -5,6 +5,8 @@
 #include "modifiers.h"
 #include "time.h"
 
+#define DEFAULT_EVENT_TTL 100
+
 typedef uint32_t EventNamespace;
 
 typedef struct {
@@ -24,16 +26,24 @@ typedef struct {
 
 typedef struct event_position_base EventPositionBase;
 typedef struct event_node EventNode;
+typedef struct event_queue_link EventQueueLink;
 
 struct event_position_base {
 	bool (*handle_event) (EventPositionBase * self, EventNode * event);  // If returns false, the scheduler should not rewind back to the start. Must return true if any events were deleted
+	bool (*handle_events) (EventPositionBase * self, EventNode ** events, size_t count);  // Optional, same as handle_event for consecutive events at this position in time order. Events left at the position are handled later
 	bool waiting_new_event;  // Skip from handling until it is set to true. Assigning this position to a event should unset this flag
+	bool blocked;  // Skip from handling while set, assigning events does not unset it
+};
+
+struct event_queue_link {
+	EventQueueLink *prev, *next;  // NULL if not queued, a queue head links to itself when empty
 };
 
 struct event_node {
 	EventNode *prev, *next;
 	EventPositionBase *position;
 	size_t input_index;
+	EventQueueLink queue;  // Events at the same position in the order they were queued, independent of the time order
 	EventData data;
 };
 
@@ -49,6 +59,37 @@ EventNode * event_create(const EventData * content);
 void event_destroy(EventNode * self);
 void event_destroy_all();
 
+__attribute__((unused)) inline static void
+event_queue_init(EventQueueLink * head)
+{
+	head->prev = head;
+	head->next = head;
+}
+
+__attribute__((unused)) inline static void
+event_queue_append(EventQueueLink * head, EventNode * event)
+{
+	EventQueueLink *link = &event->queue;
+	link->prev = head->prev;
+	link->next = head;
+	head->prev->next = link;
+	head->prev = link;
+}
+
+// Does nothing if the event is not queued
+__attribute__((unused)) inline static void
+event_queue_remove(EventNode * event)
+{
+	EventQueueLink *link = &event->queue;
+	if (!link->next) {
+		return;
+	}
+	link->prev->next = link->next;
+	link->next->prev = link->prev;
+	link->prev = NULL;
+	link->next = NULL;
+}
+
 __attribute__((unused)) inline static EventData
 event_data_copy(EventData orig)
 {
@@ -28,10 +28,52 @@ graph_channel_list_ensure(GraphChannelList * lst, size_t idx)
 	}
 }
 
+// Events stay at the input channels of a blocked node, so that they count towards the capacity of these channels
+static void
+graph_node_set_blocked(GraphNode * node, bool blocked)
+{
+	node->as_EventPositionBase.blocked = blocked;
+	for (size_t i = 0; i < node->inputs.length; ++i) {
+		GraphChannel *ch = node->inputs.elements[i];
+		if (ch && ch->end == node) {
+			ch->as_EventPositionBase.blocked = blocked;
+		}
+	}
+}
+
+static void
+graph_channel_unblock(GraphChannel * ch)
+{
+	if (!ch->blocking) {
+		return;
+	}
+	ch->blocking = false;
+	GraphNode *start = ch->start;
+	if (!start || !start->blocked_output_count) {
+		return;
+	}
+	if (--start->blocked_output_count == 0) {
+		graph_node_set_blocked(start, false);
+	}
+}
+
+static void
+graph_channel_dequeue(GraphChannel * ch, EventNode * event)
+{
+	event_queue_remove(event);
+	if (ch->length) {
+		--ch->length;
+	}
+	if (ch->blocking && ch->length < ch->capacity) {
+		graph_channel_unblock(ch);
+	}
+}
+
 static bool
 channel_handle_event(EventPositionBase * self, EventNode * event)
 {
 	GraphChannel *ch = DOWNCAST(GraphChannel, EventPositionBase, self);
+	graph_channel_dequeue(ch, event);
 	if (event->data.ttl == 0) {
 		event_destroy(event);
 		return true;
@@ -52,6 +94,86 @@ channel_handle_event(EventPositionBase * self, EventNode * event)
 	return true;  // Changes were made
 }
 
+static EventNode *
+graph_channel_find_oldest(GraphChannel * ch, const EventNode * except, const EventCode * code)
+{
+	for (EventQueueLink *link = ch->queue.next; link != &ch->queue; link = link->next) {
+		EventNode *ev = containerof(link, EventNode, queue);
+		if (ev == except) {
+			continue;
+		}
+		if (code && (ev->data.code.ns != code->ns || ev->data.code.major != code->major || ev->data.code.minor != code->minor)) {
+			continue;
+		}
+		return ev;
+	}
+	return NULL;
+}
+
+static void
+graph_channel_drop(GraphChannel * ch, EventNode * event)
+{
+	graph_channel_dequeue(ch, event);
+	event_destroy(event);
+}
+
+bool
+graph_channel_push(GraphChannel * ch, EventNode * event)
+{
+	if (!ch) {
+		event_destroy(event);
+		return false;
+	}
+	event_queue_remove(event);  // From the channel it was moved out of on reload
+	event->position = &ch->as_EventPositionBase;
+	event_queue_append(&ch->queue, event);
+	++ch->length;
+
+	if (ch->capacity && ch->length > ch->capacity) {
+		GraphChannelOverflowPolicy policy = ch->overflow_policy;
+		if (policy == CHANNEL_OVERFLOW_BLOCK && (!ch->start || !ch->start->as_EventPositionBase.handle_event)) {
+			// Sources cannot be paused
+			policy = CHANNEL_OVERFLOW_DROP_NEWEST;
+		}
+		EventNode *victim = NULL;
+		switch (policy) {
+		case CHANNEL_OVERFLOW_INVALID:
+		case CHANNEL_OVERFLOW_DROP_NEWEST:
+			graph_channel_drop(ch, event);
+			++ch->statistics.dropped;
+			return false;
+		case CHANNEL_OVERFLOW_COALESCE:
+			if ((victim = graph_channel_find_oldest(ch, event, &event->data.code))) {
+				graph_channel_drop(ch, victim);
+				++ch->statistics.coalesced;
+				break;
+			}
+			// fallthrough
+		case CHANNEL_OVERFLOW_DROP_OLDEST:
+			if ((victim = graph_channel_find_oldest(ch, event, NULL))) {
+				graph_channel_drop(ch, victim);
+				++ch->statistics.dropped;
+			}
+			break;
+		case CHANNEL_OVERFLOW_BLOCK:
+			// The event is kept, the producer waits until the channel drains
+			if (!ch->blocking) {
+				ch->blocking = true;
+				if (ch->start->blocked_output_count++ == 0) {
+					graph_node_set_blocked(ch->start, true);
+				}
+				++ch->statistics.blocked;
+			}
+			break;
+		}
+	}
+
+	if (ch->length > ch->statistics.high_water_mark) {
+		ch->statistics.high_water_mark = ch->length;
+	}
+	return true;
+}
+
 void
 graph_channel_init(GraphChannel * ch, GraphNode * start, size_t start_idx, GraphNode * end, size_t end_idx)
 {
@@ -83,8 +205,45 @@ graph_channel_init(GraphChannel * ch, GraphNode * start, size_t start_idx, Graph
 	ch->end = end;
 	ch->idx_start = start_idx;
 	ch->idx_end = end_idx;
+	ch->capacity = 0;
+	ch->overflow_policy = CHANNEL_OVERFLOW_DROP_NEWEST;
+	ch->length = 0;
+	event_queue_init(&ch->queue);
+	ch->blocking = false;
+	ch->statistics = (GraphChannelStatistics) {
+		.high_water_mark = 0,
+		.dropped = 0,
+		.coalesced = 0,
+		.blocked = 0,
+	};
 	ch->as_EventPositionBase.handle_event = &channel_handle_event;
+	ch->as_EventPositionBase.handle_events = NULL;
 	ch->as_EventPositionBase.waiting_new_event = false;
+	ch->as_EventPositionBase.blocked = end && end->as_EventPositionBase.blocked;
+}
+
+void
+graph_channel_set_capacity(GraphChannel * ch, size_t capacity, GraphChannelOverflowPolicy overflow_policy)
+{
+	ch->capacity = capacity;
+	ch->overflow_policy = overflow_policy;
+}
+
+static bool
+node_handle_events(EventPositionBase * self, EventNode ** events, size_t count)
+{
+	GraphNode *node = DOWNCAST(GraphNode, EventPositionBase, self);
+	for (size_t i = 0; i < node->outputs.length; ++i) {
+		const GraphChannel *ch = node->outputs.elements[i];
+		if (!ch || !ch->capacity) {
+			continue;
+		}
+		size_t free_capacity = ch->capacity > ch->length ? ch->capacity - ch->length : 0;
+		if (free_capacity < count) {
+			count = free_capacity ? free_capacity : 1;  // Let the overflow policy handle a full channel
+		}
+	}
+	return node->specification->handle_events(node->specification, node, events, count);
 }
 
 GraphNode *
@@ -93,7 +252,11 @@ graph_node_new(GraphNodeSpecification * spec, GraphNodeConfig * config, Initiali
 	if (!spec || !spec->create) {
 		return NULL;
 	}
-	return spec->create(spec, config, env);
+	GraphNode *node = spec->create(spec, config, env);
+	if (node && spec->handle_events) {
+		node->as_EventPositionBase.handle_events = &node_handle_events;
+	}
+	return node;
 }
 
 void
@@ -107,6 +270,7 @@ graph_node_delete(GraphNode * self)
 		GraphChannel *ch = self->inputs.elements[i];
 		if (ch && ch->end == self) {
 			ch->end = NULL;
+			ch->as_EventPositionBase.blocked = false;  // The events are dropped
 			if (!ch->start && !ch->end) {
 				// free(ch);  // TODO on orphaned
 			}
@@ -149,6 +313,67 @@ graph_node_register_io(GraphNode * self, ProcessingState * state)
 	spec->register_io(spec, self, state);
 }
 
+void
+graph_node_prepare(GraphNode * self)
+{
+	if (!self) {
+		return;
+	}
+	GraphNodeSpecification *spec = self->specification;
+	if (!spec || !spec->prepare) {
+		return;
+	}
+	spec->prepare(spec, self);
+}
+
+void
+graph_node_suspend(GraphNode * self)
+{
+	if (!self) {
+		return;
+	}
+	GraphNodeSpecification *spec = self->specification;
+	if (!spec || !spec->suspend) {
+		return;
+	}
+	spec->suspend(spec, self);
+}
+
+bool
+graph_node_resume(GraphNode * self)
+{
+	if (!self) {
+		return true;
+	}
+	GraphNodeSpecification *spec = self->specification;
+	if (!spec || !spec->resume) {
+		return true;
+	}
+	return spec->resume(spec, self);
+}
+
+void
+graph_node_visit_predicates(GraphNode * self, GraphNodePredicateVisitor visit, void * data)
+{
+	if (!self) {
+		return;
+	}
+	GraphNodeSpecification *spec = self->specification;
+	if (!spec || !spec->visit_predicates) {
+		return;
+	}
+	spec->visit_predicates(spec, self, visit, data);
+}
+
+size_t
+graph_node_max_amplification(GraphNodeSpecification * spec, const GraphNodeConfig * config, InitializationEnvironment * env)
+{
+	if (!spec || !spec->max_amplification) {
+		return 1;
+	}
+	return spec->max_amplification(spec, config, env);
+}
+
 void
 graph_channel_list_init(GraphChannelList * lst)
 {
@@ -186,16 +411,12 @@ graph_node_broadcast_forward_event(const GraphNode * source, EventNode * event)
 	}
 	size_t succeses = count;
 	for (size_t i = 0; i < count; ++i) {
-		EventPositionBase *output = &source->outputs.elements[i]->as_EventPositionBase;
-		if (!output) {
+		GraphChannel *output = source->outputs.elements[i];
+		EventNode *current = event;
+		event = current->next;
+		if (!graph_channel_push(output, current)) {
 			--succeses;
-			EventNode *orphaned = event;
-			event = orphaned->next;
-			event_destroy(orphaned);
-			continue;
 		}
-		event->position = output;
-		event = event->next;
 	}
 	return succeses;
 }
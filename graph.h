@@ -8,6 +8,7 @@
 typedef struct graph_node GraphNode;
 typedef struct graph_channel GraphChannel;
 typedef struct graph_node_specification GraphNodeSpecification;
+typedef void (*GraphNodePredicateVisitor)(EventPredicateHandle * handle, void * data);
 
 typedef struct {
 	size_t length;
@@ -20,26 +21,61 @@ struct graph_node {
 	EventPositionBase as_EventPositionBase;
 	GraphNodeSpecification * specification;
 	GraphChannelList inputs, outputs;
+	size_t blocked_output_count;  // Number of full outputs with the block overflow policy, the node and its input channels are blocked while it is positive
 };
 
+typedef struct {
+	size_t high_water_mark;
+	size_t dropped;
+	size_t coalesced;
+	size_t blocked;
+} GraphChannelStatistics;
+
 struct graph_channel {
 	EventPositionBase as_EventPositionBase;
 	GraphNode *start, *end;
 	size_t idx_start, idx_end;
+	size_t capacity;  // 0 if unbounded
+	GraphChannelOverflowPolicy overflow_policy;
+	size_t length;  // Number of events positioned at this channel
+	EventQueueLink queue;  // The same events, the first pushed first
+	bool blocking;
+	GraphChannelStatistics statistics;
 };
 
 struct graph_node_specification {
 	GraphNode * (*create)(GraphNodeSpecification * self, GraphNodeConfig * config, InitializationEnvironment * env);
 	void (*destroy)(GraphNodeSpecification * self, GraphNode * target);
 	void (*register_io)(GraphNodeSpecification * self, GraphNode * target, ProcessingState * state);
+	// Optional, upper bound of events sent on each output connector per received event, SIZE_MAX if unbounded, 1 if not provided. Computed from the configuration, so that the analysis does not have to create nodes
+	size_t (*max_amplification)(GraphNodeSpecification * self, const GraphNodeConfig * config, InitializationEnvironment * env);
+	// Optional, handles consecutive events in time order, count is limited by the free capacity of the outputs assuming one event per output connector per received event
+	bool (*handle_events)(GraphNodeSpecification * self, GraphNode * target, EventNode ** events, size_t count);
+	// Optional, called after the channels are attached and the predicates are folded
+	void (*prepare)(GraphNodeSpecification * self, GraphNode * target);
+	// Optional, called on reload before the replacement of the node is created, releases what the replacement may need exclusively (like a device grab). The node is not run again until resume is called
+	void (*suspend)(GraphNodeSpecification * self, GraphNode * target);
+	// Optional, undoes suspend when the reload fails, returns false if the node could not reacquire what it released
+	bool (*resume)(GraphNodeSpecification * self, GraphNode * target);
+	// Optional, calls visit with each predicate handle the node holds, which visit may replace, so that a reload can release the predicates no node uses
+	void (*visit_predicates)(GraphNodeSpecification * self, GraphNode * target, GraphNodePredicateVisitor visit, void * data);
 	char *name;
 	char *documentation;
+	bool is_source;  // Does not accept events, reads them from outside of the graph
 };
 
 void graph_channel_init(GraphChannel * ch, GraphNode * start, size_t start_idx, GraphNode * end, size_t end_idx);
+void graph_channel_set_capacity(GraphChannel * ch, size_t capacity, GraphChannelOverflowPolicy overflow_policy);
+// Positions the event at the channel applying the overflow policy, returns false if the event was destroyed
+bool graph_channel_push(GraphChannel * ch, EventNode * event);
 GraphNode *graph_node_new(GraphNodeSpecification * spec, GraphNodeConfig * config, InitializationEnvironment * env);
 void graph_node_delete(GraphNode * self);
 void graph_node_register_io(GraphNode * self, ProcessingState * state);
+void graph_node_prepare(GraphNode * self);
+void graph_node_suspend(GraphNode * self);
+bool graph_node_resume(GraphNode * self);
+void graph_node_visit_predicates(GraphNode * self, GraphNodePredicateVisitor visit, void * data);
+size_t graph_node_max_amplification(GraphNodeSpecification * spec, const GraphNodeConfig * config, InitializationEnvironment * env);
 void graph_channel_list_init(GraphChannelList * lst);
 void graph_channel_list_deinit(GraphChannelList * lst);
 ssize_t graph_node_broadcast_forward_event(const GraphNode * source, EventNode * event /* may become invalid afterward */);
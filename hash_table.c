@@ -1,11 +1,14 @@
 #include <stdlib.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 #include "hash_table.h"
 
 #define FNV_OFFSET_BASIS 0xCBF29CE484222325
 #define FNV_PRIME 0x00000100000001B3
 
-inline static uint64_t
-fnv_1a(uint8_t *bytes, size_t length)
+uint64_t
+hash_table_hash_fnv_1a(const char *bytes, size_t length)
 {
 	uint64_t hash = FNV_OFFSET_BASIS;
 	for (size_t i = 0; i < length; ++i) {
@@ -16,7 +19,109 @@ fnv_1a(uint8_t *bytes, size_t length)
 	return hash;
 }
 
+// Xors the halves of the 128-bit product
+inline static uint64_t
+multiply_fold(uint64_t a, uint64_t b)
+{
+	__uint128_t product = (__uint128_t) a * b;
+	return (uint64_t) product ^ (uint64_t) (product >> 64);
+}
+
+inline static uint64_t
+read_u64(const uint8_t * p)
+{
+	uint64_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+inline static uint64_t
+read_u32(const uint8_t * p)
+{
+	uint32_t value;
+	memcpy(&value, p, sizeof(value));
+	return value;
+}
+
+static const uint64_t wyhash_secret[4] = {0x2D358DCCAA6C78A5, 0x8BB84B93962EACC9, 0x4B33A62ED433D4A3, 0x4D5A2DA51DE1AA47};
+
+// Reads 8 or 16 bytes per multiplication, short keys take one overlapping read from each end
+uint64_t
+hash_table_hash_wyhash(const char *bytes, size_t length)
+{
+	const uint8_t *p = (const uint8_t*) bytes;
+	const uint64_t *secret = wyhash_secret;
+	uint64_t seed = multiply_fold(secret[0], secret[1]);
+	uint64_t a, b;
+	if (length <= 16) {
+		if (length >= 4) {
+			size_t middle = (length >> 3) << 2;
+			a = (read_u32(p) << 32) | read_u32(p + middle);
+			b = (read_u32(p + length - 4) << 32) | read_u32(p + length - 4 - middle);
+		} else if (length > 0) {
+			a = ((uint64_t) p[0] << 16) | ((uint64_t) p[length >> 1] << 8) | p[length - 1];
+			b = 0;
+		} else {
+			a = b = 0;
+		}
+	} else {
+		size_t i = length;
+		if (i > 48) {
+			uint64_t seed1 = seed, seed2 = seed;
+			do {
+				seed = multiply_fold(read_u64(p) ^ secret[1], read_u64(p + 8) ^ seed);
+				seed1 = multiply_fold(read_u64(p + 16) ^ secret[2], read_u64(p + 24) ^ seed1);
+				seed2 = multiply_fold(read_u64(p + 32) ^ secret[3], read_u64(p + 40) ^ seed2);
+				p += 48;
+				i -= 48;
+			} while (i > 48);
+			seed ^= seed1 ^ seed2;
+		}
+		while (i > 16) {
+			seed = multiply_fold(read_u64(p) ^ secret[1], read_u64(p + 8) ^ seed);
+			p += 16;
+			i -= 16;
+		}
+		a = read_u64(p + i - 16);
+		b = read_u64(p + i - 8);
+	}
+	__uint128_t product = (__uint128_t) (a ^ secret[1]) * (b ^ seed);
+	return multiply_fold((uint64_t) product ^ secret[0] ^ length, (uint64_t) (product >> 64) ^ secret[1]);
+}
+
+#if HASH_TABLE_HASH == HASH_TABLE_HASH_FNV_1A
+#define hash_bytes hash_table_hash_fnv_1a
+#elif HASH_TABLE_HASH == HASH_TABLE_HASH_WYHASH
+#define hash_bytes hash_table_hash_wyhash
+#else
+#error "Unknown HASH_TABLE_HASH"
+#endif
+
 #define NULL_KEY ((HashTableKey){.length = 0, .bytes = NULL, .pre_hash = 0})
+#define KEY_ARENA_CHUNK_SIZE 4096
+#define INTERNED_MIN_CAPACITY 64
+
+typedef struct key_arena_chunk KeyArenaChunk;
+
+struct key_arena_chunk {
+	KeyArenaChunk *next;
+	size_t used;
+	size_t size;
+	char bytes[];
+};
+
+// Every distinct key is stored once for the lifetime of the process, the slots are probed linearly by pre_hash
+static struct {
+	HashTableKey *slots;
+	size_t capacity;
+	size_t length;
+	KeyArenaChunk *chunks;  // The first one is being filled
+} interned = {
+	.slots = NULL,
+	.capacity = 0,
+	.length = 0,
+	.chunks = NULL,
+};
 
 HashTableKey
 hash_table_key_from_bytes(const char *bytes, size_t size)
@@ -27,11 +132,98 @@ hash_table_key_from_bytes(const char *bytes, size_t size)
 	HashTableKey key = {
 		.length = size,
 		.bytes = bytes,
-		.pre_hash = fnv_1a((uint8_t*) bytes, size),
+		.pre_hash = hash_bytes(bytes, size),
 	};
 	return key;
 }
 
+static char *
+key_arena_alloc(size_t size)
+{
+	KeyArenaChunk *chunk = interned.chunks;
+	if (!chunk || chunk->size - chunk->used < size) {
+		size_t chunk_size = size > KEY_ARENA_CHUNK_SIZE ? size : KEY_ARENA_CHUNK_SIZE;
+		if (!(chunk = malloc(sizeof(KeyArenaChunk) + chunk_size))) {
+			return NULL;
+		}
+		chunk->used = 0;
+		chunk->size = chunk_size;
+		// A nearly full chunk is left behind only if the new one is not a single large key
+		if (interned.chunks && size > KEY_ARENA_CHUNK_SIZE) {
+			chunk->next = interned.chunks->next;
+			interned.chunks->next = chunk;
+		} else {
+			chunk->next = interned.chunks;
+			interned.chunks = chunk;
+		}
+	}
+	char *bytes = chunk->bytes + chunk->used;
+	chunk->used += size;
+	return bytes;
+}
+
+// Fibonacci hashing, the low bits of pre_hash are too similar for similar keys
+inline static size_t
+interned_position(uint64_t pre_hash, size_t capacity)
+{
+	return (pre_hash * 0x9E3779B97F4A7C15) >> (64 - __builtin_ctzll(capacity));
+}
+
+static bool
+interned_grow()
+{
+	size_t capacity = interned.capacity ? interned.capacity * 2 : INTERNED_MIN_CAPACITY;
+	HashTableKey *slots = T_ALLOC(capacity, HashTableKey);
+	if (!slots) {
+		return false;
+	}
+	for (size_t i = 0; i < interned.capacity; ++i) {
+		if (!interned.slots[i].bytes) {
+			continue;
+		}
+		size_t index = interned_position(interned.slots[i].pre_hash, capacity);
+		while (slots[index].bytes) {
+			index = (index + 1) & (capacity - 1);
+		}
+		slots[index] = interned.slots[i];
+	}
+	free(interned.slots);
+	interned.slots = slots;
+	interned.capacity = capacity;
+	return true;
+}
+
+HashTableKey
+hash_table_key_intern(const HashTableKey key)
+{
+	if (!key.bytes) {
+		return key;
+	}
+	if (interned.length * 2 >= interned.capacity && !interned_grow()) {
+		return NULL_KEY;
+	}
+	size_t index = interned_position(key.pre_hash, interned.capacity);
+	for (; interned.slots[index].bytes; index = (index + 1) & (interned.capacity - 1)) {
+		const HashTableKey *slot = &interned.slots[index];
+		if (slot->pre_hash == key.pre_hash && slot->length == key.length && memcmp(slot->bytes, key.bytes, key.length) == 0) {
+			return *slot;
+		}
+	}
+	char *bytes = key_arena_alloc(key.length + 1);
+	if (!bytes) {
+		return NULL_KEY;
+	}
+	memcpy(bytes, key.bytes, key.length);
+	bytes[key.length] = 0;
+	interned.slots[index] = (HashTableKey) {
+		.length = key.length,
+		.bytes = bytes,
+		.pre_hash = key.pre_hash,
+	};
+	++interned.length;
+	return interned.slots[index];
+}
+
 HashTableKey
 hash_table_key_copy(const HashTableKey old)
 {
@@ -62,31 +254,24 @@ hash_table_key_deinit_copied(HashTableKey *key)
 	key->pre_hash = 0;
 }
 
-#define FAMILY_PRIME 0x1FFFFFFFFFFFFFFF
-
 inline static HashFamilyMember
 family_random_member()
 {
 	uint64_t n[2];
 	for (int i = 0; i < 2; ++i) {
-		n[i] = (uint64_t)((rand() / (double) RAND_MAX) * (FAMILY_PRIME - RAND_MAX) + rand()) % FAMILY_PRIME;
-	}
-	if (!n[0]) {
-		n[0] = 1;
+		n[i] = ((uint64_t) rand() << 62) ^ ((uint64_t) rand() << 31) ^ rand();
 	}
 	return (HashFamilyMember) {
-		.a = n[0],
+		.a = n[0] | 1,
 		.b = n[1],
 	};
 }
 
-inline static size_t
+// Seeds the pre-hash per table, both the low bits (control tags) and the high ones (groups) depend on every pre-hash bit
+inline static uint64_t
 family_map(HashFamilyMember member, uint64_t pre_hash)
 {
-	if (!member.a)
-		++member.a;
-	uint64_t hash = (pre_hash * member.a + member.b) % FAMILY_PRIME;  // Integer overflows may influence the properties of this family
-	return hash;
+	return multiply_fold(pre_hash ^ member.b, member.a);
 }
 
 bool
@@ -108,21 +293,148 @@ hash_table_key_equals(const HashTableKey lhs, const HashTableKey rhs)
 	return memcmp(lhs.bytes, rhs.bytes, length) == 0;
 }
 
+// Full slots hold the low 7 bits of the hash, the high bit marks the free ones
+#define CONTROL_EMPTY ((uint8_t) 0x80)
+#define CONTROL_DELETED ((uint8_t) 0xFE)
+#define GROUP_WIDTH 16  // Slots probed at once, the capacity is a power of two not less than this
+#define MIN_CAPACITY GROUP_WIDTH
+
+// Bit i is set iff group[i] == control
+inline static uint32_t
+group_match(const uint8_t * group, uint8_t control)
+{
+#ifdef __SSE2__
+	__m128i bytes = _mm_loadu_si128((const __m128i*) group);
+	return _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(control)));
+#else
+	uint32_t mask = 0;
+	for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+		mask |= (uint32_t) (group[i] == control) << i;
+	}
+	return mask;
+#endif
+}
+
+// Bit i is set iff group[i] is empty or deleted
+inline static uint32_t
+group_match_free(const uint8_t * group)
+{
+#ifdef __SSE2__
+	return _mm_movemask_epi8(_mm_loadu_si128((const __m128i*) group));
+#else
+	uint32_t mask = 0;
+	for (size_t i = 0; i < GROUP_WIDTH; ++i) {
+		mask |= (uint32_t) (group[i] >> 7) << i;
+	}
+	return mask;
+#endif
+}
+
+// Groups are visited at triangular offsets, which covers all of them for a power of two count
+typedef struct {
+	size_t group;
+	size_t group_mask;
+	size_t step;
+} ProbeSequence;
+
+inline static ProbeSequence
+probe_start(size_t capacity, uint64_t hash)
+{
+	size_t group_mask = capacity / GROUP_WIDTH - 1;
+	return (ProbeSequence) {
+		.group = (hash >> 7) & group_mask,
+		.group_mask = group_mask,
+		.step = 0,
+	};
+}
+
+inline static bool
+probe_next(ProbeSequence * probe)
+{
+	if (probe->step++ == probe->group_mask) {
+		return false;
+	}
+	probe->group = (probe->group + probe->step) & probe->group_mask;
+	return true;
+}
+
+inline static uint64_t
+key_hash(const HashTableDynamicData * ht, const HashTableKey key)
+{
+	return family_map(ht->family_member, key.pre_hash);
+}
+
+// First empty or deleted slot of the probe sequence, there is always one below the maximal load
+static size_t
+find_free_slot(const uint8_t * control, size_t capacity, uint64_t hash)
+{
+	ProbeSequence probe = probe_start(capacity, hash);
+	do {
+		uint32_t free_slots = group_match_free(control + probe.group * GROUP_WIDTH);
+		if (free_slots) {
+			return probe.group * GROUP_WIDTH + __builtin_ctz(free_slots);
+		}
+	} while (probe_next(&probe));
+	return capacity;
+}
+
+// Probing stops at a group with an empty slot, so no sequence continues past such a group and the slot can become empty again
+static void
+erase_control(uint8_t * control, size_t index, size_t * growth_left)
+{
+	if (group_match(control + (index & ~(size_t) (GROUP_WIDTH - 1)), CONTROL_EMPTY)) {
+		control[index] = CONTROL_EMPTY;
+		++*growth_left;
+	} else {
+		control[index] = CONTROL_DELETED;
+	}
+}
+
+static uint8_t *
+create_control(size_t capacity, size_t * growth_left)
+{
+	uint8_t *control = T_ALLOC(capacity, uint8_t);
+	if (control) {
+		memset(control, CONTROL_EMPTY, capacity);
+		*growth_left = capacity - capacity / 8;  // Load factor 7/8
+	}
+	return control;
+}
+
+// Capacity for one more entry when no empty slots are left, mostly deleted slots are reclaimed in place
+inline static size_t
+next_capacity(size_t capacity, size_t length)
+{
+	if (capacity < MIN_CAPACITY) {
+		return MIN_CAPACITY;
+	}
+	return length * 16 <= capacity * 7 ? capacity : capacity * 2;
+}
+
+// Smallest capacity holding length entries below the maximal load
 inline static size_t
-initial_position(const HashTableKey key, const HashTableDynamicData * ht)
+reserved_capacity(size_t length)
 {
-	uint64_t hash = family_map(ht->family_member, key.pre_hash);
-	return hash % ht->capacity;
+	size_t capacity = MIN_CAPACITY;
+	while (capacity - capacity / 8 < length) {
+		capacity *= 2;
+	}
+	return capacity;
 }
 
+// Capacity to rehash into after a deletion, 0 if the table is fine: tables at a low load shrink, and deleted slots taking a quarter of the table are purged, so that lookups in a churning table stay short
 inline static size_t
-probe_next(size_t current_index, size_t base_index, size_t iteration, size_t modulo)
+compact_capacity(size_t capacity, size_t length, size_t growth_left)
 {
-	(void) base_index;
-	(void) iteration;
-	++current_index;
-	current_index %= modulo;
-	return current_index;
+	size_t deleted = capacity - capacity / 8 - growth_left - length;
+	if (capacity > MIN_CAPACITY && length < capacity / 8) {
+		size_t target = MIN_CAPACITY;
+		while (target < length * 4) {
+			target *= 2;
+		}
+		return target;
+	}
+	return deleted > capacity / 4 ? capacity : 0;
 }
 
 static HashTableDynamicData
@@ -133,28 +445,32 @@ create_table(size_t capacity, size_t value_size, HashFamilyMember family_member)
 		.capacity = 0,
 		.length = 0,
 		.key_array = NULL,
+		.control = NULL,
+		.growth_left = 0,
 		.family_member = family_member,
 		.value_size = value_size,
 	};
 	void *value_array = calloc(capacity, value_size);
-	if (!value_array) {
-		return data;
-	}
 	HashTableKeyEntry *key_array = T_ALLOC(capacity, HashTableKeyEntry);
-	if (!key_array) {
+	uint8_t *control = create_control(capacity, &data.growth_left);
+	if (!value_array || !key_array || !control) {
 		free(value_array);
+		free(key_array);
+		free(control);
+		data.growth_left = 0;
 		return data;
 	}
 	data.value_array = value_array;
 	data.capacity = capacity;
 	data.key_array = key_array;
+	data.control = control;
 	return data;
 }
 
 void
 hash_table_init_impl(HashTableDynamicData * data, size_t value_size, void (*value_deinit)(void*))
 {
-	*data = create_table(5, value_size, family_random_member());
+	*data = create_table(MIN_CAPACITY, value_size, family_random_member());
 	data->value_deinit = value_deinit;
 }
 
@@ -164,11 +480,8 @@ hash_table_deinit_impl(HashTableDynamicData * data)
 	if (data->key_array && data->value_array && data->length) {
 		void (*value_deinit)(void*) = data->value_deinit;
 		for (HashTableIndex i = 0; i < (ssize_t) data->capacity; ++i) {
-			if (data->key_array[i].key.bytes) {
-				if (value_deinit) {
-					value_deinit(data->value_array + (data->value_size * (size_t) i));
-				}
-				hash_table_key_deinit_copied(&data->key_array[i].key);
+			if (data->key_array[i].key.bytes && value_deinit) {
+				value_deinit(data->value_array + (data->value_size * (size_t) i));
 			}
 		}
 	}
@@ -180,63 +493,44 @@ hash_table_deinit_impl(HashTableDynamicData * data)
 		free(data->value_array);
 		data->value_array = NULL;
 	}
+	if (data->control) {
+		free(data->control);
+		data->control = NULL;
+	}
 	data->capacity = 0;
 	data->length = 0;
+	data->growth_left = 0;
 }
 
-static void
-hash_table_grow(HashTableDynamicData * old_ht)
+// Moves the entries into a new table without copying the keys, dropping the deleted slots
+static bool
+hash_table_resize(HashTableDynamicData * old_ht, size_t capacity)
 {
-	size_t capacity = old_ht->capacity;
-	capacity += (capacity >> 1) + 1;
 	const size_t value_size = old_ht->value_size;
 	HashTableDynamicData new_ht = create_table(capacity, value_size, old_ht->family_member);
 	if (!new_ht.key_array) {
-		return;
+		return false;
 	}
 
 	for (size_t i = 0; i < old_ht->capacity; ++i) {
-		if (!old_ht->key_array[i].key.bytes) {
+		if (old_ht->control[i] & CONTROL_EMPTY) {
 			continue;
 		}
-		if (hash_table_insert_impl(&new_ht, old_ht->key_array[i].key, old_ht->value_array + (i * value_size)) < 0) {
-			hash_table_deinit_impl(&new_ht);
-			return;
-		}
-	}
-
+		uint64_t hash = key_hash(&new_ht, old_ht->key_array[i].key);
+		size_t index = find_free_slot(new_ht.control, new_ht.capacity, hash);
+		new_ht.control[index] = hash & 0x7F;
+		new_ht.key_array[index] = old_ht->key_array[i];
+		memcpy(new_ht.value_array + (index * value_size), old_ht->value_array + (i * value_size), value_size);
+	}
+	new_ht.length = old_ht->length;
+	new_ht.growth_left -= new_ht.length;
 	new_ht.value_deinit = old_ht->value_deinit;
-	old_ht->value_deinit = NULL;
-	// TODO avoid duplication-deletion of the keys
-	hash_table_deinit_impl(old_ht);
-	*old_ht = new_ht;
-}
-
-static void
-hash_table_change_hash(HashTableDynamicData * old_ht)
-{
-	const size_t capacity = old_ht->capacity;
-	const size_t value_size = old_ht->value_size;
-	HashTableDynamicData new_ht = create_table(capacity, value_size, family_random_member());
-	if (!new_ht.key_array) {
-		return;
-	}
-
-	for (size_t i = 0; i < old_ht->capacity; ++i) {
-		if (!old_ht->key_array[i].key.bytes) {
-			continue;
-		}
-		if (hash_table_insert_impl(&new_ht, old_ht->key_array[i].key, old_ht->value_array + (i * value_size)) < 0) {
-			hash_table_deinit_impl(&new_ht);
-			return;
-		}
-	}
 
-	new_ht.value_deinit = old_ht->value_deinit;
-	old_ht->value_deinit = NULL;
-	// TODO avoid duplication-deletion of the keys
-	hash_table_deinit_impl(old_ht);
+	free(old_ht->key_array);
+	free(old_ht->value_array);
+	free(old_ht->control);
 	*old_ht = new_ht;
+	return true;
 }
 
 HashTableIndex
@@ -245,83 +539,63 @@ hash_table_insert_impl(HashTableDynamicData * ht, const HashTableKey key, const
 	if (!key.bytes) {
 		return -1;
 	}
-	size_t length = ht->length;
-	size_t capacity = ht->capacity;
-	if (length + (length >> 1) >= ht->capacity) {
-		hash_table_grow(ht);
-		capacity = ht->capacity;
-	}
-	if (length >= capacity) {
-		return -1;
-	}
-
-	const size_t base_index = initial_position(key, ht);
-	size_t current_index = base_index;
-	size_t collision_offset = 0;
-	bool found = false;
-	bool overwrite = false;
-	bool pre_hash_collision = false;
-	for (; collision_offset < capacity; current_index = probe_next(current_index, base_index, ++collision_offset, capacity)) {
-		if (!ht->key_array[current_index].key.bytes) {
-			found = true;
-			break;
-		}
-		if (hash_table_key_equals(key, ht->key_array[current_index].key)) {
-			overwrite = true;
-			found = true;
-			break;
-		}
-		if (!pre_hash_collision) {
-			pre_hash_collision = key.pre_hash == ht->key_array[current_index].key.pre_hash;
-		}
-	}
-	if (!found) {
-		return -1;
-	}
-
-	void *value_target_ptr = ht->value_array + (ht->value_size * current_index);
-	if (ht->key_array[base_index].max_collision_offset < collision_offset) {
-		ht->key_array[base_index].max_collision_offset = collision_offset;
-	}
-	if (overwrite) {
+	HashTableIndex existing = hash_table_find_impl(ht, key);
+	if (existing >= 0) {
+		void *value_target_ptr = ht->value_array + (ht->value_size * existing);
 		// Deinitialize the old value
 		void (*value_deinit)(void*) = ht->value_deinit;
 		if (value_deinit) {
 			value_deinit(value_target_ptr);
 		}
-	} else {
-		// Make a local copy of the key
-		ht->key_array[current_index].key = hash_table_key_copy(key);
+		memcpy(value_target_ptr, value_ptr, ht->value_size);  // Assign the value
+		return existing;
 	}
-	memcpy(value_target_ptr, value_ptr, ht->value_size);  // Assign the value
-	ht->length = ++length;
 
-	if (!pre_hash_collision && (collision_offset << 1) > capacity + 6) {
-		hash_table_change_hash(ht);
+	if (!ht->growth_left && !hash_table_resize(ht, next_capacity(ht->capacity, ht->length))) {
+		return -1;
 	}
 
-	return current_index;
+	uint64_t hash = key_hash(ht, key);
+	size_t index = find_free_slot(ht->control, ht->capacity, hash);
+	if (index >= ht->capacity) {
+		return -1;
+	}
+	// The table refers to the interned copy of the key
+	HashTableKey copied = hash_table_key_intern(key);
+	if (!copied.bytes) {
+		return -1;
+	}
+	if (ht->control[index] == CONTROL_EMPTY) {
+		--ht->growth_left;
+	}
+	ht->control[index] = hash & 0x7F;
+	ht->key_array[index].key = copied;
+	memcpy(ht->value_array + (ht->value_size * index), value_ptr, ht->value_size);  // Assign the value
+	++ht->length;
+	return index;
 }
 
 HashTableIndex
 hash_table_find_impl(const HashTableDynamicData * ht, const HashTableKey key)
 {
-	if (!key.bytes) {
+	if (!key.bytes || !ht->capacity) {
 		return -1;
 	}
 
-	const size_t capacity = ht->capacity;
-	const size_t base_index = initial_position(key, ht);
-	const size_t max_collision_offset = ht->key_array[base_index].max_collision_offset;
-	size_t collision_offset = 0;
-	size_t current_index = base_index;
-
-	for (; collision_offset <= max_collision_offset; current_index = probe_next(current_index, base_index, ++collision_offset, capacity)) {
-		if (hash_table_key_equals(key, ht->key_array[current_index].key)) {
-			return current_index;
-			break;
+	uint64_t hash = key_hash(ht, key);
+	ProbeSequence probe = probe_start(ht->capacity, hash);
+	do {
+		const uint8_t *group = ht->control + probe.group * GROUP_WIDTH;
+		for (uint32_t match = group_match(group, hash & 0x7F); match; match &= match - 1) {
+			size_t index = probe.group * GROUP_WIDTH + __builtin_ctz(match);
+			if (hash_table_key_equals(key, ht->key_array[index].key)) {
+				return index;
+			}
 		}
-	}
+		if (group_match(group, CONTROL_EMPTY)) {
+			return -1;
+		}
+	} while (probe_next(&probe));
 
 	return -1;
 }
@@ -333,21 +607,20 @@ hash_table_delete_at_index_impl(HashTableDynamicData * ht, const HashTableIndex
 		return false;
 	}
 
-	if (index < 0 || (size_t) index > ht->capacity) {
+	if (index < 0 || (size_t) index >= ht->capacity) {
 		return false;
 	}
 
 	HashTableKeyEntry *key_entry_ptr = ht->key_array + index;
 	void *value_ptr = ht->value_array + (ht->value_size * index);
 
-	if (!key_entry_ptr->key.bytes) {
+	if (ht->control[index] & CONTROL_EMPTY) {
 		// No entry at index
 		return false;
 	}
 
-	// TODO find base_index and reduce its max_collision_offset when provably justified
-
-	hash_table_key_deinit_copied(&key_entry_ptr->key);
+	erase_control(ht->control, index, &ht->growth_left);
+	key_entry_ptr->key = NULL_KEY;
 	ht->length -= 1;
 
 	void (*value_deinit)(void*) = ht->value_deinit;
@@ -356,5 +629,207 @@ hash_table_delete_at_index_impl(HashTableDynamicData * ht, const HashTableIndex
 	}
 	memset(value_ptr, 0, ht->value_size);
 
+	size_t capacity = compact_capacity(ht->capacity, ht->length, ht->growth_left);
+	if (capacity) {
+		hash_table_resize(ht, capacity);
+	}
+	return true;
+}
+
+bool
+hash_table_reserve_impl(HashTableDynamicData * ht, size_t length)
+{
+	// Deleted slots are not counted by growth_left, a rehash reclaims them
+	if (length <= ht->length + ht->growth_left) {
+		return true;
+	}
+	return hash_table_resize(ht, reserved_capacity(length));
+}
+
+size_t
+hash_table_insert_bulk_impl(HashTableDynamicData * ht, const HashTableKey * keys, const void * values_ptr, size_t count)
+{
+	// Without the reservation the insertions still grow the table as needed
+	hash_table_reserve_impl(ht, ht->length + count);
+	size_t inserted = 0;
+	for (size_t i = 0; i < count; ++i) {
+		if (hash_table_insert_impl(ht, keys[i], values_ptr + (ht->value_size * i)) >= 0) {
+			++inserted;
+		}
+	}
+	return inserted;
+}
+
+// Fibonacci hashing, the high bits are folded down, since the low product bits only depend on the low key bits
+inline static uint64_t
+int_key_hash(uint64_t key)
+{
+	uint64_t hash = key * 0x9E3779B97F4A7C15;
+	return hash ^ (hash >> 32);
+}
+
+static IntHashTableDynamicData
+create_int_table(size_t capacity, size_t value_size)
+{
+	IntHashTableDynamicData data = {
+		.value_array = NULL,
+		.capacity = 0,
+		.length = 0,
+		.key_array = NULL,
+		.control = NULL,
+		.growth_left = 0,
+		.value_size = value_size,
+	};
+	void *value_array = calloc(capacity, value_size);
+	uint64_t *key_array = T_ALLOC(capacity, uint64_t);
+	uint8_t *control = create_control(capacity, &data.growth_left);
+	if (!value_array || !key_array || !control) {
+		free(value_array);
+		free(key_array);
+		free(control);
+		data.growth_left = 0;
+		return data;
+	}
+	data.value_array = value_array;
+	data.capacity = capacity;
+	data.key_array = key_array;
+	data.control = control;
+	return data;
+}
+
+void
+int_hash_table_init_impl(IntHashTableDynamicData * data, size_t value_size, void (*value_deinit)(void*))
+{
+	*data = create_int_table(MIN_CAPACITY, value_size);
+	data->value_deinit = value_deinit;
+}
+
+void
+int_hash_table_deinit_impl(IntHashTableDynamicData * data)
+{
+	if (data->control && data->value_deinit) {
+		for (size_t i = 0; i < data->capacity; ++i) {
+			if (!(data->control[i] & CONTROL_EMPTY)) {
+				data->value_deinit(data->value_array + (data->value_size * i));
+			}
+		}
+	}
+	free(data->key_array);
+	free(data->value_array);
+	free(data->control);
+	data->key_array = NULL;
+	data->value_array = NULL;
+	data->control = NULL;
+	data->capacity = 0;
+	data->length = 0;
+	data->growth_left = 0;
+}
+
+static bool
+int_hash_table_resize(IntHashTableDynamicData * old_ht, size_t capacity)
+{
+	const size_t value_size = old_ht->value_size;
+	IntHashTableDynamicData new_ht = create_int_table(capacity, value_size);
+	if (!new_ht.key_array) {
+		return false;
+	}
+
+	for (size_t i = 0; i < old_ht->capacity; ++i) {
+		if (old_ht->control[i] & CONTROL_EMPTY) {
+			continue;
+		}
+		uint64_t hash = int_key_hash(old_ht->key_array[i]);
+		size_t index = find_free_slot(new_ht.control, new_ht.capacity, hash);
+		new_ht.control[index] = hash & 0x7F;
+		new_ht.key_array[index] = old_ht->key_array[i];
+		memcpy(new_ht.value_array + (index * value_size), old_ht->value_array + (i * value_size), value_size);
+	}
+	new_ht.length = old_ht->length;
+	new_ht.growth_left -= new_ht.length;
+	new_ht.value_deinit = old_ht->value_deinit;
+
+	free(old_ht->key_array);
+	free(old_ht->value_array);
+	free(old_ht->control);
+	*old_ht = new_ht;
+	return true;
+}
+
+HashTableIndex
+int_hash_table_insert_impl(IntHashTableDynamicData * ht, uint64_t key, const void * value_ptr)
+{
+	HashTableIndex index = int_hash_table_find_impl(ht, key);
+	if (index >= 0) {
+		void *value_target_ptr = ht->value_array + (ht->value_size * index);
+		if (ht->value_deinit) {
+			ht->value_deinit(value_target_ptr);
+		}
+		memcpy(value_target_ptr, value_ptr, ht->value_size);
+		return index;
+	}
+
+	if (!ht->growth_left && !int_hash_table_resize(ht, next_capacity(ht->capacity, ht->length))) {
+		return -1;
+	}
+
+	uint64_t hash = int_key_hash(key);
+	index = find_free_slot(ht->control, ht->capacity, hash);
+	if ((size_t) index >= ht->capacity) {
+		return -1;
+	}
+	if (ht->control[index] == CONTROL_EMPTY) {
+		--ht->growth_left;
+	}
+	ht->control[index] = hash & 0x7F;
+	ht->key_array[index] = key;
+	memcpy(ht->value_array + (ht->value_size * index), value_ptr, ht->value_size);
+	++ht->length;
+	return index;
+}
+
+HashTableIndex
+int_hash_table_find_impl(const IntHashTableDynamicData * ht, uint64_t key)
+{
+	if (!ht->capacity) {
+		return -1;
+	}
+
+	uint64_t hash = int_key_hash(key);
+	ProbeSequence probe = probe_start(ht->capacity, hash);
+	do {
+		const uint8_t *group = ht->control + probe.group * GROUP_WIDTH;
+		for (uint32_t match = group_match(group, hash & 0x7F); match; match &= match - 1) {
+			size_t index = probe.group * GROUP_WIDTH + __builtin_ctz(match);
+			if (ht->key_array[index] == key) {
+				return index;
+			}
+		}
+		if (group_match(group, CONTROL_EMPTY)) {
+			return -1;
+		}
+	} while (probe_next(&probe));
+
+	return -1;
+}
+
+bool
+int_hash_table_delete_at_index_impl(IntHashTableDynamicData * ht, const HashTableIndex index)
+{
+	if (index < 0 || (size_t) index >= ht->capacity || (ht->control[index] & CONTROL_EMPTY)) {
+		return false;
+	}
+	erase_control(ht->control, index, &ht->growth_left);
+	ht->length -= 1;
+
+	void *value_ptr = ht->value_array + (ht->value_size * index);
+	if (ht->value_deinit) {
+		ht->value_deinit(value_ptr);
+	}
+	memset(value_ptr, 0, ht->value_size);
+
+	size_t capacity = compact_capacity(ht->capacity, ht->length, ht->growth_left);
+	if (capacity) {
+		int_hash_table_resize(ht, capacity);
+	}
 	return true;
 }
@@ -8,12 +8,14 @@
 	size_t capacity; \
 	size_t length; \
 	HashTableKeyEntry *key_array; \
+	uint8_t *control; \
+	size_t growth_left; \
 	HashFamilyMember family_member; \
 ;
 
 #define TYPED_HASH_TABLE(T) union { HashTableDynamicData as_HashTableDynamicData; struct { typeof(T) *value_array; HASH_TABLE_INTERFACE_FIELDS; void (*value_deinit)(typeof(T)*); }; }
 
-typedef ssize_t HashTableIndex;  // Invalidated after hashtable modification
+typedef ssize_t HashTableIndex;  // Invalidated after hashtable modification, including deletion
 
 typedef struct {
 	size_t length;
@@ -21,9 +23,9 @@ typedef struct {
 	uint64_t pre_hash;
 } HashTableKey;
 
+// Slots without an entry have a NULL key
 typedef struct {
 	HashTableKey key;
-	size_t max_collision_offset;
 } HashTableKeyEntry;
 
 typedef struct {
@@ -37,8 +39,19 @@ typedef struct {
 	size_t value_size;
 } HashTableDynamicData;
 
+// Selected with -D HASH_TABLE_HASH=..., the pre-hash is computed by the selected function
+#define HASH_TABLE_HASH_FNV_1A 1
+#define HASH_TABLE_HASH_WYHASH 2
+#ifndef HASH_TABLE_HASH
+#define HASH_TABLE_HASH HASH_TABLE_HASH_WYHASH
+#endif
+
+uint64_t hash_table_hash_fnv_1a(const char *bytes, size_t length);
+uint64_t hash_table_hash_wyhash(const char *bytes, size_t length);  // wyhash final version with the default secret and seed
 HashTableKey hash_table_key_from_bytes(const char *bytes, size_t size);
 HashTableKey hash_table_key_copy(const HashTableKey old);
+// Returns the process-wide copy of the key, allocated in an arena on first use and never freed, the bytes are null-terminated. Inserted string keys are interned, so interning a key that is looked up often makes the comparisons pointer comparisons
+HashTableKey hash_table_key_intern(const HashTableKey key);
 void hash_table_key_deinit_copied(HashTableKey *key);
 bool hash_table_key_equals(const HashTableKey lhs, const HashTableKey rhs);
 
@@ -54,6 +67,10 @@ void hash_table_deinit_impl(HashTableDynamicData * dyndata);
 HashTableIndex hash_table_insert_impl(HashTableDynamicData * dyndata, const HashTableKey key, const void * value_ptr);
 HashTableIndex hash_table_find_impl(const HashTableDynamicData * dyndata, const HashTableKey key);
 bool hash_table_delete_at_index_impl(HashTableDynamicData * dyndata, const HashTableIndex index);
+// Sizes the table once for length entries in total, so that inserting up to that many does not rehash
+bool hash_table_reserve_impl(HashTableDynamicData * dyndata, size_t length);
+// Reserves space for count more entries and inserts them, values_ptr points to count values. Returns the number of successful insertions, later keys overwrite the values of equal earlier ones
+size_t hash_table_insert_bulk_impl(HashTableDynamicData * dyndata, const HashTableKey * keys, const void * values_ptr, size_t count);
 
 __attribute__((unused)) inline static bool
 hash_table_delete_by_key_impl(HashTableDynamicData * dyndata, const HashTableKey key)
@@ -67,5 +84,50 @@ hash_table_delete_by_key_impl(HashTableDynamicData * dyndata, const HashTableKey
 #define hash_table_find(ht, key) hash_table_find_impl(&(ht)->as_HashTableDynamicData, key)
 #define hash_table_delete_at_index(ht, index) hash_table_delete_at_index_impl(&(ht)->as_HashTableDynamicData, index)
 #define hash_table_delete_by_key(ht, key) hash_table_delete_by_key_impl(&(ht)->as_HashTableDynamicData, key)
+#define hash_table_reserve(ht, length) hash_table_reserve_impl(&(ht)->as_HashTableDynamicData, length)
+#define hash_table_insert_bulk(ht, keys, values_ptr, count) hash_table_insert_bulk_impl(&(ht)->as_HashTableDynamicData, keys, IMPLICIT_CAST(const void, const typeof(*(ht)->value_array), values_ptr), count)
+
+// Fixed-width keys stored inline, nothing is allocated per entry
+#define INT_HASH_TABLE_INTERFACE_FIELDS \
+	size_t capacity; \
+	size_t length; \
+	uint64_t *key_array; \
+	uint8_t *control; \
+	size_t growth_left; \
+;
+
+#define TYPED_INT_HASH_TABLE(T) union { IntHashTableDynamicData as_IntHashTableDynamicData; struct { typeof(T) *value_array; INT_HASH_TABLE_INTERFACE_FIELDS; void (*value_deinit)(typeof(T)*); }; }
+
+typedef struct {
+	void *value_array;
+	INT_HASH_TABLE_INTERFACE_FIELDS;
+	void (*value_deinit)(void*);
+	size_t value_size;
+} IntHashTableDynamicData;
+
+__attribute__((unused)) inline static uint64_t
+int_hash_table_key_from_ptr(const void *ptr)
+{
+	return (uintptr_t) ptr;
+}
+
+void int_hash_table_init_impl(IntHashTableDynamicData * dyndata, size_t value_size, void (*value_deinit)(void*));
+void int_hash_table_deinit_impl(IntHashTableDynamicData * dyndata);
+HashTableIndex int_hash_table_insert_impl(IntHashTableDynamicData * dyndata, uint64_t key, const void * value_ptr);
+HashTableIndex int_hash_table_find_impl(const IntHashTableDynamicData * dyndata, uint64_t key);
+bool int_hash_table_delete_at_index_impl(IntHashTableDynamicData * dyndata, const HashTableIndex index);
+
+__attribute__((unused)) inline static bool
+int_hash_table_delete_by_key_impl(IntHashTableDynamicData * dyndata, uint64_t key)
+{
+	return int_hash_table_delete_at_index_impl(dyndata, int_hash_table_find_impl(dyndata, key));
+}
+
+#define int_hash_table_init(ht, value_deinit) int_hash_table_init_impl(&(ht)->as_IntHashTableDynamicData, sizeof(*(ht)->value_array), IMPLICIT_CAST(void(void*), void(typeof((ht)->value_array)), value_deinit))
+#define int_hash_table_deinit(ht) int_hash_table_deinit_impl(&(ht)->as_IntHashTableDynamicData)
+#define int_hash_table_insert(ht, key, value_ptr) int_hash_table_insert_impl(&(ht)->as_IntHashTableDynamicData, key, IMPLICIT_CAST(const void, const typeof(*(ht)->value_array), value_ptr))
+#define int_hash_table_find(ht, key) int_hash_table_find_impl(&(ht)->as_IntHashTableDynamicData, key)
+#define int_hash_table_delete_at_index(ht, index) int_hash_table_delete_at_index_impl(&(ht)->as_IntHashTableDynamicData, index)
+#define int_hash_table_delete_by_key(ht, key) int_hash_table_delete_by_key_impl(&(ht)->as_IntHashTableDynamicData, key)
 
 #endif /* end of include guard: HASH_TABLE_H_ */
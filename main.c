@@ -1,22 +1,596 @@
 #include <getopt.h>
+#include <signal.h>
 #include <stdio.h>
 #include "processing.h"
 #include "hash_table.h"
 #include "module_registry.h"
+#include "analysis.h"
+#include "event_predicate_native.h"
 
 union __attribute__((transparent_union)) option_ident {
 	enum {
 		NCOPT_BASE = 0xFF,
 		NCOPT_MODULE_HELP,
+		NCOPT_ANALYZE,
+		NCOPT_INPUT_RATE,
+		NCOPT_AMPLIFICATION_BUDGET,
+		NCOPT_PROFILE_PREDICATES,
+		NCOPT_NATIVE_PREDICATES,
 	} as_nonchar;
 	int as_int;
 	// No "as_char" field, because it can cause problems on big-endian CPUs
 };
 
+typedef TYPED_HASH_TABLE(size_t) NodeNameRegistry;
+
+// Heap-allocated, because libconfig settings point back to their config_t
+typedef struct {
+	config_t config_tree;
+	FullConfig loaded_config;
+	size_t node_count;
+	GraphNode **nodes;
+	bool *reused;  // Nodes taken over by the next generation of the graph
+	size_t channel_count;
+	GraphChannel *channels;
+	NodeNameRegistry named_nodes;
+	EventPredicateHandle first_predicate;  // Predicates registered by this configuration and its nodes start here
+} LoadedGraph;
+
+static volatile sig_atomic_t reload_requested = 0;
+static volatile sig_atomic_t statistics_requested = 0;
+static volatile sig_atomic_t child_exited = 0;
+static const char *native_predicates_directory = NULL;  // Interpreted if NULL
+
+static void
+handle_reload_signal(int signum)
+{
+	(void) signum;
+	reload_requested = 1;
+}
+
+static void
+handle_statistics_signal(int signum)
+{
+	(void) signum;
+	statistics_requested = 1;
+}
+
+static void
+handle_child_signal(int signum)
+{
+	(void) signum;
+	child_exited = 1;
+}
+
+static const config_setting_t *
+find_predicate_setting(const LoadedGraph * graph, const char * name)
+{
+	const config_setting_t *section = config_setting_get_member(config_root_setting(&graph->config_tree), "predicates");
+	if (!section) {
+		return NULL;
+	}
+	return config_setting_get_member(section, name);
+}
+
+// Named predicates with unchanged definitions keep their handles, so that the flags set by modify_predicate survive
+static void
+adopt_predicate_state(LoadedGraph * previous, LoadedGraph * graph, EventPredicateHandle since)
+{
+	EventPredicateHandleRegistry *registry = &graph->loaded_config.predicates;
+	for (size_t i = 0; i < registry->capacity; ++i) {
+		const char *name = registry->key_array[i].key.bytes;
+		if (!name) {
+			continue;
+		}
+		HashTableIndex k = hash_table_find(&previous->loaded_config.predicates, registry->key_array[i].key);
+		if (k < 0) {
+			continue;
+		}
+		EventPredicateHandle old_handle = previous->loaded_config.predicates.value_array[k];
+		EventPredicateHandle new_handle = registry->value_array[i];
+		if (old_handle == new_handle) {
+			continue;
+		}
+		const config_setting_t *old_setting = find_predicate_setting(previous, name);
+		const config_setting_t *new_setting = find_predicate_setting(graph, name);
+		if (!old_setting || !new_setting) {
+			continue;
+		}
+		if (!config_setting_equivalent(&previous->loaded_config.environment, old_setting, &graph->loaded_config.environment, new_setting)) {
+			continue;
+		}
+		if (!event_predicate_equivalent(old_handle, new_handle, false)) {
+			continue;
+		}
+		registry->value_array[i] = old_handle;
+		event_predicate_replace_references(new_handle, old_handle, since);
+	}
+}
+
+static GraphNode *
+take_over_node(LoadedGraph * previous, LoadedGraph * graph, size_t idx)
+{
+	const GraphNodeConfig *node_config = &graph->loaded_config.nodes.items[idx];
+	if (!previous || !node_config->name) {
+		return NULL;
+	}
+	HashTableIndex k = hash_table_find(&previous->named_nodes, hash_table_key_from_cstr(node_config->name));
+	if (k < 0) {
+		return NULL;
+	}
+	size_t old_idx = previous->named_nodes.value_array[k];
+	if (previous->reused[old_idx]) {
+		return NULL;
+	}
+	const GraphNodeConfig *old_config = &previous->loaded_config.nodes.items[old_idx];
+	if (!old_config->type || strcmp(old_config->type, node_config->type) != 0) {
+		return NULL;
+	}
+	if (!config_setting_equivalent(&previous->loaded_config.environment, old_config->options, &graph->loaded_config.environment, node_config->options)) {
+		return NULL;
+	}
+	previous->reused[old_idx] = true;
+	return previous->nodes[old_idx];
+}
+
+static void
+unload_graph(LoadedGraph * graph, bool delete_nodes)
+{
+	hash_table_deinit(&graph->named_nodes);
+	if (delete_nodes && graph->nodes) {
+		for (ssize_t i = graph->node_count - 1; i >= 0; --i) {
+			if (!graph->reused[i]) {
+				graph_node_delete(graph->nodes[i]);
+			}
+		}
+	}
+	free(graph->channels);
+	free(graph->nodes);
+	free(graph->reused);
+
+	reset_config(&graph->loaded_config);
+	config_destroy(&graph->config_tree);
+	free(graph);
+}
+
+// Reads the configuration and registers its predicates, the nodes are created by create_graph_nodes
+static LoadedGraph *
+read_graph(const char * config_filename, LoadedGraph * previous)
+{
+	LoadedGraph *graph = T_ALLOC(1, LoadedGraph);
+	if (!graph) {
+		perror("Failed to allocate graph");
+		return NULL;
+	}
+
+	config_init(&graph->config_tree);
+	if (config_read_file(&graph->config_tree, config_filename) != CONFIG_TRUE) {
+		fprintf(stderr, "Config syntax error: %s:%d: %s\n", config_error_file(&graph->config_tree), config_error_line(&graph->config_tree), config_error_text(&graph->config_tree));
+		config_destroy(&graph->config_tree);
+		free(graph);
+		return NULL;
+	}
+	config_set_auto_convert(&graph->config_tree, CONFIG_TRUE);
+	graph->first_predicate = event_predicate_count();
+	if (!load_config(config_root_setting(&graph->config_tree), &graph->loaded_config)) {
+		perror("Failed to load config");
+		config_destroy(&graph->config_tree);
+		event_predicate_truncate(graph->first_predicate);
+		free(graph);
+		return NULL;
+	}
+	if (previous) {
+		adopt_predicate_state(previous, graph, graph->first_predicate);
+	}
+	hash_table_init(&graph->named_nodes, NULL);
+	return graph;
+}
+
+// Drops a graph without nodes, like one whose nodes could not be created, and releases its predicates
+static void
+discard_graph(LoadedGraph * graph)
+{
+	EventPredicateHandle first_predicate = graph->first_predicate;
+	unload_graph(graph, false);
+	event_predicate_truncate(first_predicate);
+}
+
+// Creates the nodes that cannot be taken over from previous and resolves the channels, the running graph is kept as it was if this fails
+static bool
+create_graph_nodes(LoadedGraph * graph, LoadedGraph * previous)
+{
+	FullConfig *loaded_config = &graph->loaded_config;
+	graph->node_count = loaded_config->nodes.length;
+	hash_table_reserve(&graph->named_nodes, graph->node_count);
+	graph->nodes = T_ALLOC(graph->node_count, GraphNode*);
+	graph->reused = T_ALLOC(graph->node_count, bool);
+	graph->channel_count = loaded_config->channels.length;
+	graph->channels = T_ALLOC(graph->channel_count, GraphChannel);
+	if ((graph->node_count && (!graph->nodes || !graph->reused)) || (graph->channel_count && !graph->channels)) {
+		perror("Failed to allocate graph");
+		goto fail;
+	}
+
+	bool *owned = T_ALLOC(graph->node_count, bool);
+	bool *suspended = previous ? T_ALLOC(previous->node_count, bool) : NULL;
+	if ((graph->node_count && !owned) || (previous && previous->node_count && !suspended)) {
+		perror("Failed to allocate graph");
+		free(owned);
+		free(suspended);
+		goto fail;
+	}
+	for (size_t i = 0; i < graph->node_count; ++i) {
+		const char* type_name = loaded_config->nodes.items[i].type;
+		if (!type_name) {
+			fprintf(stderr, "No node type for node %ld \"%s\"\n", i, loaded_config->nodes.items[i].name);
+			goto fail_nodes;
+		}
+		if (!lookup_graph_node_specification(type_name)) {
+			fprintf(stderr, "Unknown node type \"%s\" for node %ld \"%s\"\n", type_name, i, loaded_config->nodes.items[i].name);
+			goto fail_nodes;
+		}
+		graph->nodes[i] = take_over_node(previous, graph, i);
+	}
+	// The replaced nodes release their devices first, so that their replacements can open and grab them
+	for (size_t i = 0; previous && i < previous->node_count; ++i) {
+		if (!previous->reused[i]) {
+			graph_node_suspend(previous->nodes[i]);
+			suspended[i] = true;
+		}
+	}
+	for (size_t i = 0; i < graph->node_count; ++i) {
+		if (!graph->nodes[i]) {
+			GraphNodeSpecification *spec = lookup_graph_node_specification(loaded_config->nodes.items[i].type);
+			if (!(graph->nodes[i] = graph_node_new(spec, &loaded_config->nodes.items[i], &loaded_config->environment))) {
+				perror("Failed to create node");
+				fprintf(stderr, "Node %ld \"%s\"\n", i, loaded_config->nodes.items[i].name);
+				goto fail_nodes;
+			}
+			owned[i] = true;
+		}
+		if (loaded_config->nodes.items[i].name) {
+			hash_table_insert(&graph->named_nodes, hash_table_key_from_cstr(loaded_config->nodes.items[i].name), &i);
+		}
+	}
+
+	// Channels are only resolved here, they are attached to the nodes in commit_graph
+	for (size_t i = 0; i < graph->channel_count; ++i) {
+		const char *node_names[2];
+		GraphNode *end_nodes[2] = {NULL, NULL};
+		node_names[0] = loaded_config->channels.items[i].from.name;
+		node_names[1] = loaded_config->channels.items[i].to.name;
+		for (int j = 0; j < 2; ++j) {
+			HashTableIndex k = node_names[j] ? hash_table_find(&graph->named_nodes, hash_table_key_from_cstr(node_names[j])) : -1;
+			if (k < 0) {
+				perror("Errno");
+				fprintf(stderr, "No node named \"%s\"\n", node_names[j]);
+				goto fail_nodes;
+			}
+			end_nodes[j] = graph->nodes[graph->named_nodes.value_array[k]];
+		}
+		graph->channels[i] = (GraphChannel) {
+			.start = end_nodes[0],
+			.end = end_nodes[1],
+			.idx_start = loaded_config->channels.items[i].from.index,
+			.idx_end = loaded_config->channels.items[i].to.index,
+		};
+	}
+
+	free(owned);
+	free(suspended);
+	return true;
+
+fail_nodes:
+	for (ssize_t i = graph->node_count - 1; i >= 0; --i) {
+		if (owned[i]) {
+			graph_node_delete(graph->nodes[i]);
+		}
+	}
+	for (size_t i = 0; previous && i < previous->node_count; ++i) {
+		if (suspended[i] && !graph_node_resume(previous->nodes[i])) {
+			perror("Failed to resume node");
+			fprintf(stderr, "Node %ld \"%s\" of the running graph\n", i, previous->loaded_config.nodes.items[i].name);
+		}
+	}
+	free(owned);
+	free(suspended);
+fail:
+	if (previous) {
+		memset(previous->reused, 0, previous->node_count * sizeof(bool));
+	}
+	graph->node_count = 0;
+	return false;
+}
+
+typedef TYPED_INT_HASH_TABLE(GraphChannel*) PositionReplacementMap;
+
+static void
+insert_position_replacement(PositionReplacementMap * map, const EventPositionBase * position, GraphChannel * replacement)
+{
+	if (int_hash_table_insert(map, int_hash_table_key_from_ptr(position), &replacement) < 0) {
+		perror("Failed to map event positions");
+		exit(1);
+	}
+}
+
+// Events at removed positions are dropped, events in removed channels are redirected to the new channel of the same output connector
+static void
+migrate_events(LoadedGraph * previous)
+{
+	// Positions that go away, mapped to the channel taking over their events or to NULL if the events are dropped
+	PositionReplacementMap replacements;
+	int_hash_table_init(&replacements, NULL);
+	for (size_t i = 0; i < previous->node_count; ++i) {
+		if (!previous->reused[i]) {
+			insert_position_replacement(&replacements, &previous->nodes[i]->as_EventPositionBase, NULL);
+		}
+	}
+	for (size_t i = 0; i < previous->channel_count; ++i) {
+		GraphChannel *old_channel = &previous->channels[i];
+		GraphChannel *replacement = NULL;
+		GraphNode *start = old_channel->start;
+		bool start_reused = start && int_hash_table_find(&replacements, int_hash_table_key_from_ptr(&start->as_EventPositionBase)) < 0;
+		if (start_reused && old_channel->idx_start < start->outputs.length) {
+			replacement = start->outputs.elements[old_channel->idx_start];
+		}
+		insert_position_replacement(&replacements, &old_channel->as_EventPositionBase, replacement);
+	}
+
+	for (EventNode *ev = FIRST_EVENT, *next; ev != &END_EVENTS; ev = next) {
+		next = ev->next;
+		if (!ev->position) {
+			continue;
+		}
+		HashTableIndex k = int_hash_table_find(&replacements, int_hash_table_key_from_ptr(ev->position));
+		if (k < 0) {
+			continue;
+		}
+		GraphChannel *replacement = replacements.value_array[k];
+		if (replacement) {
+			graph_channel_push(replacement, ev);
+		} else {
+			event_destroy(ev);
+		}
+	}
+	int_hash_table_deinit(&replacements);
+}
+
+static void
+print_channel_statistics(FILE * out, const LoadedGraph * graph)
+{
+	const GraphChannelConfigSection *channels = &graph->loaded_config.channels;
+	fprintf(out, "Channel statistics:\n");
+	for (size_t i = 0; i < graph->channel_count; ++i) {
+		const GraphChannel *ch = &graph->channels[i];
+		const GraphChannelConfig *ch_config = &channels->items[i];
+		fprintf(out, "\t%s:%zu -> %s:%zu: length = %zu", ch_config->from.name, ch_config->from.index, ch_config->to.name, ch_config->to.index, ch->length);
+		if (ch->capacity) {
+			fprintf(out, "/%zu", ch->capacity);
+		}
+		fprintf(out, ", high water mark = %zu, dropped = %zu, coalesced = %zu, blocked = %zu\n", ch->statistics.high_water_mark, ch->statistics.dropped, ch->statistics.coalesced, ch->statistics.blocked);
+	}
+}
+
+typedef struct {
+	EventPredicateHandle handle;
+	EventPredicateProfile profile;
+	double cycles;  // Estimated for all evaluations
+} PredicateStatistics;
+
+static int
+compare_predicate_statistics(const void * lhs, const void * rhs)
+{
+	double a = ((const PredicateStatistics*) lhs)->cycles, b = ((const PredicateStatistics*) rhs)->cycles;
+	return (a < b) - (a > b);
+}
+
+// The most expensive predicates first, the ones without a name in the current configuration are shown by handle
+static void
+print_predicate_statistics(FILE * out, const LoadedGraph * graph)
+{
+	EventPredicateHandle count = event_predicate_count();
+	const HashTableKey **names = T_ALLOC(count ? count : 1, const HashTableKey*);
+	PredicateStatistics *statistics = T_ALLOC(count ? count : 1, PredicateStatistics);
+	if (!names || !statistics) {
+		free(names);
+		free(statistics);
+		return;
+	}
+	const EventPredicateHandleRegistry *registry = &graph->loaded_config.predicates;
+	for (size_t i = 0; i < registry->capacity; ++i) {
+		EventPredicateHandle handle = registry->value_array[i];
+		if (registry->key_array[i].key.bytes && handle >= 0 && handle < count) {
+			names[handle] = &registry->key_array[i].key;
+		}
+	}
+	size_t length = 0;
+	for (EventPredicateHandle handle = 0; handle < count; ++handle) {
+		PredicateStatistics *item = &statistics[length];
+		if (!event_predicate_get_profile(handle, &item->profile) || !item->profile.evaluations) {
+			continue;
+		}
+		item->handle = handle;
+		item->cycles = item->profile.samples ? (double) item->profile.sampled_cycles * item->profile.evaluations / item->profile.samples : 0;
+		++length;
+	}
+	qsort(statistics, length, sizeof(PredicateStatistics), &compare_predicate_statistics);
+
+	fprintf(out, "Predicate statistics:\n");
+	for (size_t i = 0; i < length; ++i) {
+		const PredicateStatistics *item = &statistics[i];
+		const HashTableKey *name = names[item->handle];
+		if (name) {
+			fprintf(out, "\t%.*s", (int) name->length, name->bytes);
+		} else {
+			fprintf(out, "\t#%d", (int) item->handle);
+		}
+		fprintf(out, ": evaluations = %llu, accepted = %llu, rejected = %llu, disabled = %llu, cycles = %.0f (%.1f per evaluation)\n",
+			(unsigned long long) item->profile.evaluations, (unsigned long long) item->profile.accepted,
+			(unsigned long long) item->profile.rejected, (unsigned long long) item->profile.disabled,
+			item->cycles, item->cycles / item->profile.evaluations);
+	}
+	free(names);
+	free(statistics);
+}
+
+typedef struct {
+	EventPredicateHandle count;  // Predicates before the compaction
+	bool *used;
+	EventPredicateHandle *renumbered;
+} PredicateCompaction;
+
+static void
+mark_predicate(EventPredicateHandle * handle, void * data)
+{
+	PredicateCompaction *compaction = data;
+	if (*handle >= 0 && *handle < compaction->count) {
+		compaction->used[*handle] = true;
+	}
+}
+
+static void
+renumber_predicate(EventPredicateHandle * handle, void * data)
+{
+	PredicateCompaction *compaction = data;
+	if (*handle >= 0 && *handle < compaction->count) {
+		*handle = compaction->renumbered[*handle];
+	}
+}
+
+// Releases the predicates of the previous configurations that neither the configuration nor the nodes of graph use
+static void
+compact_predicates(LoadedGraph * graph)
+{
+	PredicateCompaction compaction = {
+		.count = event_predicate_count(),
+	};
+	compaction.used = T_ALLOC(compaction.count ? compaction.count : 1, bool);
+	compaction.renumbered = T_ALLOC(compaction.count ? compaction.count : 1, EventPredicateHandle);
+	if (!compaction.used || !compaction.renumbered) {
+		free(compaction.used);
+		free(compaction.renumbered);
+		return;
+	}
+	EventPredicateHandleRegistry *registry = &graph->loaded_config.predicates;
+	for (size_t i = 0; i < registry->capacity; ++i) {
+		if (registry->key_array[i].key.bytes) {
+			mark_predicate(&registry->value_array[i], &compaction);
+		}
+	}
+	for (size_t i = 0; i < graph->node_count; ++i) {
+		graph_node_visit_predicates(graph->nodes[i], &mark_predicate, &compaction);
+	}
+	if (event_predicate_compact(compaction.used, compaction.renumbered)) {
+		for (size_t i = 0; i < registry->capacity; ++i) {
+			if (registry->key_array[i].key.bytes) {
+				renumber_predicate(&registry->value_array[i], &compaction);
+			}
+		}
+		for (size_t i = 0; i < graph->node_count; ++i) {
+			graph_node_visit_predicates(graph->nodes[i], &renumber_predicate, &compaction);
+		}
+		graph->first_predicate = 0;
+	}
+	free(compaction.used);
+	free(compaction.renumbered);
+}
+
+// Replaces previous (if any) with graph, runs between process_iteration calls
+static void
+commit_graph(ProcessingState * state, LoadedGraph * graph, LoadedGraph * previous)
+{
+	if (previous) {
+		for (size_t i = 0; i < previous->node_count; ++i) {
+			if (previous->reused[i]) {
+				GraphNode *node = previous->nodes[i];
+				graph_channel_list_deinit(&node->inputs);
+				graph_channel_list_deinit(&node->outputs);
+				node->blocked_output_count = 0;
+				node->as_EventPositionBase.blocked = false;
+			}
+		}
+	}
+
+	for (size_t i = 0; i < graph->channel_count; ++i) {
+		GraphChannel *ch = &graph->channels[i];
+		graph_channel_init(ch, ch->start, ch->idx_start, ch->end, ch->idx_end);
+		const GraphChannelConfig *ch_config = &graph->loaded_config.channels.items[i];
+		graph_channel_set_capacity(ch, ch_config->capacity, ch_config->overflow);
+	}
+
+	if (previous) {
+		migrate_events(previous);
+		io_subscription_list_clear(&state->wait_input);
+		io_subscription_list_clear(&state->wait_output);
+		for (size_t i = 0; i < previous->node_count; ++i) {
+			if (!previous->reused[i]) {
+				cancel_delays(state, &previous->nodes[i]->as_EventPositionBase);
+			}
+		}
+		unload_graph(previous, true);
+		compact_predicates(graph);
+	}
+
+	event_predicate_fold_constants();
+	event_predicate_compile_all();
+	// Unless the library is cached, the predicates are interpreted until the compiler exits and finish_native_build loads it
+	if (native_predicates_directory && event_predicate_native_load(native_predicates_directory) == EVPRED_NATIVE_FAILED) {
+		fprintf(stderr, "Failed to build native predicates in \"%s\", using the interpreter\n", native_predicates_directory);
+	}
+	for (size_t i = 0; i < graph->node_count; ++i) {
+		graph_node_prepare(graph->nodes[i]);
+		graph_node_register_io(graph->nodes[i], state);
+	}
+}
+
+static void
+finish_native_build()
+{
+	if (native_predicates_directory && event_predicate_native_poll() == EVPRED_NATIVE_FAILED) {
+		fprintf(stderr, "Failed to build native predicates in \"%s\", using the interpreter\n", native_predicates_directory);
+	}
+}
+
+static bool
+analyze_graph(FILE * out, LoadedGraph * graph, const GraphAnalysisParameters * parameters)
+{
+	return graph_analyze(out, &graph->loaded_config, parameters);
+}
+
+static LoadedGraph *
+reload_graph(ProcessingState * state, LoadedGraph * graph, const char * config_filename, const GraphAnalysisParameters * analysis_parameters)
+{
+	LoadedGraph *next = read_graph(config_filename, graph);
+	if (!next) {
+		fprintf(stderr, "Failed to reload \"%s\", keeping the running graph\n", config_filename);
+		return graph;
+	}
+	// Before any node is created, so that a rejected configuration never touches the devices
+	if (analysis_parameters->amplification_budget > 0 && !analyze_graph(stderr, next, analysis_parameters)) {
+		fprintf(stderr, "\"%s\" exceeds the amplification budget, keeping the running graph\n", config_filename);
+		discard_graph(next);
+		return graph;
+	}
+	if (!create_graph_nodes(next, graph)) {
+		fprintf(stderr, "Failed to reload \"%s\", keeping the running graph\n", config_filename);
+		discard_graph(next);
+		return graph;
+	}
+	commit_graph(state, next, graph);
+	return next;
+}
+
 int
 main(int argc, char ** argv)
 {
 	const char* config_filename = "config.cfg";
+	bool analyze = false;
+	bool profile_predicates = false;
+	GraphAnalysisParameters analysis_parameters = {
+		.ttl = DEFAULT_EVENT_TTL,
+		.input_rate = 0,
+		.amplification_budget = 0,
+	};
 
 	while (true) {
 		static const struct option long_options [] = {
@@ -24,6 +598,11 @@ main(int argc, char ** argv)
 			{"help",           no_argument,       NULL, 'h'},
 			{"list-modules",   no_argument,       NULL, 'l'},
 			{"module-help",    required_argument, NULL, NCOPT_MODULE_HELP},
+			{"analyze",        no_argument,       NULL, NCOPT_ANALYZE},
+			{"input-rate",     required_argument, NULL, NCOPT_INPUT_RATE},
+			{"amplification-budget", required_argument, NULL, NCOPT_AMPLIFICATION_BUDGET},
+			{"profile-predicates", no_argument,     NULL, NCOPT_PROFILE_PREDICATES},
+			{"native-predicates", required_argument, NULL, NCOPT_NATIVE_PREDICATES},
 		{NULL, 0, NULL, 0}};
 		static const char help_fstring[] =
 			"Usage: %s <[options...]>\n"
@@ -33,6 +612,16 @@ main(int argc, char ** argv)
 			"\t--help, -h                          show this message\n"
 			"\t--list-modules, -l                  list currently loaded node types\n"
 			"\t--module-help <name>                print help information provided for node type <name>\n"
+			"\t--analyze                           print worst-case event amplification of the configured graph and exit\n"
+			"\t--input-rate <n>                    assume each source reads <n> events per second in --analyze report\n"
+			"\t--amplification-budget <n>          refuse to run or reload if a source event may cause more than <n> node invocations\n"
+			"\t--profile-predicates                count predicate evaluations and their cost, reported on SIGUSR1\n"
+			"\t--native-predicates <directory>     compile predicates to machine code with $CC (cc by default),\n"
+			"\t                                    caching the shared objects in <directory>, the predicates\n"
+			"\t                                    are interpreted while the compiler runs in the background\n"
+			"Signals:\n"
+			"\tSIGHUP                              reload the configuration file, keeping unchanged nodes\n"
+			"\tSIGUSR1                             print channel (and predicate) statistics to stderr\n"
 		;
 
 		union option_ident opt = {.as_int = getopt_long(argc, argv, "c:hl", long_options, NULL)};
@@ -74,6 +663,21 @@ main(int argc, char ** argv)
 				}
 			};
 			return 0;
+		case NCOPT_ANALYZE:
+			analyze = true;
+			break;
+		case NCOPT_INPUT_RATE:
+			analysis_parameters.input_rate = strtod(optarg, NULL);
+			break;
+		case NCOPT_AMPLIFICATION_BUDGET:
+			analysis_parameters.amplification_budget = strtod(optarg, NULL);
+			break;
+		case NCOPT_PROFILE_PREDICATES:
+			profile_predicates = true;
+			break;
+		case NCOPT_NATIVE_PREDICATES:
+			native_predicates_directory = optarg;
+			break;
 		default:
 			fprintf(stderr, "Unexpected option ");
 			if ((unsigned int) opt.as_int <= 0xFF) {
@@ -93,86 +697,81 @@ main(int argc, char ** argv)
 		.wait_delay = NULL,
 		.reached_time = get_current_time(),
 	};
+	sigemptyset(&state.wait_sigmask);
 	io_subscription_list_init(&state.wait_input, 5);
 	io_subscription_list_init(&state.wait_output, 5);
 
-	config_t config_tree;
-	FullConfig loaded_config;
-	config_init(&config_tree);
-	if (config_read_file(&config_tree, config_filename) != CONFIG_TRUE) {
-		fprintf(stderr, "Config syntax error: %s:%d: %s\n", config_error_file(&config_tree), config_error_line(&config_tree), config_error_text(&config_tree));
-		exit(1);
-	}
-	config_set_auto_convert(&config_tree, CONFIG_TRUE);
-	if (!load_config(config_root_setting(&config_tree), &loaded_config)) {
-		perror("Failed to load config");
+	LoadedGraph *graph = read_graph(config_filename, NULL);
+	if (!graph) {
 		exit(1);
 	}
 
-	GraphNode **nodes = T_ALLOC(loaded_config.nodes.length, GraphNode*);
-	TYPED_HASH_TABLE(size_t) named_nodes;
-	hash_table_init(&named_nodes, NULL);
-	for (size_t i = 0; i < loaded_config.nodes.length; ++i) {
-		const char* type_name = loaded_config.nodes.items[i].type;
-		if (!type_name) {
-			fprintf(stderr, "No node type for node %ld \"%s\"\n", i, loaded_config.nodes.items[i].name);
-			exit(1);
-		}
-		GraphNodeSpecification *spec = lookup_graph_node_specification(type_name);
-		if (!spec) {
-			fprintf(stderr, "Unknown node type \"%s\" for node %ld \"%s\"\n", type_name, i, loaded_config.nodes.items[i].name);
-			exit(1);
-		}
-		if (!(nodes[i] = graph_node_new(spec, &loaded_config.nodes.items[i], &loaded_config.environment))) {
-			perror("Failed to create node");
-			fprintf(stderr, "Node %ld \"%s\"\n", i, loaded_config.nodes.items[i].name);
-			exit(1);
-		}
-		if (loaded_config.nodes.items[i].name) {
-			hash_table_insert(&named_nodes, hash_table_key_from_cstr(loaded_config.nodes.items[i].name), &i);
+	// Before the nodes are created, so that a report does not open any devices
+	if (analyze || analysis_parameters.amplification_budget > 0) {
+		bool within_budget = analyze_graph(analyze ? stdout : stderr, graph, &analysis_parameters);
+		if (analyze || !within_budget) {
+			discard_graph(graph);
+			event_destroy_all();
+			event_predicate_reset();
+			io_subscription_list_deinit(&state.wait_output);
+			io_subscription_list_deinit(&state.wait_input);
+			return within_budget ? 0 : 1;
 		}
 	}
-
-	GraphChannel *channels = T_ALLOC(loaded_config.channels.length, GraphChannel);
-	for (size_t i = 0; i < loaded_config.channels.length; ++i) {
-		const char *node_names[2];
-		GraphNode *end_nodes[2] = {NULL, NULL};
-		node_names[0] = loaded_config.channels.items[i].from.name;
-		node_names[1] = loaded_config.channels.items[i].to.name;
-		for (int j = 0; j < 2; ++j) {
-			HashTableIndex k = hash_table_find(&named_nodes, hash_table_key_from_cstr(node_names[j]));
-			if (k < 0) {
-				perror("Errno");
-				fprintf(stderr, "No node named \"%s\"\n", node_names[j]);
-				exit(1);
-			}
-			end_nodes[j] = nodes[named_nodes.value_array[k]];
-		}
-		graph_channel_init(&channels[i],
-			end_nodes[0], loaded_config.channels.items[i].from.index,
-			end_nodes[1], loaded_config.channels.items[i].to.index
-		);
+	if (!create_graph_nodes(graph, NULL)) {
+		exit(1);
 	}
 
-	for (size_t i = 0; i < loaded_config.nodes.length; ++i) {
-		graph_node_register_io(nodes[i], &state);
-	}
+	// The requests are only delivered while process_io waits, so they are never missed between checking the flags and waiting. Before the first commit, which may start a native build
+	sigset_t handled_signals;
+	sigemptyset(&handled_signals);
+	sigaddset(&handled_signals, SIGHUP);
+	sigaddset(&handled_signals, SIGUSR1);
+	sigaddset(&handled_signals, SIGCHLD);
+	sigprocmask(SIG_BLOCK, &handled_signals, &state.wait_sigmask);
+	struct sigaction reload_action = {
+		.sa_handler = &handle_reload_signal,
+	};
+	sigemptyset(&reload_action.sa_mask);
+	sigaction(SIGHUP, &reload_action, NULL);
+	struct sigaction statistics_action = {
+		.sa_handler = &handle_statistics_signal,
+	};
+	sigemptyset(&statistics_action.sa_mask);
+	sigaction(SIGUSR1, &statistics_action, NULL);
+	struct sigaction child_action = {
+		.sa_handler = &handle_child_signal,
+		.sa_flags = SA_NOCLDSTOP,
+	};
+	sigemptyset(&child_action.sa_mask);
+	sigaction(SIGCHLD, &child_action, NULL);
+
+	commit_graph(&state, graph, NULL);
+	event_predicate_set_profiling(profile_predicates);
 
 	while (true) {
+		if (reload_requested) {
+			reload_requested = 0;
+			graph = reload_graph(&state, graph, config_filename, &analysis_parameters);
+		}
+		if (child_exited) {
+			child_exited = 0;
+			finish_native_build();
+		}
+		if (statistics_requested) {
+			statistics_requested = 0;
+			print_channel_statistics(stderr, graph);
+			if (profile_predicates) {
+				print_predicate_statistics(stderr, graph);
+			}
+		}
 		process_iteration(&state);
 	}
 
-	hash_table_deinit(&named_nodes);
-	for (ssize_t i = loaded_config.nodes.length - 1; i >= 0; --i) {
-		graph_node_delete(nodes[i]);
-	}
+	unload_graph(graph, true);
 	event_destroy_all();
-	free(channels);
-	free(nodes);
-
-	reset_config(&loaded_config);
+	event_predicate_native_unload();
 	event_predicate_reset();
-	config_destroy(&config_tree);
 
 	io_subscription_list_deinit(&state.wait_output);
 	io_subscription_list_deinit(&state.wait_input);
@@ -119,6 +119,44 @@ modifier_set_has(ModifierSet collection, Modifier element)
 	return (collection.bits[byte_index] & mask) != 0;
 }
 
+// Eight bytes starting at byte_index, the missing ones are zero
+__attribute__((unused)) inline static uint64_t
+modifier_set_word(const ModifierSet collection, size_t byte_index)
+{
+	uint64_t word = 0;
+	if (byte_index + sizeof(word) <= collection.byte_length) {
+		memcpy(&word, collection.bits + byte_index, sizeof(word));
+	} else if (byte_index < collection.byte_length) {
+		memcpy(&word, collection.bits + byte_index, collection.byte_length - byte_index);
+	}
+	return word;
+}
+
+// Whether the collection has all of required, none of forbidden and, unless any is empty, at least one of any
+__attribute__((unused)) inline static bool
+modifier_set_matches_mask(const ModifierSet collection, const ModifierSet required, const ModifierSet forbidden, const ModifierSet any)
+{
+	size_t length = required.byte_length;
+	if (forbidden.byte_length > length) {
+		length = forbidden.byte_length;
+	}
+	if (any.byte_length > length) {
+		length = any.byte_length;
+	}
+	uint64_t any_bits = 0, any_found = 0;
+	for (size_t i = 0; i < length; i += sizeof(uint64_t)) {
+		uint64_t word = modifier_set_word(collection, i);
+		uint64_t required_word = modifier_set_word(required, i);
+		if ((word & required_word) != required_word || (word & modifier_set_word(forbidden, i))) {
+			return false;
+		}
+		uint64_t any_word = modifier_set_word(any, i);
+		any_bits |= any_word;
+		any_found |= word & any_word;
+	}
+	return !any_bits || any_found;
+}
+
 __attribute__((unused)) inline static void
 modifier_set_set(ModifierSet * target, Modifier element)
 {
@@ -3,6 +3,19 @@
 static GraphNodeSpecificationRegistry registry;
 static bool initialized = false;
 
+// Registered by the module constructors and inserted at once on the first use of the registry
+static struct {
+	size_t length;
+	size_t capacity;
+	HashTableKey *names;
+	GraphNodeSpecification **specs;
+} pending = {
+	.length = 0,
+	.capacity = 0,
+	.names = NULL,
+	.specs = NULL,
+};
+
 static void
 ensure_initialized()
 {
@@ -10,16 +23,38 @@ ensure_initialized()
 		hash_table_init(&registry, NULL);
 		initialized = true;
 	}
+	if (pending.length) {
+		hash_table_insert_bulk(&registry, pending.names, pending.specs, pending.length);
+		pending.length = 0;
+	}
 }
 
 void
 register_graph_node_specification(GraphNodeSpecification * spec)
 {
-	ensure_initialized();
 	if (!spec->name) {
 		return;
 	}
-	hash_table_insert(&registry, hash_table_key_from_cstr(spec->name), &spec);
+	if (pending.length == pending.capacity) {
+		size_t capacity = pending.capacity * 2 + 16;
+		HashTableKey *names = T_REALLOC(pending.names, capacity, HashTableKey);
+		if (names) {
+			pending.names = names;
+		}
+		GraphNodeSpecification **specs = T_REALLOC(pending.specs, capacity, GraphNodeSpecification*);
+		if (specs) {
+			pending.specs = specs;
+		}
+		if (!names || !specs) {
+			ensure_initialized();
+			hash_table_insert(&registry, hash_table_key_from_cstr(spec->name), &spec);
+			return;
+		}
+		pending.capacity = capacity;
+	}
+	pending.names[pending.length] = hash_table_key_from_cstr(spec->name);
+	pending.specs[pending.length] = spec;
+	++pending.length;
 }
 
 GraphNodeSpecification *
@@ -46,4 +81,9 @@ destroy_graph_node_specification_registry()
 	ensure_initialized();
 	hash_table_deinit(&registry);
 	initialized = false;
+	free(pending.names);
+	free(pending.specs);
+	pending.names = NULL;
+	pending.specs = NULL;
+	pending.capacity = 0;
 }
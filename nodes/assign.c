@@ -10,27 +10,40 @@ typedef struct {
 static bool
 handle_event(EventPositionBase * self, EventNode * event)
 {
-	AssignGraphNode *node = DOWNCAST(AssignGraphNode, GraphNode, DOWNCAST(GraphNode, EventPositionBase, self));
-	size_t count = node->as_GraphNode.outputs.length;
-	if (!count) {
-		event_destroy(event);
+	GraphNode *node = DOWNCAST(GraphNode, EventPositionBase, self);
+	return node->specification->handle_events(node->specification, node, &event, 1);
+}
+
+static bool
+handle_events(GraphNodeSpecification * self, GraphNode * target, EventNode ** events, size_t count)
+{
+	(void) self;
+	AssignGraphNode *node = DOWNCAST(AssignGraphNode, GraphNode, target);
+	if (!target->outputs.length) {
+		for (size_t i = 0; i < count; ++i) {
+			event_destroy(events[i]);
+		}
 		return true;
 	}
 
-	if (node->has_ns) {
-		event->data.code.ns = node->source.code.ns;
-	}
-	if (node->has_maj) {
-		event->data.code.major = node->source.code.major;
-	}
-	if (node->has_min) {
-		event->data.code.minor = node->source.code.minor;
-	}
-	if (node->has_payload) {
-		event->data.payload = node->source.payload;
-	}
+	const EventData source = node->source;
+	for (size_t i = 0; i < count; ++i) {
+		EventNode *event = events[i];
+		if (node->has_ns) {
+			event->data.code.ns = source.code.ns;
+		}
+		if (node->has_maj) {
+			event->data.code.major = source.code.major;
+		}
+		if (node->has_min) {
+			event->data.code.minor = source.code.minor;
+		}
+		if (node->has_payload) {
+			event->data.payload = source.payload;
+		}
 
-	graph_node_broadcast_forward_event(&node->as_GraphNode, event);
+		graph_node_broadcast_forward_event(target, event);
+	}
 	return true;
 }
 
@@ -111,6 +124,7 @@ GraphNodeSpecification nodespec_assign = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.handle_events = &handle_events,
 	.name = "assign",
 	.documentation = "Assigns field(s) in an event\nAccepts events on any connector\nSends events on all connectors"
 	                 "\nOption 'namespace' (optional): new event code namespace"
@@ -9,18 +9,32 @@ typedef struct {
 static bool
 handle_event(EventPositionBase * self, EventNode * event)
 {
-	DifferentiateGraphNode *node = DOWNCAST(DifferentiateGraphNode, GraphNode, DOWNCAST(GraphNode, EventPositionBase, self));
-	size_t count = node->as_GraphNode.outputs.length;
-	if (!count) {
-		event_destroy(event);
+	GraphNode *node = DOWNCAST(GraphNode, EventPositionBase, self);
+	return node->specification->handle_events(node->specification, node, &event, 1);
+}
+
+static bool
+handle_events(GraphNodeSpecification * self, GraphNode * target, EventNode ** events, size_t count)
+{
+	(void) self;
+	DifferentiateGraphNode *node = DOWNCAST(DifferentiateGraphNode, GraphNode, target);
+	if (!target->outputs.length) {
+		for (size_t i = 0; i < count; ++i) {
+			event_destroy(events[i]);
+		}
 		return true;
 	}
 
-	int64_t current = event->data.payload;
-	event->data.payload = current - node->previous;
-	node->previous = current;
+	int64_t previous = node->previous;
+	for (size_t i = 0; i < count; ++i) {
+		EventNode *event = events[i];
+		int64_t current = event->data.payload;
+		event->data.payload = current - previous;
+		previous = current;
 
-	graph_node_broadcast_forward_event(&node->as_GraphNode, event);
+		graph_node_broadcast_forward_event(target, event);
+	}
+	node->previous = previous;
 	return true;
 }
 
@@ -65,6 +79,7 @@ GraphNodeSpecification nodespec_differentiate = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.handle_events = &handle_events,
 	.name = "differentiate",
 	.documentation = "Subtracts the previous event payload from the current one\nAccepts events on any connector\nSends events on all connectors"
 	                 "\nOption 'initial' (optional): the value to subtract from the first event payload"
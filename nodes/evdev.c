@@ -15,6 +15,7 @@ typedef struct {
 	struct libevdev *dev;
 	int fd;
 	int namespace;
+	bool grabbed;
 } EvdevGraphNode;
 
 static void
@@ -51,7 +52,7 @@ handle_io(EventPositionBase * self, int fd, bool is_output)
 				.major = buf.type,
 				.minor = buf.code,
 			},
-			.ttl = 100,
+			.ttl = DEFAULT_EVENT_TTL,
 			.priority = 10,
 			.payload = buf.value,
 			.modifiers = EMPTY_MODIFIER_SET,
@@ -63,7 +64,7 @@ handle_io(EventPositionBase * self, int fd, bool is_output)
 				perror("Failed to create event");
 				break;
 			}
-			ev->position = &node->as_GraphNode.outputs.elements[i]->as_EventPositionBase;
+			graph_channel_push(node->as_GraphNode.outputs.elements[i], ev);
 		}
 	}
 }
@@ -119,6 +120,7 @@ create(GraphNodeSpecification * spec, GraphNodeConfig * config, InitializationEn
 		.dev = node->dev,
 		.fd = fd,
 		.namespace = node->namespace,
+		.grabbed = should_grab,
 	};
 	return &node->as_GraphNode;
 }
@@ -136,6 +138,30 @@ static void destroy
 	free(target);
 }
 
+// Keeps the descriptor, so that the subscription stays valid, another node may grab the device meanwhile
+static void
+suspend(GraphNodeSpecification * self, GraphNode * target)
+{
+	(void) self;
+	EvdevGraphNode * node = DOWNCAST(EvdevGraphNode, GraphNode, target);
+	if (node->grabbed) {
+		libevdev_grab(node->dev, LIBEVDEV_UNGRAB);
+	}
+}
+
+static bool
+resume(GraphNodeSpecification * self, GraphNode * target)
+{
+	(void) self;
+	EvdevGraphNode * node = DOWNCAST(EvdevGraphNode, GraphNode, target);
+	int err;
+	if (node->grabbed && (err = libevdev_grab(node->dev, LIBEVDEV_GRAB)) < 0) {
+		errno = -err;
+		return false;
+	}
+	return true;
+}
+
 static void
 register_io(GraphNodeSpecification * self, GraphNode * target, ProcessingState * state)
 {
@@ -148,12 +174,15 @@ GraphNodeSpecification nodespec_evdev = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = &register_io,
+	.suspend = &suspend,
+	.resume = &resume,
 	.name = "evdev",
 	.documentation = "Reads evdev events of the specified device\nDoes not accept events\nSends events on all connectors with major code, minor code, payload respectively set to evdev event type, code, value"
 	                 "\nOption 'namespace' (optional): set namespace for the generated events"
 	                 "\nOption 'file' (required): device file to read events from (like '/dev/input/eventN'), the process must have sufficient privileges to read the file"
 	                 "\nOption 'grab' (optional): whether to prevent others from receiving events from this device"
 	,
+	.is_source = true,
 };
 
 MODULE_CONSTRUCTOR(init)
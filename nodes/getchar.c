@@ -27,7 +27,7 @@ handle_io(EventPositionBase * self, int fd, bool is_output)
 			.major = 0,
 			.minor = 1,
 		},
-		.ttl = 100,
+		.ttl = DEFAULT_EVENT_TTL,
 		.priority = 10,
 		.payload = (unsigned char) buf[0],
 		.modifiers = EMPTY_MODIFIER_SET,
@@ -44,7 +44,7 @@ handle_io(EventPositionBase * self, int fd, bool is_output)
 			perror("Failed to create event");
 			break;
 		}
-		ev->position = &node->as_GraphNode.outputs.elements[i]->as_EventPositionBase;
+		graph_channel_push(node->as_GraphNode.outputs.elements[i], ev);
 	}
 }
 
@@ -98,6 +98,7 @@ GraphNodeSpecification nodespec_getchar = (GraphNodeSpecification) {
 	.documentation = "Converts stdin bytes to events\nDoes not accept events\nSends events on all connectors with major and minor codes (0, 1) and the read byte as payload"
 	                 "\nOption 'namespace' (optional): set namespace for the generated events"
 	,
+	.is_source = true,
 };
 
 MODULE_CONSTRUCTOR(init)
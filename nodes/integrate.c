@@ -9,19 +9,31 @@ typedef struct {
 static bool
 handle_event(EventPositionBase * self, EventNode * event)
 {
-	IntegrateGraphNode *node = DOWNCAST(IntegrateGraphNode, GraphNode, DOWNCAST(GraphNode, EventPositionBase, self));
-	size_t count = node->as_GraphNode.outputs.length;
-	if (!count) {
-		event_destroy(event);
+	GraphNode *node = DOWNCAST(GraphNode, EventPositionBase, self);
+	return node->specification->handle_events(node->specification, node, &event, 1);
+}
+
+static bool
+handle_events(GraphNodeSpecification * self, GraphNode * target, EventNode ** events, size_t count)
+{
+	(void) self;
+	IntegrateGraphNode *node = DOWNCAST(IntegrateGraphNode, GraphNode, target);
+	if (!target->outputs.length) {
+		for (size_t i = 0; i < count; ++i) {
+			event_destroy(events[i]);
+		}
 		return true;
 	}
 
 	int64_t total = node->total;
-	total += event->data.payload;
-	event->data.payload = total;
-	node->total = total;
+	for (size_t i = 0; i < count; ++i) {
+		EventNode *event = events[i];
+		total += event->data.payload;
+		event->data.payload = total;
 
-	graph_node_broadcast_forward_event(&node->as_GraphNode, event);
+		graph_node_broadcast_forward_event(target, event);
+	}
+	node->total = total;
 	return true;
 }
 
@@ -66,6 +78,7 @@ GraphNodeSpecification nodespec_integrate = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.handle_events = &handle_events,
 	.name = "integrate",
 	.documentation = "Calculates a running sum of previous event payloads and replaces with it the current one\nAccepts events on any connector\nSends events on all connectors"
 	                 "\nOption 'initial' (optional): the initial partial sum value"
@@ -10,14 +10,25 @@ typedef struct {
 static bool
 handle_event(EventPositionBase * self, EventNode * event)
 {
-	ModifiersGraphNode *node = DOWNCAST(ModifiersGraphNode, GraphNode, DOWNCAST(GraphNode, EventPositionBase, self));
-	size_t count = node->as_GraphNode.outputs.length;
-	if (!count) {
-		event_destroy(event);
+	GraphNode *node = DOWNCAST(GraphNode, EventPositionBase, self);
+	return node->specification->handle_events(node->specification, node, &event, 1);
+}
+
+static bool
+handle_events(GraphNodeSpecification * self, GraphNode * target, EventNode ** events, size_t count)
+{
+	(void) self;
+	ModifiersGraphNode *node = DOWNCAST(ModifiersGraphNode, GraphNode, target);
+	if (!target->outputs.length) {
+		for (size_t i = 0; i < count; ++i) {
+			event_destroy(events[i]);
+		}
 		return true;
 	}
-	modifier_set_operation_from(&event->data.modifiers, node->modifiers, node->operation);
-	graph_node_broadcast_forward_event(&node->as_GraphNode, event);
+	for (size_t i = 0; i < count; ++i) {
+		modifier_set_operation_from(&events[i]->data.modifiers, node->modifiers, node->operation);
+		graph_node_broadcast_forward_event(target, events[i]);
+	}
 	return true;
 }
 
@@ -86,6 +97,7 @@ GraphNodeSpecification nodespec_modifiers = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.handle_events = &handle_events,
 	.name = "modifiers",
 	.documentation = "Sets/unsets/toggles modifiers in an event\nAccepts events on any connector\nSends events on all connectors"
 	                 "\nOption 'operation' (required): the operation to apply to the event modifier set ('set'/'unset'/'toggle')"
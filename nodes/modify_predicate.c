@@ -64,6 +64,7 @@ create(GraphNodeSpecification * spec, GraphNodeConfig * config, InitializationEn
 		free(node);
 		return NULL;
 	}
+	event_predicate_mark_mutable(target);
 
 	*node = (ModifyPredicateGraphNode) {
 		.as_GraphNode = {
@@ -84,6 +85,18 @@ create(GraphNodeSpecification * spec, GraphNodeConfig * config, InitializationEn
 	return &node->as_GraphNode;
 }
 
+static void
+visit_predicates(GraphNodeSpecification * self, GraphNode * target, GraphNodePredicateVisitor visit, void * data)
+{
+	(void) self;
+	ModifyPredicateGraphNode *node = DOWNCAST(ModifyPredicateGraphNode, GraphNode, target);
+	visit(&node->target, data);
+	visit(&node->enable_on, data);
+	visit(&node->disable_on, data);
+	visit(&node->invert_on, data);
+	visit(&node->uninvert_on, data);
+}
+
 static void destroy
 (GraphNodeSpecification * self, GraphNode * target)
 {
@@ -95,6 +108,7 @@ GraphNodeSpecification nodespec_modify_predicate = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.visit_predicates = &visit_predicates,
 	.name = "modify_predicate",
 	.documentation = "Changes 'enabled' and 'inverted' flags of a predicate\nAccepts events on any connector\nDoes not send events"
 	                 "\nOption 'target' (required): the predicate to modify"
@@ -2,11 +2,10 @@
 #include "print.h"
 #include "../module_registry.h"
 
-static bool
-handle_event(EventPositionBase * self, EventNode * event)
+static void
+print_event(EventNode * event)
 {
 #define PRINT_FIELD(fmt, path) printf("%s = " fmt "\n", #path, data.path)
-	(void) self;
 	EventData data = event->data;
 	printf("Event from connector %ld:\n", event->input_index);
 	PRINT_FIELD("%d", code.ns);
@@ -23,10 +22,30 @@ handle_event(EventPositionBase * self, EventNode * event)
 	printf("time.absolute = %ld.%09ld\n", data.time.absolute.tv_sec, data.time.absolute.tv_nsec);
 	printf("---\n\n");
 	event_destroy(event);
-	return true;
 #undef PRINT_FIELD
 }
 
+static bool
+handle_event(EventPositionBase * self, EventNode * event)
+{
+	(void) self;
+	print_event(event);
+	return true;
+}
+
+static bool
+handle_events(GraphNodeSpecification * self, GraphNode * target, EventNode ** events, size_t count)
+{
+	(void) self;
+	(void) target;
+	flockfile(stdout);  // Lock once per batch instead of once per printf
+	for (size_t i = 0; i < count; ++i) {
+		print_event(events[i]);
+	}
+	funlockfile(stdout);
+	return true;
+}
+
 static GraphNode *
 create(GraphNodeSpecification * spec, GraphNodeConfig * config, InitializationEnvironment * env)
 {
@@ -59,6 +78,7 @@ GraphNodeSpecification nodespec_print = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.handle_events = &handle_events,
 	.name = "print",
 	.documentation = "Prints received events\nAccepts events on any connector\nDoes not send events"
 	,
@@ -1,10 +1,35 @@
 #include "../graph.h"
 #include "../module_registry.h"
+#include "../event_predicate_index.h"
+#include "../event_predicate_kernels.h"
+
+typedef enum {
+	ROUTE_EVALUATE,
+	ROUTE_ALWAYS,
+	ROUTE_NEVER,
+} RouterRoute;
+
+// Updates the route of a mutable predicate when its flags change
+typedef struct {
+	EventPredicateDependent as_EventPredicateDependent;
+	GraphNode *node;
+	size_t output;
+	bool added;
+} RouterRouteDependent;
 
 typedef struct {
 	GraphNode as_GraphNode;
 	size_t length;
 	EventPredicateHandle * predicates;
+	RouterRoute * routes;  // Constant predicate results, filled by prepare
+	RouterRouteDependent * dependents;
+	size_t evaluate_count;  // Number of routes of each kind
+	size_t always_count;
+	size_t always_sum;  // Sum of the ROUTE_ALWAYS outputs, the only one if always_count is 1
+	uint64_t * accepted;  // Accepted events of a batch for each output
+	ssize_t direct_output;  // The only output if the predicates are constant and accept on a single connector
+	bool indexed;
+	EventPredicateIndex index;  // Outputs by event code and payload, filled by prepare
 } RouterGraphNode;
 
 static bool
@@ -15,16 +40,115 @@ handle_event(EventPositionBase * self, EventNode * event)
 		if ((size_t) i >= node->as_GraphNode.outputs.length) {
 			continue;
 		}
-		if (event_predicate_apply(node->predicates[i], event) == EVPREDRES_ACCEPTED) {
-			if (event_replicate(event, 1)) {
-				EventNode * replica = event->next;
-				replica->position = &node->as_GraphNode.outputs.elements[i]->as_EventPositionBase;
-				if (!replica->position) {
-					event_destroy(replica);
+		switch (node->routes ? node->routes[i] : ROUTE_EVALUATE) {
+		case ROUTE_EVALUATE:
+			if (event_predicate_apply(node->predicates[i], event) != EVPREDRES_ACCEPTED) {
+				continue;
+			}
+			break;
+		case ROUTE_ALWAYS:
+			break;
+		case ROUTE_NEVER:
+			continue;
+		}
+		if (event_replicate(event, 1)) {
+			EventNode * replica = event->next;
+			graph_channel_push(node->as_GraphNode.outputs.elements[i], replica);
+		}
+	}
+	event_destroy(event);
+	return true;
+}
+
+// Evaluates each predicate for the whole batch, the replicas are created in the same order as by handle_event
+static bool
+handle_events(GraphNodeSpecification * self, GraphNode * target, EventNode ** events, size_t count)
+{
+	(void) self;
+	RouterGraphNode *node = DOWNCAST(RouterGraphNode, GraphNode, target);
+	EventPositionBase *position = &target->as_EventPositionBase;
+	if (position->handle_event != &handle_event || !node->routes || !node->accepted || count <= 1) {
+		for (size_t i = 0; i < count; ++i) {
+			position->handle_event(position, events[i]);
+		}
+		return true;
+	}
+
+	for (size_t start = 0; start < count; start += EVPRED_BATCH_LANES) {
+		size_t lanes = count - start < EVPRED_BATCH_LANES ? count - start : EVPRED_BATCH_LANES;
+		for (size_t i = 0; i < node->length; ++i) {
+			switch (node->routes[i]) {
+			case ROUTE_EVALUATE:
+				event_predicate_apply_batch(node->predicates[i], events + start, lanes, &node->accepted[i]);
+				break;
+			case ROUTE_ALWAYS:
+				node->accepted[i] = UINT64_MAX;
+				break;
+			case ROUTE_NEVER:
+				node->accepted[i] = 0;
+				break;
+			}
+		}
+		for (size_t lane = 0; lane < lanes; ++lane) {
+			EventNode *event = events[start + lane];
+			for (ssize_t i = node->length - 1; i >= 0; --i) {
+				if ((size_t) i >= target->outputs.length || !(node->accepted[i] >> lane & 1)) {
+					continue;
+				}
+				if (event_replicate(event, 1)) {
+					EventNode * replica = event->next;
+					graph_channel_push(target->outputs.elements[i], replica);
 				}
 			}
+			event_destroy(event);
 		}
 	}
+	return true;
+}
+
+static bool
+handle_event_indexed(EventPositionBase * self, EventNode * event)
+{
+	RouterGraphNode *node = DOWNCAST(RouterGraphNode, GraphNode, DOWNCAST(GraphNode, EventPositionBase, self));
+	size_t count;
+	const uint32_t *candidates = event_predicate_index_candidates(&node->index, event, &count);
+	for (size_t j = 0; j < count; ++j) {
+		size_t i = candidates[j];
+		if (i >= node->as_GraphNode.outputs.length) {
+			continue;
+		}
+		switch (node->routes[i]) {
+		case ROUTE_EVALUATE:
+			if (!event_predicate_index_accepts(&node->index, i, event)) {
+				continue;
+			}
+			break;
+		case ROUTE_ALWAYS:
+			break;
+		case ROUTE_NEVER:
+			continue;
+		}
+		if (event_replicate(event, 1)) {
+			EventNode * replica = event->next;
+			graph_channel_push(node->as_GraphNode.outputs.elements[i], replica);
+		}
+	}
+	event_destroy(event);
+	return true;
+}
+
+static bool
+handle_event_direct(EventPositionBase * self, EventNode * event)
+{
+	RouterGraphNode *node = DOWNCAST(RouterGraphNode, GraphNode, DOWNCAST(GraphNode, EventPositionBase, self));
+	graph_channel_push(node->as_GraphNode.outputs.elements[node->direct_output], event);
+	return true;
+}
+
+static bool
+handle_event_drop(EventPositionBase * self, EventNode * event)
+{
+	(void) self;
 	event_destroy(event);
 	return true;
 }
@@ -72,20 +196,196 @@ create(GraphNodeSpecification * spec, GraphNodeConfig * config, InitializationEn
 		},
 		.length = length,
 		.predicates = predicates,
+		.routes = NULL,
+		.dependents = NULL,
+		.accepted = NULL,
+		.direct_output = -1,
+		.indexed = false,
 	};
 	return &node->as_GraphNode;
 }
 
+static RouterRoute
+current_route(RouterGraphNode * node, size_t i)
+{
+	EventPredicateResult result;
+	if (i >= node->as_GraphNode.outputs.length || !node->as_GraphNode.outputs.elements[i]) {
+		return ROUTE_NEVER;
+	}
+	if (!event_predicate_current_result(node->predicates[i], &result)) {
+		return ROUTE_EVALUATE;
+	}
+	return result == EVPREDRES_ACCEPTED ? ROUTE_ALWAYS : ROUTE_NEVER;
+}
+
+static void
+set_route(RouterGraphNode * node, size_t i, RouterRoute route)
+{
+	switch (node->routes[i]) {
+	case ROUTE_EVALUATE:
+		--node->evaluate_count;
+		break;
+	case ROUTE_ALWAYS:
+		--node->always_count;
+		node->always_sum -= i;
+		break;
+	case ROUTE_NEVER:
+		break;
+	}
+	node->routes[i] = route;
+	switch (route) {
+	case ROUTE_EVALUATE:
+		++node->evaluate_count;
+		break;
+	case ROUTE_ALWAYS:
+		++node->always_count;
+		node->always_sum += i;
+		break;
+	case ROUTE_NEVER:
+		break;
+	}
+}
+
+// Constant routes become direct channels or drops
+static void
+select_handler(RouterGraphNode * node)
+{
+	EventPositionBase *position = &node->as_GraphNode.as_EventPositionBase;
+	node->direct_output = -1;
+	if (node->evaluate_count) {
+		position->handle_event = node->indexed ? &handle_event_indexed : &handle_event;
+	} else if (node->always_count == 1) {
+		node->direct_output = node->always_sum;
+		position->handle_event = &handle_event_direct;
+	} else if (!node->always_count) {
+		position->handle_event = &handle_event_drop;
+	} else {
+		position->handle_event = &handle_event;
+	}
+}
+
+static void
+route_flags_changed(EventPredicateDependent * self, EventPredicateHandle handle)
+{
+	(void) handle;
+	RouterRouteDependent *dependent = DOWNCAST(RouterRouteDependent, EventPredicateDependent, self);
+	RouterGraphNode *node = DOWNCAST(RouterGraphNode, GraphNode, dependent->node);
+	set_route(node, dependent->output, current_route(node, dependent->output));
+	select_handler(node);
+}
+
+static void
+remove_dependents(RouterGraphNode * node)
+{
+	if (!node->dependents) {
+		return;
+	}
+	for (size_t i = 0; i < node->length; ++i) {
+		if (node->dependents[i].added) {
+			event_predicate_remove_dependent(node->predicates[i], &node->dependents[i].as_EventPredicateDependent);
+			node->dependents[i].added = false;
+		}
+	}
+}
+
+// Mutable predicates are watched, so that a flag change only updates their own routes
+static void
+prepare(GraphNodeSpecification * self, GraphNode * target)
+{
+	(void) self;
+	RouterGraphNode * node = DOWNCAST(RouterGraphNode, GraphNode, target);
+	target->as_EventPositionBase.handle_event = &handle_event;
+	node->direct_output = -1;
+	remove_dependents(node);
+	if (node->indexed) {
+		event_predicate_index_destroy(&node->index);
+		node->indexed = false;
+	}
+	if (!node->length) {
+		target->as_EventPositionBase.handle_event = &handle_event_drop;
+		return;
+	}
+	if (!node->routes && !(node->routes = T_ALLOC(node->length, RouterRoute))) {
+		return;
+	}
+	if (!node->dependents && !(node->dependents = T_ALLOC(node->length, RouterRouteDependent))) {
+		free(node->routes);
+		node->routes = NULL;
+		return;
+	}
+	if (!node->accepted) {
+		node->accepted = T_ALLOC(node->length, uint64_t);
+	}
+
+	bool all_constant = true;
+	node->evaluate_count = 0;
+	node->always_count = 0;
+	node->always_sum = 0;
+	for (size_t i = 0; i < node->length; ++i) {
+		EventPredicateResult result;
+		node->routes[i] = ROUTE_NEVER;
+		set_route(node, i, current_route(node, i));
+		node->dependents[i] = (RouterRouteDependent) {
+			.as_EventPredicateDependent = {
+				.flags_changed = &route_flags_changed,
+			},
+			.node = target,
+			.output = i,
+			.added = false,
+		};
+		if (i >= target->outputs.length || !target->outputs.elements[i]) {
+			continue;
+		}
+		if (!event_predicate_constant_result(node->predicates[i], &result)) {
+			all_constant = false;
+		}
+		if (event_predicate_is_mutable(node->predicates[i])) {
+			node->dependents[i].added = event_predicate_add_dependent(node->predicates[i], &node->dependents[i].as_EventPredicateDependent);
+		}
+	}
+	if (!all_constant && event_predicate_index_build(&node->index, node->predicates, node->length)) {
+		node->indexed = true;
+	}
+	select_handler(node);
+}
+
+static void
+visit_predicates(GraphNodeSpecification * self, GraphNode * target, GraphNodePredicateVisitor visit, void * data)
+{
+	(void) self;
+	RouterGraphNode * node = DOWNCAST(RouterGraphNode, GraphNode, target);
+	for (size_t i = 0; i < node->length; ++i) {
+		visit(&node->predicates[i], data);
+	}
+}
+
 static void destroy
 (GraphNodeSpecification * self, GraphNode * target)
 {
 	(void) self;
 	RouterGraphNode * node = DOWNCAST(RouterGraphNode, GraphNode, target);
+	remove_dependents(node);
+	if (node->dependents) {
+		free(node->dependents);
+		node->dependents = NULL;
+	}
 	if (node->predicates) {
 		free(node->predicates);
 		node->predicates = NULL;
 		node->length = 0;
 	}
+	if (node->routes) {
+		free(node->routes);
+		node->routes = NULL;
+	}
+	if (node->accepted) {
+		free(node->accepted);
+		node->accepted = NULL;
+	}
+	if (node->indexed) {
+		event_predicate_index_destroy(&node->index);
+		node->indexed = false;
+	}
 	free(target);
 }
 
@@ -93,6 +393,9 @@ GraphNodeSpecification nodespec_router = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.prepare = &prepare,
+	.handle_events = &handle_events,
+	.visit_predicates = &visit_predicates,
 	.name = "router",
 	.documentation = "Conditionally copies the received events\nAccepts events on any connector\nSends events on all connectors with configured predicates"
 	                 "\nOption 'predicates' (required): collection of predicates in the order of output connectors from zero, a received event is copied to the given connector iff it satisfies the predicate"
@@ -13,28 +13,46 @@ typedef struct {
 static bool
 handle_event(EventPositionBase * self, EventNode * event)
 {
-	ScaleGraphNode *node = DOWNCAST(ScaleGraphNode, GraphNode, DOWNCAST(GraphNode, EventPositionBase, self));
-	size_t count = node->as_GraphNode.outputs.length;
-	if (!count) {
-		event_destroy(event);
+	GraphNode *node = DOWNCAST(GraphNode, EventPositionBase, self);
+	return node->specification->handle_events(node->specification, node, &event, 1);
+}
+
+static bool
+handle_events(GraphNodeSpecification * self, GraphNode * target, EventNode ** events, size_t count)
+{
+	(void) self;
+	ScaleGraphNode *node = DOWNCAST(ScaleGraphNode, GraphNode, target);
+	if (!target->outputs.length) {
+		for (size_t i = 0; i < count; ++i) {
+			event_destroy(events[i]);
+		}
 		return true;
 	}
 
-	int64_t value = event->data.payload;
-	value -= node->center;
-	value *= node->numerator;
-	if (node->amortize_rounding_error) {
-		value += node->defect;
-	}
-	if (node->denominator) {
-		uint64_t undivided = value;
-		value /= node->denominator;
-		node->defect = undivided - value * node->denominator;
-	}
-	value += node->center;
-	event->data.payload = value;
+	const int64_t numerator = node->numerator;
+	const int64_t denominator = node->denominator;
+	const int64_t center = node->center;
+	const bool amortize_rounding_error = node->amortize_rounding_error;
+	int64_t defect = node->defect;
+	for (size_t i = 0; i < count; ++i) {
+		EventNode *event = events[i];
+		int64_t value = event->data.payload;
+		value -= center;
+		value *= numerator;
+		if (amortize_rounding_error) {
+			value += defect;
+		}
+		if (denominator) {
+			uint64_t undivided = value;
+			value /= denominator;
+			defect = undivided - value * denominator;
+		}
+		value += center;
+		event->data.payload = value;
 
-	graph_node_broadcast_forward_event(&node->as_GraphNode, event);
+		graph_node_broadcast_forward_event(target, event);
+	}
+	node->defect = defect;
 	return true;
 }
 
@@ -90,6 +108,7 @@ GraphNodeSpecification nodespec_scale = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.handle_events = &handle_events,
 	.name = "scale",
 	.documentation = "Multiplies event payload by a constant fraction\nAccepts events on any connector\nSends events on all connectors"
 	                 "\nOption 'numerator' (optional): an integer to multiply by"
@@ -70,7 +70,9 @@ static bool
 handle_event(EventPositionBase * self, EventNode * event)
 {
 	UinputGraphNode *node = DOWNCAST(UinputGraphNode, GraphNode, DOWNCAST(GraphNode, EventPositionBase, self));
-	libevdev_uinput_write_event(node->uidev, (unsigned int) event->data.code.major, (unsigned int) event->data.code.minor, (int) event->data.payload);
+	if (node->uidev) {  // NULL if the device could not be recreated after a failed reload
+		libevdev_uinput_write_event(node->uidev, (unsigned int) event->data.code.major, (unsigned int) event->data.code.minor, (int) event->data.payload);
+	}
 	event_destroy(event);
 	return true;
 }
@@ -164,10 +166,43 @@ static void destroy
 	free(target);
 }
 
+// The device is removed before its replacement is created, so that the two never exist at the same time
+static void
+suspend(GraphNodeSpecification * self, GraphNode * target)
+{
+	(void) self;
+	UinputGraphNode * node = DOWNCAST(UinputGraphNode, GraphNode, target);
+	if (node->uidev) {
+		libevdev_uinput_destroy(node->uidev);
+		node->uidev = NULL;
+	}
+}
+
+static bool
+resume(GraphNodeSpecification * self, GraphNode * target)
+{
+	(void) self;
+	UinputGraphNode * node = DOWNCAST(UinputGraphNode, GraphNode, target);
+	if (node->uidev) {
+		return true;
+	}
+	int err = libevdev_uinput_create_from_device(node->dev, LIBEVDEV_UINPUT_OPEN_MANAGED, &node->uidev);
+	if (err != 0) {
+		node->uidev = NULL;
+		if (err < 0) {
+			errno = -err;
+		}
+		return false;
+	}
+	return true;
+}
+
 GraphNodeSpecification nodespec_uinput = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.suspend = &suspend,
+	.resume = &resume,
 	.name = "uinput",
 	.documentation = "Writes received events to a new uinput device\nAccepts events on any connector\nDoes not send events"
 	                 "\nOption 'name' (required): device name provided to uinput"
@@ -2,10 +2,13 @@
 #include <limits.h>
 #include "../graph.h"
 #include "../module_registry.h"
-#include "../queue.h"
 #include "../hash_table.h"
+#include "../ring_buffer.h"
 
-typedef TYPED_HASH_TABLE(bool) EventSet;
+#define POP_CHUNK_LENGTH 64
+
+typedef TYPED_INT_HASH_TABLE(bool) EventSet;
+typedef TYPED_RING_BUFFER(EventNode*) EventBuffer;
 
 typedef struct {
 	GraphNode as_GraphNode;
@@ -17,29 +20,24 @@ typedef struct {
 	size_t max_length;
 	size_t additional_step;
 	size_t skip_next;
-	Queue buffer;
+	EventBuffer buffer;
 	EventSet buffered_set;
 } WindowGraphNode;
 
-inline static HashTableKey
-hash_event_ptr(const EventNode * ptr) {
-	return hash_table_key_from_bytes((void*)&ptr, sizeof(ptr));
-}
-
 inline static bool
 event_set_has(const EventSet * set, const EventNode * element) {
-	return hash_table_find(set, hash_event_ptr(element)) >= 0;
+	return int_hash_table_find(set, int_hash_table_key_from_ptr(element)) >= 0;
 }
 
 inline static bool
 event_set_add(EventSet * set, const EventNode * element) {
 	const bool value = true;
-	return hash_table_insert(set, hash_event_ptr(element), &value) >= 0;
+	return int_hash_table_insert(set, int_hash_table_key_from_ptr(element), &value) >= 0;
 }
 
 inline static bool
 event_set_del(EventSet * set, const EventNode * element) {
-	return hash_table_delete_by_key(set, hash_event_ptr(element));
+	return int_hash_table_delete_by_key(set, int_hash_table_key_from_ptr(element));
 }
 
 static EventNode *
@@ -76,7 +74,7 @@ trigger_new_window(WindowGraphNode * node, EventNode * base)
 
 	size_t step = 1;
 	if (node->is_jumping) {
-		step = queue_length(&node->buffer);
+		step = node->buffer.length;
 	}
 	step += node->additional_step;
 	if (step < 1) {
@@ -84,18 +82,20 @@ trigger_new_window(WindowGraphNode * node, EventNode * base)
 	}
 
 	while (step > 0) {
-		QueueValue popped;
-		if (!queue_try_pop(&node->buffer, &popped)) {
+		EventNode *popped[POP_CHUNK_LENGTH];
+		size_t count = ring_buffer_pop_bulk(&node->buffer, popped, step < POP_CHUNK_LENGTH ? step : POP_CHUNK_LENGTH);
+		if (!count) {
 			break;
 		}
-		--step;
-		EventNode * event = popped.as_ptr;
-		event_set_del(&node->buffered_set, event);
+		step -= count;
+		for (size_t i = 0; i < count; ++i) {
+			event_set_del(&node->buffered_set, popped[i]);
+		}
 	}
 	node->skip_next += step;
 
-	QUEUE_FOREACH_INDEX(i, &node->buffer) {
-		EventNode *orig = node->buffer.values[i].as_ptr;
+	for (size_t i = 0; i < node->buffer.length; ++i) {
+		EventNode *orig = *ring_buffer_at(&node->buffer, i);
 		if (!orig) {
 			continue;
 		}
@@ -123,8 +123,8 @@ handle_event(EventPositionBase * self, EventNode * event)
 	const AbsoluteTime new_time = event->data.time;
 	if (node->has_max_time) {
 		const RelativeTime threshold = node->max_time;
-		while (queue_length(&node->buffer) > 0) {
-			EventNode *first_event = queue_peek(&node->buffer).as_ptr;
+		while (node->buffer.length > 0) {
+			EventNode *first_event = *ring_buffer_at(&node->buffer, 0);
 			if (!first_event) {
 				break;
 			}
@@ -158,12 +158,12 @@ handle_event(EventPositionBase * self, EventNode * event)
 	if (event_replicate(event, 1)) {
 		graph_node_broadcast_forward_event(&node->as_GraphNode, event->next);
 	}
-	queue_put(&node->buffer, (QueueValue){.as_ptr = event});
+	ring_buffer_push(&node->buffer, &event);
 	event_set_add(&node->buffered_set, event);
 
 	if (node->has_max_length) {
 		const size_t threshold = node->max_length;
-		while (replacement && queue_length(&node->buffer) >= threshold) {
+		while (replacement && node->buffer.length >= threshold) {
 			trigger_new_window(node, replicate_and_advance(&replacement));
 		}
 	}
@@ -262,10 +262,11 @@ create(GraphNodeSpecification * spec, GraphNodeConfig * config, InitializationEn
 		.max_length = max_length,
 		.additional_step = additional_step,
 		.skip_next = 0,
-		.buffer = EMPTY_QUEUE,
+		.buffer = {},
 		.buffered_set = {},
 	};
-	hash_table_init(&node->buffered_set, NULL);
+	ring_buffer_init(&node->buffer);
+	int_hash_table_init(&node->buffered_set, NULL);
 	return &node->as_GraphNode;
 }
 
@@ -275,15 +276,37 @@ static void destroy
 	(void) self;
 	WindowGraphNode * node = DOWNCAST(WindowGraphNode, GraphNode, target);
 	modifier_set_destruct(&node->terminator_prototype.modifiers);
-	queue_deinit(&node->buffer);
-	hash_table_deinit(&node->buffered_set);
+	ring_buffer_deinit(&node->buffer);
+	int_hash_table_deinit(&node->buffered_set);
 	free(target);
 }
 
+// Mirrors the option handling of create
+static size_t
+max_amplification(GraphNodeSpecification * self, const GraphNodeConfig * config, InitializationEnvironment * env)
+{
+	(void) self;
+	const config_setting_t *max_length_setting = config->options ? config_setting_get_member(config->options, "max_length") : NULL;
+	if (!max_length_setting) {
+		return SIZE_MAX;
+	}
+	long long max_length = env_resolve_constant(env, max_length_setting);
+	if (max_length > INT32_MAX) {
+		return SIZE_MAX;
+	}
+	// Every buffered event is retransmitted at most once per window, a terminator may follow each received event
+	size_t amplification = max_length < 1 ? 1 : (size_t) max_length;
+	if (config_setting_get_member(config->options, "terminator")) {
+		++amplification;
+	}
+	return amplification;
+}
+
 GraphNodeSpecification nodespec_window = (GraphNodeSpecification) {
 	.create = &create,
 	.destroy = &destroy,
 	.register_io = NULL,
+	.max_amplification = &max_amplification,
 	.name = "window",
 	.documentation = "Passes events through while copying them into an internal buffer, when buffer buffer.length or (buffer.last.time - buffer.first.time) thresholds are met optionally sends terminator event, rewinds events to buffer start, skips ((is_jumping ? buffer.length : 1) + additional_step) events, retransmits remaining buffered events and starts over\nAccepts events on any connector\nSends events on all connectors"
 	                 "\nOption 'is_jumping' (optional): whether to send events at most once"
@@ -3,6 +3,7 @@
 #include <assert.h>
 #include <limits.h>
 #include "processing.h"
+#include "event_injection.h"
 
 static bool
 io_subscription_list_extend(IOSubscriptionList * lst)
@@ -74,6 +75,12 @@ io_subscription_list_add(IOSubscriptionList * lst, int fd, IOHandling *subscribe
 	lst->length = i + 1;
 }
 
+void
+io_subscription_list_clear(IOSubscriptionList * lst)
+{
+	lst->length = 0;
+}
+
 static int
 populate_fd_set(fd_set * fds, IOSubscriptionList * src, int old_max_fd)
 {
@@ -125,8 +132,17 @@ process_io(ProcessingState * state, const RelativeTime * timeout)
 	max_fd = populate_fd_set(&readfds, &state->wait_input, max_fd);
 	max_fd = populate_fd_set(&writefds, &state->wait_output, max_fd);
 
+	// Only wakes up the loop, the injections are drained by process_iteration
+	int wake_fd = event_injection_wake_fd();
+	if (wake_fd >= 0) {
+		FD_SET(wake_fd, &readfds);
+		if (wake_fd > max_fd) {
+			max_fd = wake_fd;
+		}
+	}
+
 	++max_fd;
-	int ready = pselect(max_fd, &readfds, &writefds, NULL, &timeout->relative, NULL);
+	int ready = pselect(max_fd, &readfds, &writefds, NULL, timeout ? &timeout->relative : NULL, &state->wait_sigmask);
 
 	if (ready < 0) {
 		FD_ZERO(&readfds);
@@ -169,6 +185,21 @@ schedule_delay(ProcessingState * state, EventPositionBase * target, void (*callb
 	return true;
 }
 
+void
+cancel_delays(ProcessingState * state, EventPositionBase * target)
+{
+	DelayList **next = &state->wait_delay;
+	while (*next) {
+		DelayList *current = *next;
+		if (current->target != target) {
+			next = &current->next;
+			continue;
+		}
+		*next = current->next;
+		free(current);
+	}
+}
+
 static const RelativeTime ZERO_TO = {
 	.relative ={
 		.tv_sec = 0,
@@ -200,6 +231,23 @@ process_single_scheduled(ProcessingState * state, const AbsoluteTime extern_time
 	return true;
 }
 
+// Consecutive events at the same position that the scheduler would dispatch next
+static size_t
+collect_batch(const ProcessingState * state, EventNode * first, const AbsoluteTime * max_time, EventNode ** batch)
+{
+	size_t count = 0;
+	for (EventNode *ev = first; ev != &END_EVENTS && count < PROCESSING_BATCH_SIZE; ev = ev->next) {
+		if (ev->position != first->position || ev->data.priority > state->pass_priority) {
+			break;
+		}
+		if (max_time && absolute_time_cmp(ev->data.time, *max_time) > 0) {
+			break;
+		}
+		batch[count++] = ev;
+	}
+	return count;
+}
+
 static bool
 process_events_until(ProcessingState * state, const AbsoluteTime * max_time)
 {
@@ -239,7 +287,7 @@ process_events_until(ProcessingState * state, const AbsoluteTime * max_time)
 			if (!position) {
 				continue;
 			}
-			if (position->waiting_new_event) {
+			if (position->waiting_new_event || position->blocked) {
 				continue;
 			}
 			bool (*handler) (EventPositionBase*, EventNode*) = position->handle_event;
@@ -256,7 +304,14 @@ process_events_until(ProcessingState * state, const AbsoluteTime * max_time)
 			}
 
 			stable = false;
-			bool should_rewind = handler(position, ev);
+			bool should_rewind;
+			if (position->handle_events) {
+				EventNode *batch[PROCESSING_BATCH_SIZE];
+				size_t count = collect_batch(state, ev, max_time, batch);
+				should_rewind = position->handle_events(position, batch, count);
+			} else {
+				should_rewind = handler(position, ev);
+			}
 			if (should_rewind) {
 				// ev = &END_EVENTS;  // Will be set to FIRST_EVENT by loop increment
 				next_priority = INT32_MIN;  // Break out of the outermost loop
@@ -277,6 +332,7 @@ process_events_until(ProcessingState * state, const AbsoluteTime * max_time)
 void
 process_iteration(ProcessingState * state)
 {
+	event_injection_drain();
 	AbsoluteTime extern_time = get_current_time();
 
 	// late_by.tv_sec = extern_time.tv_sec - state->reached_time.tv_sec;
@@ -2,8 +2,11 @@
 #define PROCESSING_H_
 
 #include <sys/select.h>
+#include <signal.h>
 #include "events.h"
 
+#define PROCESSING_BATCH_SIZE 64
+
 typedef struct io_handling IOHandling;
 
 // no virtual multiinheritance
@@ -36,13 +39,16 @@ typedef struct {
 	AbsoluteTime reached_time;
 	int32_t pass_priority;
 	bool has_future_events;
+	sigset_t wait_sigmask;  // Signal mask while waiting for I/O, so that signals blocked elsewhere interrupt the wait instead of staying pending until the next input
 } ProcessingState;
 
 void io_subscription_list_init(IOSubscriptionList * lst, size_t capacity);
 void io_subscription_list_deinit(IOSubscriptionList * lst);
 void io_subscription_list_add(IOSubscriptionList * lst, int fd, IOHandling *subscriber);
+void io_subscription_list_clear(IOSubscriptionList * lst);
 
 bool schedule_delay(ProcessingState * state, EventPositionBase * target, void (*callback) (EventPositionBase*, void*, const AbsoluteTime*), const AbsoluteTime * time);
+void cancel_delays(ProcessingState * state, EventPositionBase * target);
 bool process_io(ProcessingState * state, const RelativeTime * timeout);
 void process_iteration(ProcessingState * state);
 
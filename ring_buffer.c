@@ -0,0 +1,127 @@
+#include <string.h>
+#include "ring_buffer.h"
+
+#define MIN_CAPACITY 8
+#define SHRINK_RATIO 8  // Growable buffers are halved while at most this part is used
+
+// Copies count values starting at position into contiguous memory
+static void
+copy_out(const RingBufferDynamicData * rb, size_t position, size_t count, char * target)
+{
+	size_t slot = ring_buffer_slot(rb, position);
+	size_t first = rb->capacity - slot;
+	if (first > count) {
+		first = count;
+	}
+	memcpy(target, (const char*) rb->value_array + slot * rb->value_size, first * rb->value_size);
+	memcpy(target + first * rb->value_size, rb->value_array, (count - first) * rb->value_size);
+}
+
+// The values are moved to the start of the new array
+static bool
+ring_buffer_resize(RingBufferDynamicData * rb, size_t capacity)
+{
+	char *values = calloc(capacity, rb->value_size);
+	if (!values) {
+		return false;
+	}
+	if (rb->length) {
+		copy_out(rb, 0, rb->length, values);
+	}
+	free(rb->value_array);
+	rb->value_array = values;
+	rb->capacity = capacity;
+	rb->head = 0;
+	return true;
+}
+
+bool
+ring_buffer_init_impl(RingBufferDynamicData * rb, size_t value_size, size_t fixed_capacity)
+{
+	*rb = (RingBufferDynamicData) {
+		.value_array = NULL,
+		.capacity = 0,
+		.head = 0,
+		.length = 0,
+		.fixed = false,
+		.value_size = value_size,
+	};
+	if (!fixed_capacity) {
+		return true;
+	}
+	size_t capacity = 1;
+	while (capacity < fixed_capacity) {
+		capacity <<= 1;
+	}
+	if (!ring_buffer_resize(rb, capacity)) {
+		return false;
+	}
+	rb->fixed = true;
+	return true;
+}
+
+void
+ring_buffer_deinit_impl(RingBufferDynamicData * rb)
+{
+	free(rb->value_array);
+	rb->value_array = NULL;
+	rb->capacity = 0;
+	rb->head = 0;
+	rb->length = 0;
+}
+
+bool
+ring_buffer_push_bulk_impl(RingBufferDynamicData * rb, const void * values_ptr, size_t count)
+{
+	if (!count) {
+		return true;
+	}
+	size_t required = rb->length + count;
+	if (required > rb->capacity) {
+		if (rb->fixed) {
+			return false;
+		}
+		size_t capacity = rb->capacity ? rb->capacity : MIN_CAPACITY;
+		while (capacity < required) {
+			capacity <<= 1;
+		}
+		if (!ring_buffer_resize(rb, capacity)) {
+			return false;
+		}
+	}
+	size_t slot = ring_buffer_slot(rb, rb->length);
+	size_t first = rb->capacity - slot;
+	if (first > count) {
+		first = count;
+	}
+	memcpy((char*) rb->value_array + slot * rb->value_size, values_ptr, first * rb->value_size);
+	memcpy(rb->value_array, (const char*) values_ptr + first * rb->value_size, (count - first) * rb->value_size);
+	rb->length = required;
+	return true;
+}
+
+size_t
+ring_buffer_pop_bulk_impl(RingBufferDynamicData * rb, void * values_ptr, size_t count)
+{
+	if (count > rb->length) {
+		count = rb->length;
+	}
+	if (!count) {
+		return 0;
+	}
+	if (values_ptr) {
+		copy_out(rb, 0, count, values_ptr);
+	}
+	rb->head = ring_buffer_slot(rb, count);
+	rb->length -= count;
+
+	// Give back the memory of a burst, a failed reallocation keeps the old array
+	if (!rb->fixed && rb->capacity > MIN_CAPACITY && rb->length <= rb->capacity / SHRINK_RATIO) {
+		size_t capacity = rb->capacity;
+		while (capacity > MIN_CAPACITY && rb->length <= capacity / SHRINK_RATIO) {
+			capacity >>= 1;
+		}
+		ring_buffer_resize(rb, capacity);
+	}
+	return count;
+}
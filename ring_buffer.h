@@ -0,0 +1,45 @@
+#ifndef RING_BUFFER_H_
+#define RING_BUFFER_H_
+
+#include "defs.h"
+
+#define RING_BUFFER_INTERFACE_FIELDS \
+	size_t capacity;  /* Zero or a power of two */ \
+	size_t head;  /* Slot of the first element */ \
+	size_t length; \
+	bool fixed;  /* Never reallocated, pushes fail when full */ \
+;
+
+#define TYPED_RING_BUFFER(T) union { RingBufferDynamicData as_RingBufferDynamicData; struct { typeof(T) *value_array; RING_BUFFER_INTERFACE_FIELDS; }; }
+
+typedef struct {
+	void *value_array;
+	RING_BUFFER_INTERFACE_FIELDS;
+	size_t value_size;
+} RingBufferDynamicData;
+
+// A non-zero fixed_capacity is rounded up to a power of two and allocated at once, otherwise the buffer grows when full and shrinks once mostly empty
+bool ring_buffer_init_impl(RingBufferDynamicData * dyndata, size_t value_size, size_t fixed_capacity);
+void ring_buffer_deinit_impl(RingBufferDynamicData * dyndata);
+// Either all values are appended or none
+bool ring_buffer_push_bulk_impl(RingBufferDynamicData * dyndata, const void * values_ptr, size_t count);
+// Removes at most count first values, copying them to values_ptr unless it is NULL, returns the number removed
+size_t ring_buffer_pop_bulk_impl(RingBufferDynamicData * dyndata, void * values_ptr, size_t count);
+
+__attribute__((unused)) inline static size_t
+ring_buffer_slot(const RingBufferDynamicData * dyndata, size_t position)
+{
+	return (dyndata->head + position) & (dyndata->capacity - 1);
+}
+
+#define ring_buffer_init(rb) ring_buffer_init_impl(&(rb)->as_RingBufferDynamicData, sizeof(*(rb)->value_array), 0)
+#define ring_buffer_init_fixed(rb, capacity) ring_buffer_init_impl(&(rb)->as_RingBufferDynamicData, sizeof(*(rb)->value_array), capacity)
+#define ring_buffer_deinit(rb) ring_buffer_deinit_impl(&(rb)->as_RingBufferDynamicData)
+#define ring_buffer_push(rb, value_ptr) ring_buffer_push_bulk_impl(&(rb)->as_RingBufferDynamicData, IMPLICIT_CAST(const void, const typeof(*(rb)->value_array), value_ptr), 1)
+#define ring_buffer_push_bulk(rb, values_ptr, count) ring_buffer_push_bulk_impl(&(rb)->as_RingBufferDynamicData, IMPLICIT_CAST(const void, const typeof(*(rb)->value_array), values_ptr), count)
+#define ring_buffer_pop(rb, value_ptr) (ring_buffer_pop_bulk_impl(&(rb)->as_RingBufferDynamicData, IMPLICIT_CAST(void, typeof(*(rb)->value_array), value_ptr), 1) == 1)
+#define ring_buffer_pop_bulk(rb, values_ptr, count) ring_buffer_pop_bulk_impl(&(rb)->as_RingBufferDynamicData, IMPLICIT_CAST(void, typeof(*(rb)->value_array), values_ptr), count)
+// Pointer to the value at position (counted from the first one), which must be less than length
+#define ring_buffer_at(rb, position) (&(rb)->value_array[ring_buffer_slot(&(rb)->as_RingBufferDynamicData, position)])
+
+#endif /* end of include guard: RING_BUFFER_H_ */